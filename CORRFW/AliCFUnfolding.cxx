@@ -92,7 +92,34 @@
 #include "TH2D.h"
 #include "TH3D.h"
 #include "TRandom3.h"
+#include <thread>
+
+namespace {
+  // content type of a THnSparse : the indexed iterations round their intermediate
+  // results exactly as storing them in the THnSparse would
+  enum EStorage { kStorageUnknown=-1, kStorageD, kStorageF, kStorageL, kStorageI, kStorageS, kStorageC };
+
+  Int_t GetStorage(const THnSparse* hist) {
+    if (dynamic_cast<const THnSparseD*>(hist)) return kStorageD;
+    if (dynamic_cast<const THnSparseF*>(hist)) return kStorageF;
+    if (dynamic_cast<const THnSparseL*>(hist)) return kStorageL;
+    if (dynamic_cast<const THnSparseI*>(hist)) return kStorageI;
+    if (dynamic_cast<const THnSparseS*>(hist)) return kStorageS;
+    if (dynamic_cast<const THnSparseC*>(hist)) return kStorageC;
+    return kStorageUnknown;
+  }
 
+  inline Double_t Store(Int_t storage, Double_t value) {
+    switch (storage) {
+    case kStorageF : return (Float_t) value;
+    case kStorageL : return (Long_t)  value;
+    case kStorageI : return (Int_t)   value;
+    case kStorageS : return (Short_t) value;
+    case kStorageC : return (Char_t)  value;
+    default        : return value;
+    }
+  }
+}
 
 ClassImp(AliCFUnfolding)
 
@@ -130,7 +157,30 @@ AliCFUnfolding::AliCFUnfolding() :
   fDeltaUnfoldedP(0x0),
   fDeltaUnfoldedN(0x0),
   fNCalcCorrErrors(0),
-  fRandomSeed(0)
+  fRandomSeed(0),
+  fNThreads(1),
+  fIndexed(kFALSE),
+  fTrueBins(0x0),
+  fMeasuredBins(0x0),
+  fCondValue(),
+  fCondTrue(),
+  fCondMeasured(),
+  fInvBin(),
+  fInvOrder(),
+  fInvValue(),
+  fPriorTimesEff(),
+  fEffValue(),
+  fMeasValue(),
+  fEstValue(),
+  fUnfoldedValue(),
+  fEstOrder(),
+  fUnfoldedOrder(),
+  fFilled(),
+  fPriorOrigValue(),
+  fPriorOrigTrue(),
+  fStoragePrior(-1),
+  fStorageEstimate(-1),
+  fStorageInverse(-1)
 {
   //
   // default constructor
@@ -174,7 +224,30 @@ AliCFUnfolding::AliCFUnfolding(const Char_t* name, const Char_t* title, const In
   fDeltaUnfoldedP(0x0),
   fDeltaUnfoldedN(0x0),
   fNCalcCorrErrors(0),
-  fRandomSeed(randomSeed)
+  fRandomSeed(randomSeed),
+  fNThreads(1),
+  fIndexed(kFALSE),
+  fTrueBins(0x0),
+  fMeasuredBins(0x0),
+  fCondValue(),
+  fCondTrue(),
+  fCondMeasured(),
+  fInvBin(),
+  fInvOrder(),
+  fInvValue(),
+  fPriorTimesEff(),
+  fEffValue(),
+  fMeasValue(),
+  fEstValue(),
+  fUnfoldedValue(),
+  fEstOrder(),
+  fUnfoldedOrder(),
+  fFilled(),
+  fPriorOrigValue(),
+  fPriorOrigTrue(),
+  fStoragePrior(-1),
+  fStorageEstimate(-1),
+  fStorageInverse(-1)
 {
   //
   // named constructor
@@ -239,6 +312,8 @@ AliCFUnfolding::~AliCFUnfolding() {
   if (fRandom3)            delete fRandom3;
   if (fDeltaUnfoldedP)     delete fDeltaUnfoldedP;
   if (fDeltaUnfoldedN)     delete fDeltaUnfoldedN;
+  if (fTrueBins)           delete fTrueBins;
+  if (fMeasuredBins)       delete fMeasuredBins;
  
 }
 
@@ -274,7 +349,8 @@ void AliCFUnfolding::Init() {
   fDeltaUnfoldedN->SetTitle("");
   fDeltaUnfoldedN->Reset();
 
-
+  // index the conditional matrix for the iterations
+  InitIndexed();
 }
 
 
@@ -355,9 +431,16 @@ void AliCFUnfolding::Unfold() {
 
   for (iIterBayes=0; iIterBayes<fMaxNumIterations; iIterBayes++) { // bayes iterations
 
-    CreateEstMeasured(); // create measured estimate from prior
-    CreateInvResponse(); // create inverse response  from prior
-    CreateUnfolded();    // create unfoled spectrum  from measured and inverse response
+    if (fIndexed) {
+      CreateEstMeasuredIndexed();
+      CreateInvResponseIndexed();
+      CreateUnfoldedIndexed();
+    }
+    else {
+      CreateEstMeasured(); // create measured estimate from prior
+      CreateInvResponse(); // create inverse response  from prior
+      CreateUnfolded();    // create unfoled spectrum  from measured and inverse response
+    }
 
     convergence = GetConvergence();
     AliDebug(0,Form("convergence at iteration %d is %e",iIterBayes,convergence));
@@ -457,7 +540,8 @@ void AliCFUnfolding::CalculateCorrelatedErrors() {
 
 
   //Do fNRandomIterations = bayes iterations performed
-  for (int i=0; i<fNRandomIterations; i++) {
+  //with fNThreads>1 all but the last one may already be done in threads
+  for (int i=UnfoldRandomizedInThreads(); i<fNRandomIterations; i++) {
     
     // reset prior to original one
     if (fPrior) delete fPrior ;
@@ -535,7 +619,7 @@ void AliCFUnfolding::CreateRandomizedDist() {
 }
 
 //______________________________________________________________
-void AliCFUnfolding::FillDeltaUnfoldedProfile() {
+void AliCFUnfolding::FillDeltaUnfoldedProfile(const Double_t *unfolded) {
   //
   // Store difference of unfolded spectrum from measured distribution and unfolded spectrum from randomized distribution
   // The delta profile has been set to a THnSparse to handle N dimension
@@ -544,9 +628,16 @@ void AliCFUnfolding::FillDeltaUnfoldedProfile() {
   // The relation between iterations (n+1) and n is as follows :
   //  mean_{n+1} = (n*mean_n + value_{n+1}) / (n+1)
   // sigma_{n+1} = sqrt { 1/(n+1) * [ n*sigma_n^2 + (n^2+n)*(mean_{n+1}-mean_n)^2 ] }    (can this be optimized?)
+  // If "unfolded" is given, the unfolded spectrum is taken from this vector (indexed like fTrueBins) instead of fUnfolded
 
   for (Long_t iBin=0; iBin<fUnfoldedFinal->GetNbins(); iBin++) {
-    Double_t deltaInBin   = fUnfoldedFinal->GetBinContent(iBin,fCoordinatesN_M) - fUnfolded->GetBinContent(fCoordinatesN_M);
+    Double_t finalInBin   = fUnfoldedFinal->GetBinContent(iBin,fCoordinatesN_M);
+    Double_t deltaInBin   = 0.;
+    if (unfolded) {
+      Long64_t iTrue = fTrueBins->GetBin(fCoordinatesN_M,kFALSE);
+      deltaInBin = finalInBin - (iTrue<0 ? 0. : unfolded[iTrue]);
+    }
+    else deltaInBin = finalInBin - fUnfolded->GetBinContent(fCoordinatesN_M);
     Double_t entriesInBin = fDeltaUnfoldedN->GetBinContent(fCoordinatesN_M);
     //AliDebug(2,Form("%e %e ==> delta = %e\n",fUnfoldedFinal->GetBinContent(iBin,fCoordinatesN_M),fUnfolded->GetBinContent(iBin),deltaInBin));
 
@@ -862,3 +953,350 @@ void AliCFUnfolding::CreateFlatPrior() {
   delete [] bin;
   delete [] bins;
 }
+
+//______________________________________________________________
+
+void AliCFUnfolding::InitIndexed() {
+  //
+  // Builds the indexed representation of the conditional matrix used by the iterations :
+  // the true and measured coordinates of each bin of fConditional are looked up once and
+  // replaced by positions in dense true and measured vectors (the bin indices of fTrueBins
+  // and fMeasuredBins), so that an iteration only does array look-ups.
+  // The bins are kept in the order of fConditional and fInverseResponse, the order in which
+  // the THnSparse based functions accumulate them, and the intermediate results are rounded
+  // to the content type of the corresponding THnSparse : the results are identical.
+  //
+
+  fStoragePrior    = GetStorage(fUnfolded);
+  fStorageEstimate = GetStorage(fMeasuredEstimate);
+  fStorageInverse  = GetStorage(fInverseResponse);
+  if (fStoragePrior == kStorageUnknown || fStorageEstimate == kStorageUnknown || fStorageInverse == kStorageUnknown) {
+    AliInfo("Unknown THnSparse content type, the iterations are done on the THnSparse");
+    return;
+  }
+
+  fTrueBins = (THnSparse*) fPrior->Clone("trueBins");
+  fTrueBins->Reset();
+  fMeasuredBins = (THnSparse*) fMeasured->Clone("measuredBins");
+  fMeasuredBins->Reset();
+
+  Long64_t nBins = fConditional->GetNbins();
+  fCondValue   .resize(nBins);
+  fCondTrue    .resize(nBins);
+  fCondMeasured.resize(nBins);
+  fInvBin      .resize(nBins);
+  fInvValue    .resize(nBins);
+  std::vector<Long64_t> condBin(fInverseResponse->GetNbins(),-1);
+  for (Long64_t iBin=0; iBin<nBins; iBin++) {
+    fCondValue[iBin] = fConditional->GetBinContent(iBin,fCoordinates2N);
+    GetCoordinates();
+    fCondTrue    [iBin] = fTrueBins    ->GetBin(fCoordinatesN_T,kTRUE);
+    fCondMeasured[iBin] = fMeasuredBins->GetBin(fCoordinatesN_M,kTRUE);
+    fInvBin      [iBin] = fInverseResponse->GetBin(fCoordinates2N,kFALSE);
+    if (fInvBin[iBin]<0) break;
+    fInvValue[iBin] = fInverseResponse->GetBinContent(fInvBin[iBin]);
+    condBin[fInvBin[iBin]] = iBin;
+  }
+  // both are copies of the response matrix, this should not happen
+  Bool_t sameBins = (nBins == (Long64_t)condBin.size());
+  for (Long64_t iBin=0; iBin<(Long64_t)condBin.size() && sameBins; iBin++) sameBins = (condBin[iBin]>=0);
+  if (!sameBins) {
+    AliError("Inverse response and conditional matrices have different bins, the iterations are done on the THnSparse");
+    return;
+  }
+  fInvOrder.swap(condBin);
+
+  Int_t nTrue = fTrueBins->GetNbins();
+  Int_t nMeas = fMeasuredBins->GetNbins();
+  fPriorTimesEff.resize(nTrue);
+  fEffValue     .resize(nTrue);
+  fUnfoldedValue.resize(nTrue);
+  fMeasValue    .resize(nMeas);
+  fEstValue     .resize(nMeas);
+  fFilled       .resize(TMath::Max(nTrue,nMeas));
+
+  fPriorOrigValue.resize(fPriorOrig->GetNbins());
+  fPriorOrigTrue .resize(fPriorOrig->GetNbins());
+  for (Long64_t iBin=0; iBin<fPriorOrig->GetNbins(); iBin++) {
+    fPriorOrigValue[iBin] = fPriorOrig->GetBinContent(iBin,fCoordinatesN_T);
+    fPriorOrigTrue [iBin] = fTrueBins->GetBin(fCoordinatesN_T,kFALSE);
+  }
+
+  fIndexed = kTRUE;
+  AliInfo(Form("Indexed %lld bins of the conditional matrix, %d true and %d measured bins",nBins,nTrue,nMeas));
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::LoadIndexedInputs() {
+  //
+  // Reads the prior x efficiency, the efficiency and the measured spectrum into the dense vectors
+  //
+
+  for (Int_t iTrue=0; iTrue<(Int_t)fEffValue.size(); iTrue++) {
+    fTrueBins->GetBinContent(iTrue,fCoordinatesN_T);
+    fEffValue[iTrue] = fEfficiency->GetBinContent(fCoordinatesN_T);
+    // as THnSparse::Multiply() : bins missing in the prior stay empty
+    Long64_t priorBin = fPrior->GetBin(fCoordinatesN_T,kFALSE);
+    fPriorTimesEff[iTrue] = (priorBin<0 ? 0. : Store(fStoragePrior,fPrior->GetBinContent(priorBin)*fEffValue[iTrue]));
+  }
+  for (Int_t iMeas=0; iMeas<(Int_t)fMeasValue.size(); iMeas++) {
+    fMeasuredBins->GetBinContent(iMeas,fCoordinatesN_M);
+    fMeasValue[iMeas] = fMeasured->GetBinContent(fCoordinatesN_M);
+  }
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::CreateEstMeasuredIndexed() {
+  //
+  // Same as CreateEstMeasured(), on the indexed representation
+  //
+
+  LoadIndexedInputs();
+
+  fEstValue.assign(fEstValue.size(),0.);
+  fFilled.assign(fFilled.size(),0);
+  fEstOrder.clear();
+  for (Long64_t iBin=0; iBin<(Long64_t)fCondValue.size(); iBin++) {
+    Double_t fill = fCondValue[iBin] * fPriorTimesEff[fCondTrue[iBin]] ;
+    if (fill>0.) {
+      Int_t iMeas = fCondMeasured[iBin];
+      fEstValue[iMeas] = Store(fStorageEstimate,fEstValue[iMeas]+fill);
+      if (!fFilled[iMeas]) {
+        fFilled[iMeas] = 1;
+        fEstOrder.push_back(iMeas);
+      }
+    }
+  }
+
+  // bins are created in the same order as in CreateEstMeasured()
+  fMeasuredEstimate->Reset();
+  for (UInt_t i=0; i<fEstOrder.size(); i++) {
+    fMeasuredBins->GetBinContent(fEstOrder[i],fCoordinatesN_M);
+    fMeasuredEstimate->AddBinContent(fCoordinatesN_M,fEstValue[fEstOrder[i]]);
+    fMeasuredEstimate->SetBinError(fCoordinatesN_M,0.);
+  }
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::CreateInvResponseIndexed() {
+  //
+  // Same as CreateInvResponse(), on the indexed representation
+  // uses the prior x efficiency loaded by CreateEstMeasuredIndexed()
+  //
+
+  for (Long64_t iBin=0; iBin<(Long64_t)fCondValue.size(); iBin++) {
+    Double_t estMeasuredValue = fEstValue[fCondMeasured[iBin]];
+    Double_t fill = (estMeasuredValue>0. ? fCondValue[iBin] * fPriorTimesEff[fCondTrue[iBin]] / estMeasuredValue : 0. ) ;
+    if (fill>0. || fInvValue[iBin]>0.) {
+      fInvValue[iBin] = Store(fStorageInverse,fill);
+      fInverseResponse->SetBinContent(fInvBin[iBin],fill);
+      fInverseResponse->SetBinError  (fInvBin[iBin],0.);
+    }
+  }
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::CreateUnfoldedIndexed() {
+  //
+  // Same as CreateUnfolded(), on the indexed representation
+  //
+
+  fUnfoldedValue.assign(fUnfoldedValue.size(),0.);
+  fFilled.assign(fFilled.size(),0);
+  fUnfoldedOrder.clear();
+  for (Long64_t i=0; i<(Long64_t)fInvOrder.size(); i++) {
+    Long64_t iBin = fInvOrder[i];
+    Int_t iTrue = fCondTrue[iBin];
+    Double_t effValue = fEffValue[iTrue];
+    Double_t fill = (effValue>0. ? fInvValue[iBin] * fMeasValue[fCondMeasured[iBin]] / effValue : 0.) ;
+    if (fill>0.) {
+      fUnfoldedValue[iTrue] = Store(fStoragePrior,fUnfoldedValue[iTrue]+fill);
+      if (!fFilled[iTrue]) {
+        fFilled[iTrue] = 1;
+        fUnfoldedOrder.push_back(iTrue);
+      }
+    }
+  }
+
+  // bins are created in the same order as in CreateUnfolded(), errors are set to zero
+  fUnfolded->Reset();
+  for (UInt_t i=0; i<fUnfoldedOrder.size(); i++) {
+    fTrueBins->GetBinContent(fUnfoldedOrder[i],fCoordinatesN_T);
+    fUnfolded->SetBinError  (fCoordinatesN_T,0.);
+    fUnfolded->AddBinContent(fCoordinatesN_T,fUnfoldedValue[fUnfoldedOrder[i]]);
+  }
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::UnfoldRandomizedIndexed(const Double_t *eff, const Double_t *meas, Double_t *unfolded, Double_t *convergence) const {
+  //
+  // Unfold() of one randomized distribution, given its efficiency and measured spectrum in the dense
+  // vectors (eff, meas), starting from the original prior and without smoothing.
+  // Fills the unfolded spectrum (dense vector) and the convergence of the last iteration.
+  // Only reads the members, so that several distributions can be unfolded at the same time.
+  //
+
+  Int_t nTrue = fUnfoldedValue.size();
+  Int_t nMeas = fEstValue.size();
+  Long64_t nBins = fCondValue.size();
+
+  std::vector<Double_t> prior(nTrue,0.), priorTimesEff(nTrue), est(nMeas), inv(fInvValue);
+  std::vector<Char_t>   priorFilled(nTrue,0), filled(nTrue);
+  std::vector<Int_t>    priorOrder, order; // true bins of the prior/unfolded, in their bin order
+  for (UInt_t i=0; i<fPriorOrigTrue.size(); i++) {
+    if (fPriorOrigTrue[i]<0) continue;
+    prior      [fPriorOrigTrue[i]] = fPriorOrigValue[i];
+    priorFilled[fPriorOrigTrue[i]] = 1;
+  }
+
+  for (Int_t iIterBayes=0; iIterBayes<fMaxNumIterations; iIterBayes++) {
+    for (Int_t iTrue=0; iTrue<nTrue; iTrue++)
+      priorTimesEff[iTrue] = (priorFilled[iTrue] ? Store(fStoragePrior,prior[iTrue]*eff[iTrue]) : 0.);
+
+    // measured estimate
+    est.assign(nMeas,0.);
+    for (Long64_t iBin=0; iBin<nBins; iBin++) {
+      Double_t fill = fCondValue[iBin] * priorTimesEff[fCondTrue[iBin]] ;
+      if (fill>0.) est[fCondMeasured[iBin]] = Store(fStorageEstimate,est[fCondMeasured[iBin]]+fill);
+    }
+
+    // inverse response
+    for (Long64_t iBin=0; iBin<nBins; iBin++) {
+      Double_t estMeasuredValue = est[fCondMeasured[iBin]];
+      Double_t fill = (estMeasuredValue>0. ? fCondValue[iBin] * priorTimesEff[fCondTrue[iBin]] / estMeasuredValue : 0. ) ;
+      if (fill>0. || inv[iBin]>0.) inv[iBin] = Store(fStorageInverse,fill);
+    }
+
+    // unfolded
+    for (Int_t iTrue=0; iTrue<nTrue; iTrue++) {
+      unfolded[iTrue] = 0.;
+      filled  [iTrue] = 0;
+    }
+    order.clear();
+    for (Long64_t i=0; i<(Long64_t)fInvOrder.size(); i++) {
+      Long64_t iBin = fInvOrder[i];
+      Int_t iTrue = fCondTrue[iBin];
+      Double_t fill = (eff[iTrue]>0. ? inv[iBin] * meas[fCondMeasured[iBin]] / eff[iTrue] : 0.) ;
+      if (fill>0.) {
+        unfolded[iTrue] = Store(fStoragePrior,unfolded[iTrue]+fill);
+        if (!filled[iTrue]) {
+          filled[iTrue] = 1;
+          order.push_back(iTrue);
+        }
+      }
+    }
+
+    // convergence as in GetConvergence(), summed in the bin order of the prior
+    *convergence = 0.;
+    if (iIterBayes == 0) {
+      for (UInt_t i=0; i<fPriorOrigValue.size(); i++) {
+        Double_t priorValue   = fPriorOrigValue[i];
+        Double_t currentValue = (fPriorOrigTrue[i]<0 ? 0. : unfolded[fPriorOrigTrue[i]]);
+        if (priorValue > 0.) *convergence += ((priorValue-currentValue)/priorValue)*((priorValue-currentValue)/priorValue);
+      }
+    }
+    else {
+      for (UInt_t i=0; i<priorOrder.size(); i++) {
+        Double_t priorValue   = prior[priorOrder[i]];
+        Double_t currentValue = unfolded[priorOrder[i]];
+        if (priorValue > 0.) *convergence += ((priorValue-currentValue)/priorValue)*((priorValue-currentValue)/priorValue);
+      }
+    }
+
+    // update the prior distribution
+    prior.assign(unfolded,unfolded+nTrue);
+    priorFilled.swap(filled);
+    priorOrder.swap(order);
+  }
+}
+
+//______________________________________________________________
+
+void AliCFUnfolding::UnfoldRandomizedRange(const AliCFUnfolding *unf, Int_t first, Int_t last, const std::vector<Double_t> *eff,
+                                           const std::vector<Double_t> *meas, std::vector<Double_t> *unfolded, std::vector<Double_t> *convergence) {
+  //
+  // unfolds the randomized distributions first..last-1 (worker of UnfoldRandomizedInThreads)
+  //
+
+  Int_t nTrue = unf->fUnfoldedValue.size();
+  Int_t nMeas = unf->fEstValue.size();
+  for (Int_t i=first; i<last; i++)
+    unf->UnfoldRandomizedIndexed(&(*eff)[i*nTrue],&(*meas)[i*nMeas],&(*unfolded)[i*nTrue],&(*convergence)[i]);
+}
+
+//______________________________________________________________
+
+Int_t AliCFUnfolding::UnfoldRandomizedInThreads() {
+  //
+  // Unfolds the first fNRandomIterations-1 randomized distributions in fNThreads threads
+  // and fills them in the delta profile; the last one is left to the serial loop of
+  // CalculateCorrelatedErrors(), which leaves the members as they were before.
+  // Returns the number of distributions done (0 if not possible, e.g. with smoothing).
+  //
+  // The randomized distributions are drawn in the same order as in the serial loop
+  // and filled in the profile in the same order, so the errors are identical.
+  // In the serial loop the content of the inverse response carries over from one
+  // distribution to the next; this only matters for bins where it becomes negative.
+  // The threads are therefore only used if the conditional matrix, the prior and
+  // the randomized efficiencies are not negative and the contents are floating point
+  // (otherwise all distributions are unfolded in the serial loop). Warnings about empty prior bins are not printed
+  // for the distributions unfolded in threads.
+  //
+
+  if (fNThreads<2 || !fIndexed || fUseSmoothing || fMaxNumIterations<1 || fNRandomIterations<2) return 0;
+  // integer contents could wrap around to negative values
+  if (fStoragePrior>kStorageF || fStorageInverse>kStorageF) return 0;
+  if (fUnfoldedValue.empty() || fEstValue.empty()) return 0;
+
+  for (UInt_t iBin=0; iBin<fCondValue.size(); iBin++) {
+    if (!(fCondValue[iBin]>=0.) || !(fInvValue[iBin]>=0.)) return 0;
+  }
+  for (UInt_t iBin=0; iBin<fPriorOrigValue.size(); iBin++) {
+    if (!(fPriorOrigValue[iBin]>=0.)) return 0;
+  }
+
+  Int_t nToys = fNRandomIterations-1;
+  Int_t nTrue = fUnfoldedValue.size();
+  Int_t nMeas = fEstValue.size();
+  std::vector<Double_t> eff(nToys*nTrue), meas(nToys*nMeas), unfolded(nToys*nTrue), convergence(nToys);
+
+  // keep the state of the generator, in case the serial loop has to draw them again
+  TRandom3 *random = (TRandom3*) fRandom3->Clone();
+  Bool_t independent = kTRUE;
+  for (Int_t i=0; i<nToys && independent; i++) {
+    CreateRandomizedDist();
+    for (Int_t iTrue=0; iTrue<nTrue; iTrue++) {
+      fTrueBins->GetBinContent(iTrue,fCoordinatesN_T);
+      eff[i*nTrue+iTrue] = fRandomEfficiency->GetBinContent(fCoordinatesN_T);
+      if (!(eff[i*nTrue+iTrue]>=0.)) independent = kFALSE;
+    }
+    for (Int_t iMeas=0; iMeas<nMeas; iMeas++) {
+      fMeasuredBins->GetBinContent(iMeas,fCoordinatesN_M);
+      meas[i*nMeas+iMeas] = fRandomMeasured->GetBinContent(fCoordinatesN_M);
+    }
+  }
+  if (!independent) {
+    AliInfo("Negative randomized efficiency, the randomized distributions are unfolded serially");
+    delete fRandom3;
+    fRandom3 = random;
+    return 0;
+  }
+  delete random;
+
+  Int_t nThreads = TMath::Min(fNThreads,nToys);
+  std::vector<std::thread> threads;
+  for (Int_t k=0; k<nThreads; k++)
+    threads.push_back(std::thread(UnfoldRandomizedRange,this,k*nToys/nThreads,(k+1)*nToys/nThreads,&eff,&meas,&unfolded,&convergence));
+  for (Int_t k=0; k<nThreads; k++) threads[k].join();
+
+  for (Int_t i=0; i<nToys; i++) {
+    FillDeltaUnfoldedProfile(&unfolded[i*nTrue]);
+    AliInfo(Form("=======================\nUnfolding of randomized distribution finished at iteration %d with convergence %e \n",fMaxNumIterations,convergence[i]));
+  }
+  return nToys;
+}
@@ -10,6 +10,7 @@
 // Author : renaud.vernet@cern.ch                                     //
 //--------------------------------------------------------------------//
 
+#include <vector>
 #include "TNamed.h"
 #include "THnSparse.h"
 #include "AliLog.h"
@@ -36,6 +37,8 @@ class AliCFUnfolding : public TNamed {
   }
 
   void SetNRandomIterations(Int_t n = 100) {fNRandomIterations = n;};
+  void SetNThreads(Int_t n = 1) {fNThreads = n;} // number of threads unfolding the randomized distributions
+  void UnsetIndexedIterations() {fIndexed = kFALSE;} // iterations on the THnSparse objects, serial (reference for comparisons)
 
   void UseSmoothing(TF1* fcn=0x0, Option_t* opt="iremn") { // if fcn=0x0 then smooth using neighbouring bins 
     fUseSmoothing=kTRUE;                                   // this function must NOT be used if fNVariables > 3
@@ -111,6 +114,31 @@ class AliCFUnfolding : public TNamed {
   THnSparse     *fDeltaUnfoldedN;    // Entries of the delta-unfolded distribution (count for each bin)
   Short_t        fNCalcCorrErrors;   // Book-keeping to prevend infinite loop
   UInt_t         fRandomSeed;        // Random seed
+  Int_t          fNThreads;          // Number of threads for the unfolding of the randomized distributions
+
+  /* indexed representation of the conditional matrix, built once in Init() */
+  Bool_t                fIndexed;           //! iterations run on the indexed representation
+  THnSparse            *fTrueBins;          //! true bins referenced by fConditional, bin index = position in the dense true vectors
+  THnSparse            *fMeasuredBins;      //! same for the measured bins
+  std::vector<Double_t> fCondValue;         //! content of each bin of fConditional
+  std::vector<Int_t>    fCondTrue;          //! position of its true bin
+  std::vector<Int_t>    fCondMeasured;      //! position of its measured bin
+  std::vector<Long64_t> fInvBin;            //! corresponding bin of fInverseResponse
+  std::vector<Long64_t> fInvOrder;          //! bins of fConditional in the order of the bins of fInverseResponse
+  std::vector<Double_t> fInvValue;          //! current content of fInverseResponse, per bin of fConditional
+  std::vector<Double_t> fPriorTimesEff;     //! prior x efficiency, per true bin
+  std::vector<Double_t> fEffValue;          //! efficiency, per true bin
+  std::vector<Double_t> fMeasValue;         //! measured, per measured bin
+  std::vector<Double_t> fEstValue;          //! measured estimate, per measured bin
+  std::vector<Double_t> fUnfoldedValue;     //! unfolded, per true bin
+  std::vector<Int_t>    fEstOrder;          //! measured bins in the order they are created in fMeasuredEstimate
+  std::vector<Int_t>    fUnfoldedOrder;     //! true bins in the order they are created in fUnfolded
+  std::vector<Char_t>   fFilled;            //! book-keeping for the two above
+  std::vector<Double_t> fPriorOrigValue;    //! content of each bin of fPriorOrig
+  std::vector<Int_t>    fPriorOrigTrue;     //! its position in the dense true vectors (-1 if not referenced by fConditional)
+  Int_t                 fStoragePrior;      //! content type of fPrior/fUnfolded
+  Int_t                 fStorageEstimate;   //! content type of fMeasuredEstimate
+  Int_t                 fStorageInverse;    //! content type of fInverseResponse
 
 
   // functions
@@ -129,10 +157,21 @@ class AliCFUnfolding : public TNamed {
   Double_t GetConvergence();            // Returns convergence criterion
   void     CalculateCorrelatedErrors(); // Calculates correlated errors for the final unfolded spectrum
   void     CreateRandomizedDist();      // Create randomized dist from measured distribution
-  void     FillDeltaUnfoldedProfile();  // Fills the fDeltaUnfoldedP profile
+  void     FillDeltaUnfoldedProfile(const Double_t *unfolded=0x0); // Fills the fDeltaUnfoldedP profile (from fUnfolded or from a dense unfolded vector)
   void     SetMaxConvergencePerDOF (Double_t val);
 
-  ClassDef(AliCFUnfolding,1);
+  /* indexed representation */
+  void     InitIndexed();               // builds the indexed representation of fConditional
+  void     LoadIndexedInputs();         // reads prior, efficiency and measured into the dense vectors
+  void     CreateEstMeasuredIndexed();  // CreateEstMeasured() on the indexed representation
+  void     CreateInvResponseIndexed();  // CreateInvResponse() on the indexed representation
+  void     CreateUnfoldedIndexed();     // CreateUnfolded() on the indexed representation
+  void     UnfoldRandomizedIndexed(const Double_t *eff, const Double_t *meas, Double_t *unfolded, Double_t *convergence) const; // Unfold() of one randomized distribution, thread safe
+  Int_t    UnfoldRandomizedInThreads(); // unfolds the randomized distributions in fNThreads threads, returns how many were done
+  static void UnfoldRandomizedRange(const AliCFUnfolding *unf, Int_t first, Int_t last, const std::vector<Double_t> *eff,
+                                    const std::vector<Double_t> *meas, std::vector<Double_t> *unfolded, std::vector<Double_t> *convergence);
+
+  ClassDef(AliCFUnfolding,2);
 };
 
 #endif
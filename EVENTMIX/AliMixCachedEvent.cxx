@@ -0,0 +1,104 @@
+//
+// Class AliMixCachedEvent
+//
+// Reduced event stored in AliMixEventCache. Tracks are kept
+// in SoA form (pt, eta, phi and charge arrays), together with
+// event variables and the entry of the event in the input chain
+//
+
+#include "AliMixCachedEvent.h"
+
+ClassImp(AliMixCachedEvent)
+
+//_________________________________________________________________________________________________
+AliMixCachedEvent::AliMixCachedEvent() : TObject(),
+   fEntry(-1),
+   fSerial(-1),
+   fNTracks(0),
+   fPt(),
+   fEta(),
+   fPhi(),
+   fCharge(),
+   fVariables()
+{
+   //
+   // Default constructor.
+   //
+}
+
+//_________________________________________________________________________________________________
+AliMixCachedEvent::AliMixCachedEvent(const AliMixCachedEvent &obj) : TObject(obj),
+   fEntry(obj.fEntry),
+   fSerial(obj.fSerial),
+   fNTracks(obj.fNTracks),
+   fPt(obj.fPt),
+   fEta(obj.fEta),
+   fPhi(obj.fPhi),
+   fCharge(obj.fCharge),
+   fVariables(obj.fVariables)
+{
+   //
+   // Copy constructor
+   //
+}
+
+//_________________________________________________________________________________________________
+AliMixCachedEvent &AliMixCachedEvent::operator=(const AliMixCachedEvent &obj)
+{
+   //
+   // Assigned operator
+   //
+   if (&obj != this) {
+      TObject::operator=(obj);
+      fEntry = obj.fEntry;
+      fSerial = obj.fSerial;
+      fNTracks = obj.fNTracks;
+      fPt = obj.fPt;
+      fEta = obj.fEta;
+      fPhi = obj.fPhi;
+      fCharge = obj.fCharge;
+      fVariables = obj.fVariables;
+   }
+   return *this;
+}
+
+//_________________________________________________________________________________________________
+void AliMixCachedEvent::Reset()
+{
+   //
+   // Removes all tracks (allocated arrays are kept for the next event)
+   //
+   fEntry = -1;
+   fSerial = -1;
+   fNTracks = 0;
+   fVariables.Reset();
+}
+
+//_________________________________________________________________________________________________
+void AliMixCachedEvent::AddTrack(Float_t pt, Float_t eta, Float_t phi, Char_t charge)
+{
+   //
+   // Adds track (arrays grow by factor 2 when full)
+   //
+   if (fNTracks >= fPt.GetSize()) {
+      Int_t size = (fNTracks > 0) ? 2 * fNTracks : 64;
+      fPt.Set(size);
+      fEta.Set(size);
+      fPhi.Set(size);
+      fCharge.Set(size);
+   }
+   fPt[fNTracks] = pt;
+   fEta[fNTracks] = eta;
+   fPhi[fNTracks] = phi;
+   fCharge[fNTracks] = charge;
+   fNTracks++;
+}
+
+//_________________________________________________________________________________________________
+Long64_t AliMixCachedEvent::GetMemorySize() const
+{
+   //
+   // Returns allocated memory in bytes
+   //
+   return sizeof(AliMixCachedEvent) + (Long64_t) fPt.GetSize() * (3 * sizeof(Float_t) + sizeof(Char_t)) + (Long64_t) fVariables.GetSize() * sizeof(Float_t);
+}
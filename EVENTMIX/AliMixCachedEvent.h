@@ -0,0 +1,60 @@
+//
+// Class AliMixCachedEvent
+//
+// Reduced event stored in AliMixEventCache. Tracks are kept
+// in SoA form (pt, eta, phi and charge arrays), together with
+// event variables and the entry of the event in the input chain
+//
+
+#ifndef ALIMIXCACHEDEVENT_H
+#define ALIMIXCACHEDEVENT_H
+
+#include <TObject.h>
+#include <TArrayF.h>
+#include <TArrayC.h>
+
+class AliMixCachedEvent : public TObject {
+public:
+   AliMixCachedEvent();
+   AliMixCachedEvent(const AliMixCachedEvent &obj);
+   AliMixCachedEvent &operator=(const AliMixCachedEvent &obj);
+   virtual ~AliMixCachedEvent() {}
+
+   void           Reset();
+   void           AddTrack(Float_t pt, Float_t eta, Float_t phi, Char_t charge);
+   void           SetNumberOfVariables(Int_t num) { fVariables.Set(num); fVariables.Reset(); }
+   void           SetVariable(Int_t index, Float_t val) { fVariables[index] = val; }
+   void           SetEntry(Long64_t entry) { fEntry = entry; }
+   void           SetSerial(Long64_t serial) { fSerial = serial; }
+
+   Int_t          GetNumberOfTracks() const { return fNTracks; }
+   Float_t        GetPt(Int_t i) const { return fPt.At(i); }
+   Float_t        GetEta(Int_t i) const { return fEta.At(i); }
+   Float_t        GetPhi(Int_t i) const { return fPhi.At(i); }
+   Char_t         GetCharge(Int_t i) const { return fCharge.At(i); }
+   const Float_t *GetPtArray() const { return fPt.GetArray(); }
+   const Float_t *GetEtaArray() const { return fEta.GetArray(); }
+   const Float_t *GetPhiArray() const { return fPhi.GetArray(); }
+   const Char_t  *GetChargeArray() const { return fCharge.GetArray(); }
+
+   Int_t          GetNumberOfVariables() const { return fVariables.GetSize(); }
+   Float_t        GetVariable(Int_t index) const { return fVariables.At(index); }
+   Long64_t       GetEntry() const { return fEntry; }
+   Long64_t       GetSerial() const { return fSerial; }
+
+   Long64_t       GetMemorySize() const;
+
+private:
+   Long64_t       fEntry;       // entry in input chain
+   Long64_t       fSerial;      // insertion number in event cache
+   Int_t          fNTracks;     // number of tracks
+   TArrayF        fPt;          // track pt
+   TArrayF        fEta;         // track eta
+   TArrayF        fPhi;         // track phi
+   TArrayC        fCharge;      // track charge
+   TArrayF        fVariables;   // event variables
+
+   ClassDef(AliMixCachedEvent, 1)
+};
+
+#endif
@@ -0,0 +1,243 @@
+//
+// Class AliMixEventCache
+//
+// AliMixEventCache keeps reduced events (AliMixCachedEvent) in memory,
+// in a ring buffer of fixed depth for every bin of AliMixEventPool.
+// Mixed events are then served without reading the input tree again.
+// Total memory is limited by SetMaxMemory (oldest events are removed).
+// Payload can be changed by overriding AcceptTrack and FillCachedEvent
+//
+
+#include <TMath.h>
+
+#include "AliLog.h"
+#include "AliVEvent.h"
+#include "AliVParticle.h"
+#include "AliAODTrack.h"
+#include "AliMixEventCutObj.h"
+#include "AliMixEventPool.h"
+#include "AliMixCachedEvent.h"
+
+#include "AliMixEventCache.h"
+
+ClassImp(AliMixEventCache)
+
+//_________________________________________________________________________________________________
+AliMixEventCache::AliMixEventCache(const char *name, const char *title) : TNamed(name, title),
+   fBins(),
+   fFirst(),
+   fNumEvents(),
+   fDepth(10),
+   fMaxMemory(0),
+   fTrackPtMin(0.0),
+   fTrackEtaMax(0.0),
+   fTrackFilterMask(0),
+   fMemorySize(0),
+   fNumAdded(0),
+   fNumEvicted(0)
+{
+   //
+   // Default constructor.
+   //
+   AliDebug(AliLog::kDebug + 5, "<-");
+   fBins.SetOwner(kTRUE);
+   AliDebug(AliLog::kDebug + 5, "->");
+}
+
+//_________________________________________________________________________________________________
+AliMixEventCache::~AliMixEventCache()
+{
+   //
+   // Destructor
+   //
+   AliDebug(AliLog::kDebug + 5, "<-");
+   fBins.Delete();
+   AliDebug(AliLog::kDebug + 5, "->");
+}
+
+//_________________________________________________________________________________________________
+void AliMixEventCache::Print(const Option_t *option) const
+{
+   //
+   // Prints usefull information
+   //
+   TNamed::Print(option);
+   AliInfo(Form("Depth %d MaxMemory %lld bytes", fDepth, fMaxMemory));
+   AliInfo(Form("Bins %d Added %lld Evicted %lld Memory %lld bytes", fBins.GetEntriesFast(), fNumAdded, fNumEvicted, fMemorySize));
+   for (Int_t i = 0; i < fBins.GetEntriesFast(); i++) {
+      AliDebug(AliLog::kDebug, Form("Bin[%d] %d", i, fNumEvents[i]));
+   }
+}
+
+//_________________________________________________________________________________________________
+void AliMixEventCache::Init(Int_t numBins)
+{
+   //
+   // Creates ring buffers for numBins bins
+   //
+   AliDebug(AliLog::kDebug + 5, "<-");
+   Clear();
+   for (Int_t i = 0; i < numBins; i++) fBins.Add(new TObjArray(fDepth));
+   fFirst.Set(numBins);
+   fFirst.Reset();
+   fNumEvents.Set(numBins);
+   fNumEvents.Reset();
+   AliDebug(AliLog::kDebug, Form("numBins=%d depth=%d", numBins, fDepth));
+   AliDebug(AliLog::kDebug + 5, "->");
+}
+
+//_________________________________________________________________________________________________
+void AliMixEventCache::Clear(Option_t *)
+{
+   //
+   // Removes all bins and cached events
+   //
+   TObjArray *bin = 0;
+   for (Int_t i = 0; i < fBins.GetEntriesFast(); i++) {
+      bin = (TObjArray *) fBins.UncheckedAt(i);
+      bin->Delete();
+   }
+   fBins.Delete();
+   fFirst.Set(0);
+   fNumEvents.Set(0);
+   fMemorySize = 0;
+}
+
+//_________________________________________________________________________________________________
+Bool_t AliMixEventCache::AcceptTrack(AliVParticle *track) const
+{
+   //
+   // Track selection for cached tracks
+   //
+   if (!track) return kFALSE;
+   if (track->Pt() < fTrackPtMin) return kFALSE;
+   if (fTrackEtaMax > 0 && TMath::Abs(track->Eta()) > fTrackEtaMax) return kFALSE;
+   if (fTrackFilterMask) {
+      AliAODTrack *aodTrack = dynamic_cast<AliAODTrack *>(track);
+      if (!aodTrack || !aodTrack->TestFilterBit(fTrackFilterMask)) return kFALSE;
+   }
+   return kTRUE;
+}
+
+//_________________________________________________________________________________________________
+void AliMixEventCache::FillCachedEvent(AliVEvent *ev, AliMixEventPool *evPool, AliMixCachedEvent *cachedEvent)
+{
+   //
+   // Fills reduced event: accepted tracks and values of event pool cuts
+   //
+   Int_t numVars = 0;
+   if (evPool) numVars = evPool->GetListOfEventCuts()->GetEntriesFast();
+   cachedEvent->SetNumberOfVariables(numVars);
+   AliMixEventCutObj *cut = 0;
+   for (Int_t i = 0; i < numVars; i++) {
+      cut = (AliMixEventCutObj *) evPool->GetListOfEventCuts()->UncheckedAt(i);
+      cachedEvent->SetVariable(i, cut->GetValue(ev));
+   }
+
+   AliVParticle *track = 0;
+   for (Int_t i = 0; i < ev->GetNumberOfTracks(); i++) {
+      track = ev->GetTrack(i);
+      if (!AcceptTrack(track)) continue;
+      cachedEvent->AddTrack(track->Pt(), track->Eta(), track->Phi(), track->Charge());
+   }
+}
+
+//_________________________________________________________________________________________________
+Bool_t AliMixEventCache::AddEvent(Int_t bin, Long64_t entry, AliVEvent *ev, AliMixEventPool *evPool)
+{
+   //
+   // Adds reduced event to bin (oldest event in bin is replaced when ring buffer is full)
+   //
+   AliDebug(AliLog::kDebug + 5, "<-");
+   if (!ev || bin < 0 || bin >= fBins.GetEntriesFast()) {
+      AliDebug(AliLog::kDebug, Form("Entry %lld was NOT added (bin=%d) !!!", entry, bin));
+      return kFALSE;
+   }
+
+   TObjArray *ring = (TObjArray *) fBins.UncheckedAt(bin);
+   Int_t slot = 0;
+   if (fNumEvents[bin] == fDepth) {
+      slot = fFirst[bin];
+      fFirst[bin] = (fFirst[bin] + 1) % fDepth;
+   } else {
+      slot = (fFirst[bin] + fNumEvents[bin]) % fDepth;
+      fNumEvents[bin]++;
+   }
+
+   // event objects are reused, so no allocation is needed in steady state
+   AliMixCachedEvent *cachedEvent = (AliMixCachedEvent *) ring->At(slot);
+   if (cachedEvent) {
+      fMemorySize -= cachedEvent->GetMemorySize();
+      cachedEvent->Reset();
+   } else {
+      cachedEvent = new AliMixCachedEvent();
+      ring->AddAt(cachedEvent, slot);
+   }
+   cachedEvent->SetEntry(entry);
+   cachedEvent->SetSerial(fNumAdded);
+   FillCachedEvent(ev, evPool, cachedEvent);
+   fMemorySize += cachedEvent->GetMemorySize();
+   fNumAdded++;
+
+   if (fMaxMemory > 0) {
+      while (fMemorySize > fMaxMemory) {
+         if (!RemoveOldestEvent(cachedEvent->GetSerial())) break;
+         fNumEvicted++;
+      }
+   }
+
+   AliDebug(AliLog::kDebug, Form("Entry %lld was added to bin %d (%d events, %lld bytes) !!!", entry, bin, fNumEvents[bin], fMemorySize));
+   AliDebug(AliLog::kDebug + 5, "->");
+   return kTRUE;
+}
+
+//_________________________________________________________________________________________________
+Bool_t AliMixEventCache::RemoveOldestEvent(Long64_t keepSerial)
+{
+   //
+   // Removes oldest event in all bins (except event with serial keepSerial) and frees its memory
+   //
+   Int_t oldestBin = -1;
+   Long64_t oldestSerial = -1;
+   AliMixCachedEvent *cachedEvent = 0;
+   for (Int_t i = 0; i < fBins.GetEntriesFast(); i++) {
+      if (fNumEvents[i] == 0) continue;
+      cachedEvent = (AliMixCachedEvent *)((TObjArray *) fBins.UncheckedAt(i))->At(fFirst[i]);
+      if (cachedEvent->GetSerial() == keepSerial) continue;
+      if (oldestBin < 0 || cachedEvent->GetSerial() < oldestSerial) {
+         oldestBin = i;
+         oldestSerial = cachedEvent->GetSerial();
+      }
+   }
+   if (oldestBin < 0) return kFALSE;
+
+   TObjArray *ring = (TObjArray *) fBins.UncheckedAt(oldestBin);
+   cachedEvent = (AliMixCachedEvent *) ring->RemoveAt(fFirst[oldestBin]);
+   fMemorySize -= cachedEvent->GetMemorySize();
+   delete cachedEvent;
+   fFirst[oldestBin] = (fFirst[oldestBin] + 1) % fDepth;
+   fNumEvents[oldestBin]--;
+   return kTRUE;
+}
+
+//_________________________________________________________________________________________________
+AliMixCachedEvent *AliMixEventCache::GetEvent(Int_t bin, Int_t index) const
+{
+   //
+   // Returns cached event in bin (index 0 is the newest event)
+   //
+   if (bin < 0 || bin >= fBins.GetEntriesFast()) return 0;
+   if (index < 0 || index >= fNumEvents[bin]) return 0;
+   Int_t slot = (fFirst[bin] + fNumEvents[bin] - 1 - index) % fDepth;
+   return (AliMixCachedEvent *)((TObjArray *) fBins.UncheckedAt(bin))->At(slot);
+}
+
+//_________________________________________________________________________________________________
+Int_t AliMixEventCache::GetNumberOfEvents(Int_t bin) const
+{
+   //
+   // Returns number of cached events in bin
+   //
+   if (bin < 0 || bin >= fBins.GetEntriesFast()) return 0;
+   return fNumEvents[bin];
+}
@@ -0,0 +1,76 @@
+//
+// Class AliMixEventCache
+//
+// AliMixEventCache keeps reduced events (AliMixCachedEvent) in memory,
+// in a ring buffer of fixed depth for every bin of AliMixEventPool.
+// Mixed events are then served without reading the input tree again.
+// Total memory is limited by SetMaxMemory (oldest events are removed).
+// Payload can be changed by overriding AcceptTrack and FillCachedEvent
+//
+
+#ifndef ALIMIXEVENTCACHE_H
+#define ALIMIXEVENTCACHE_H
+
+#include <TNamed.h>
+#include <TObjArray.h>
+#include <TArrayI.h>
+
+class AliVEvent;
+class AliVParticle;
+class AliMixEventPool;
+class AliMixCachedEvent;
+class AliMixEventCache : public TNamed {
+public:
+   AliMixEventCache(const char *name = "mixEventCache", const char *title = "Mix event cache");
+   virtual ~AliMixEventCache();
+
+   // prints object info
+   virtual void      Print(const Option_t *option = "") const;
+
+   // inits correctly object
+   void              Init(Int_t numBins);
+   void              Clear(Option_t *option = "");
+
+   virtual Bool_t    AcceptTrack(AliVParticle *track) const;
+   virtual void      FillCachedEvent(AliVEvent *ev, AliMixEventPool *evPool, AliMixCachedEvent *cachedEvent);
+
+   Bool_t            AddEvent(Int_t bin, Long64_t entry, AliVEvent *ev, AliMixEventPool *evPool);
+   AliMixCachedEvent *GetEvent(Int_t bin, Int_t index) const;
+   Int_t             GetNumberOfEvents(Int_t bin) const;
+
+   Bool_t            NeedInit() const { return (fBins.GetEntriesFast() == 0); }
+   Int_t             GetNumberOfBins() const { return fBins.GetEntriesFast(); }
+   Long64_t          GetMemorySize() const { return fMemorySize; }
+   Long64_t          GetNumberOfEvictedEvents() const { return fNumEvicted; }
+
+   void              SetDepth(Int_t depth) { fDepth = (depth > 0) ? depth : 1; }
+   void              SetMaxMemory(Long64_t bytes) { fMaxMemory = bytes; }
+   void              SetTrackCuts(Float_t ptMin, Float_t etaMax, UInt_t filterMask = 0) { fTrackPtMin = ptMin; fTrackEtaMax = etaMax; fTrackFilterMask = filterMask; }
+   Int_t             GetDepth() const { return fDepth; }
+   Long64_t          GetMaxMemory() const { return fMaxMemory; }
+
+private:
+
+   Bool_t            RemoveOldestEvent(Long64_t keepSerial);
+
+   TObjArray         fBins;            //! ring buffers of cached events (one array per bin)
+   TArrayI           fFirst;           //! index of oldest event in ring buffer
+   TArrayI           fNumEvents;       //! number of events in ring buffer
+
+   Int_t             fDepth;           // number of events kept per bin
+   Long64_t          fMaxMemory;       // memory limit in bytes (0 = no limit)
+   Float_t           fTrackPtMin;      // min pt of cached tracks
+   Float_t           fTrackEtaMax;     // max |eta| of cached tracks (0 = no cut)
+   UInt_t            fTrackFilterMask; // AOD filter bit mask of cached tracks (0 = no cut)
+
+   Long64_t          fMemorySize;      //! current memory of cached events in bytes
+   Long64_t          fNumAdded;        //! number of added events
+   Long64_t          fNumEvicted;      //! number of events removed because of memory limit
+
+   AliMixEventCache(const AliMixEventCache &obj);
+   AliMixEventCache &operator=(const AliMixEventCache &obj);
+
+   ClassDef(AliMixEventCache, 1)
+};
+
+#endif
@@ -11,12 +11,15 @@
 #include <TChain.h>
 #include <TChainElement.h>
 #include <TSystem.h>
+#include <TMath.h>
 
 #include "AliLog.h"
 #include "AliAnalysisManager.h"
 #include "AliInputEventHandler.h"
 
 #include "AliMixEventPool.h"
+#include "AliMixEventCache.h"
+#include "AliMixCachedEvent.h"
 #include "AliMixInputEventHandler.h"
 #include "AliMixInputHandlerInfo.h"
 
@@ -31,6 +34,7 @@ AliMixInputEventHandler::AliMixInputEventHandler(const Int_t size, const Int_t m
    fMixIntupHandlerInfoTmp(0),
    fEntryCounter(0),
    fEventPool(0),
+   fEventCache(0),
    fNumberMixed(0),
    fMixNumber(mixNum),
    fUseDefautProcess(kFALSE),
@@ -43,7 +47,8 @@ AliMixInputEventHandler::AliMixInputEventHandler(const Int_t size, const Int_t m
    fCurrentBinIndex(-1),
    fOfflineTriggerMask(0),
    fCurrentMixEntry(),
-   fCurrentEntryMainTree(0)
+   fCurrentEntryMainTree(0),
+   fCurrentCachedOffset(0)
 {
    //
    // Default constructor.
@@ -160,6 +165,9 @@ Bool_t AliMixInputEventHandler::Notify(const char *path)
    AliDebug(AliLog::kDebug + 5, Form("fEntryCounter=%lld", fEntryCounter));
    if (fEventPool && fEventPool->NeedInit())
       fEventPool->Init();
+   if (fEventCache && !CheckEventCacheDepth()) return kFALSE;
+   if (fEventCache && fEventPool && fEventCache->NeedInit())
+      fEventCache->Init(fEventPool->GetListOfEntryLists()->GetEntries());
    if (fUseDefautProcess) {
       AliDebug(AliLog::kDebug, Form("-> SKIPPED"));
       return AliMultiInputEventHandler::Notify(path);
@@ -195,6 +203,10 @@ Bool_t AliMixInputEventHandler::GetEntry()
    if (!fEventPool) {
       MixStd();
    }
+   // if event cache is set, mixed events are taken from memory
+   else if (fEventCache) {
+      MixCache();
+   }
    // if buffer size is higher then 1
    else if (fBufferSize > 1) {
       MixBuffer();
@@ -495,6 +507,113 @@ Bool_t AliMixInputEventHandler::MixEventsMoreTimesWithBuffer()
    return kFALSE;
 }
 
+//_____________________________________________________________________________
+void AliMixInputEventHandler::SetEventCache(AliMixEventCache *const evCache)
+{
+   //
+   // Sets event cache (depth is checked again in Notify, it can be changed after this call)
+   //
+   fEventCache = evCache;
+   if (fEventCache) CheckEventCacheDepth();
+}
+
+//_____________________________________________________________________________
+Bool_t AliMixInputEventHandler::CheckEventCacheDepth() const
+{
+   //
+   // Checks that the event cache keeps enough events per bin to mix,
+   // otherwise MixCache would skip every event (not enough events to mix)
+   //
+   Int_t numNeeded = (fBufferSize > 1) ? fBufferSize : (fDoMixIfNotEnoughEvents ? 1 : fMixNumber);
+   if (fEventCache->GetDepth() < numNeeded) {
+      AliError(Form("Event cache depth (%d) is smaller than the number of events needed to mix (%d, buffer size %d, mix number %d): increase it with AliMixEventCache::SetDepth", fEventCache->GetDepth(), numNeeded, fBufferSize, fMixNumber));
+      return kFALSE;
+   }
+   return kTRUE;
+}
+
+//_____________________________________________________________________________
+Bool_t AliMixInputEventHandler::MixCache()
+{
+   //
+   // Mix with reduced events from event cache (input tree is not read for mixed events)
+   // with buffer size > 1, UserExecMix is called once with fBufferSize events,
+   // otherwise it is called fMixNumber times with one event
+   //
+   AliDebug(AliLog::kDebug + 5, "<-");
+   AliDebug(AliLog::kDebug + 1, "Mix method");
+   // get correct handler
+   AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+   AliMultiInputEventHandler *mh = dynamic_cast<AliMultiInputEventHandler *>(mgr->GetInputEventHandler());
+   AliInputEventHandler *inEvHMain = 0;
+   if (mh) inEvHMain = dynamic_cast<AliInputEventHandler *>(mh->GetFirstInputEventHandler());
+   else inEvHMain = dynamic_cast<AliInputEventHandler *>(mgr->GetInputEventHandler());
+   if (!inEvHMain) return kFALSE;
+
+   // check for PhysSelection
+   if (!IsEventCurrentSelected()) return kFALSE;
+
+   fCurrentMixEntry.Reset();
+   fCurrentCachedOffset = 0;
+
+   // find out zero chain entries
+   Long64_t zeroChainEntries = fMixIntupHandlerInfoTmp->GetChain()->GetEntries() - inEvHMain->GetTree()->GetTree()->GetEntries();
+   Long64_t currentMainEntry = inEvHMain->GetTree()->GetTree()->GetReadEntry() + zeroChainEntries;
+   // start of
+   AliDebug(AliLog::kDebug + 3, Form("++++++++++++++ BEGIN SETUP EVENT %lld +++++++++++++++++++", fEntryCounter));
+   // reset mix number
+   fNumberMixed = 0;
+   Int_t idEntryList = -1;
+   TEntryList *el = fEventPool->FindEntryList(inEvHMain->GetEvent(), idEntryList);
+   if (!el) {
+      AliDebug(AliLog::kDebug + 3, Form("++++++++++++++ END SETUP EVENT %lld SKIPPED (el null, idEntryList=%d) +++++++++++++++++++", fEntryCounter, idEntryList));
+      UserExecMixAllTasks(fEntryCounter, -1, currentMainEntry, -1, 0);
+      return kTRUE;
+   }
+   // entry lists start with index 1
+   Int_t bin = idEntryList - 1;
+   Int_t numCached = fEventCache->GetNumberOfEvents(bin);
+   Int_t numNeeded = (fBufferSize > 1) ? fBufferSize : fMixNumber;
+   AliMixCachedEvent *cachedEvent = 0;
+
+   if (numCached < 1) {
+      // dont include it in main event counter if not mixing with less events (idEntryList = -1)
+      if (!fDoMixIfNotEnoughEvents) idEntryList = -1;
+      UserExecMixAllTasks(fEntryCounter, idEntryList, currentMainEntry, -1, 0);
+      AliDebug(AliLog::kDebug + 3, Form("++++++++++++++ END SETUP EVENT %lld SKIPPED [FIRST ENTRY in bin] (idEntryList=%d) +++++++++++++++++++", fEntryCounter, idEntryList));
+   } else if (numCached < numNeeded && (fBufferSize > 1 || !fDoMixIfNotEnoughEvents)) {
+      UserExecMixAllTasks(fEntryCounter, idEntryList, currentMainEntry, -1, 0);
+      AliDebug(AliLog::kDebug + 3, Form("++++++++++++++ END SETUP EVENT %lld SKIPPED (%d) NOT ENOUGH EVENTS TO MIX => NEED=%d +++++++++++++++++++", fEntryCounter, numCached, numNeeded));
+   } else if (fBufferSize > 1) {
+      for (Int_t counter = 0; counter < fBufferSize; counter++) {
+         cachedEvent = fEventCache->GetEvent(bin, counter);
+         fCurrentMixEntry.Enter(cachedEvent->GetEntry());
+         fNumberMixed++;
+      }
+      // runs UserExecMix for all tasks
+      UserExecMixAllTasks(fEntryCounter, idEntryList, currentMainEntry, cachedEvent->GetEntry(), fNumberMixed);
+   } else {
+      Int_t mixNum = TMath::Min(fMixNumber, numCached);
+      for (Int_t counter = 0; counter < mixNum; counter++) {
+         cachedEvent = fEventCache->GetEvent(bin, counter);
+         fCurrentMixEntry.Reset();
+         fCurrentMixEntry.Enter(cachedEvent->GetEntry());
+         fCurrentCachedOffset = counter;
+         // runs UserExecMix for all tasks
+         fNumberMixed++;
+         UserExecMixAllTasks(fEntryCounter, idEntryList, currentMainEntry, cachedEvent->GetEntry(), fNumberMixed);
+      }
+   }
+
+   // current event is added after mixing, so it is not mixed with itself
+   fEventCache->AddEvent(bin, currentMainEntry, inEvHMain->GetEvent(), fEventPool);
+
+   AliDebug(AliLog::kDebug + 3, Form("fEntryCounter=%lld fMixEventNumber=%d", fEntryCounter, fNumberMixed));
+   AliDebug(AliLog::kDebug + 3, Form("++++++++++++++ END SETUP EVENT %lld +++++++++++++++++++", fEntryCounter));
+   AliDebug(AliLog::kDebug + 5, Form("->"));
+   return kTRUE;
+}
+
 //_____________________________________________________________________________
 Bool_t AliMixInputEventHandler::FinishEvent()
 {
@@ -625,3 +744,18 @@ Bool_t AliMixInputEventHandler::GetEntryMixedEvent(Int_t id) {
 
    return kTRUE;
 }
+
+//_____________________________________________________________________________
+AliMixCachedEvent *AliMixInputEventHandler::GetCachedMixedEvent(Int_t id) const
+{
+   //
+   // Returns reduced mixed event with id from event cache
+   // (Should be used in UserExecMix() only)
+   //
+
+   if (!fEventCache) {
+      AliError("GetCachedMixedEvent() => event cache is not set");
+      return 0;
+   }
+   return fEventCache->GetEvent(fCurrentBinIndex - 1, fCurrentCachedOffset + id);
+}
@@ -21,6 +21,8 @@
 class TChain;
 class TChainElement;
 class AliMixEventPool;
+class AliMixEventCache;
+class AliMixCachedEvent;
 class AliMixInputHandlerInfo;
 class AliInputEventHandler;
 class AliMixInputEventHandler : public AliMultiInputEventHandler {
@@ -42,8 +44,10 @@ public:
 
    void                    SetInputHandlerForMixing(const AliInputEventHandler *const inHandler);
    void                    SetEventPool(AliMixEventPool *const evPool) { fEventPool = evPool; }
+   void                    SetEventCache(AliMixEventCache *const evCache);
 
    AliMixEventPool        *GetEventPool() const { return fEventPool; }
+   AliMixEventCache       *GetEventCache() const { return fEventCache; }
    Int_t                   BufferSize() const { return fBufferSize; }
    Int_t                   NumberMixedTimes() const { return fNumberMixed; }
    Int_t                   MixNumber() const { return fMixNumber; }
@@ -73,6 +77,7 @@ public:
 
    Bool_t                  GetEntryMainEvent();
    Bool_t                  GetEntryMixedEvent(Int_t idHandler=0);
+   AliMixCachedEvent      *GetCachedMixedEvent(Int_t id=0) const;
 protected:
 
    TObjArray               fMixTrees;              // buffer of input handlers
@@ -80,6 +85,7 @@ protected:
    AliMixInputHandlerInfo *fMixIntupHandlerInfoTmp;//! mix input handler info full chain
    Long64_t                fEntryCounter;          // entry counter
    AliMixEventPool        *fEventPool;             // event pool
+   AliMixEventCache       *fEventCache;            // event cache (mixed events are not read from tree when set)
    Int_t                   fNumberMixed;           // number of mixed events with current event
    Int_t                   fMixNumber;             // user's mix number request
 
@@ -99,18 +105,21 @@ private:
 
    TEntryList fCurrentMixEntry;    //! array of mix entries currently used (user should touch)
    Long64_t fCurrentEntryMainTree; //! current entry in current tree (main event)
+   Int_t    fCurrentCachedOffset;  //! index of first currently used event in event cache bin
 
    virtual Bool_t          MixStd();
    virtual Bool_t          MixBuffer();
    virtual Bool_t          MixEventsMoreTimesWithOneEvent();
    virtual Bool_t          MixEventsMoreTimesWithBuffer();
+   virtual Bool_t          MixCache();
+   Bool_t                  CheckEventCacheDepth() const;
 
    void                    UserExecMixAllTasks(Long64_t entryCounter, Int_t idEntryList, Long64_t entryMainReal, Long64_t entryMixReal, Int_t numMixed);
 
    AliMixInputEventHandler(const AliMixInputEventHandler &handler);
    AliMixInputEventHandler &operator=(const AliMixInputEventHandler &handler);
 
-   ClassDef(AliMixInputEventHandler, 5)
+   ClassDef(AliMixInputEventHandler, 6)
 };
 
 #endif
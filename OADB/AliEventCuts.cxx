@@ -118,6 +118,76 @@ AliEventCuts::~AliEventCuts() {
   delete fFB32trackCuts;
 }
 
+namespace {
+  /// Results of a selection computed by one AliEventCuts instance and reused by the identically
+  /// configured instances of the other wagons for the same event
+  struct AliEventCutsSelection {
+    string                fConfig;             ///< Configuration key of the instances sharing the result
+    unsigned long         fFlag;               ///< Passed cuts, except kPileUp and kAllCuts
+    float                 fCentPercentiles[2]; ///< Centrality percentiles
+    AliVVertex           *fPrimaryVertex;      ///< Selected primary vertex
+    double                fDeltaZ;             ///< Difference between the track and SPD vertices
+    AliEventCutsContainer fContainer;          ///< Track multiplicities used by the correlation cuts
+  };
+
+  /// Result of AliVEvent::IsPileupFromSPD for a given set of parameters
+  struct AliEventCutsSPDpileUp {
+    int    fMinContrib;
+    double fMinZdist;
+    double fNsigmaZdist;
+    double fNsigmaDiamXY;
+    double fNsigmaDiamZ;
+    bool   fPileUp;
+  };
+
+  /// Quantities shared by all the AliEventCuts instances for the current event
+  struct AliEventCutsShared {
+    Long64_t                        fEntry;         ///< Analysis manager entry
+    const AliVEvent                *fEvent;         ///< Event pointer
+    unsigned long                   fEventId;       ///< Bunch crossing and time stamp
+    int                             fRun;           ///< Run number
+    int                             fGoodAODvertex; ///< Result of GoodPrimaryAODVertex, -1 if not computed yet
+    vector<AliEventCutsSPDpileUp>   fSPDpileUp;     ///< SPD pile-up flags for the parameters used so far
+    vector<AliEventCutsSelection>   fSelections;    ///< Selections computed so far
+  } gShared = {-1, nullptr, 0ul, -1, -1, {}, {}};
+
+  /// Returns the shared results, emptied as soon as a new event is processed
+  AliEventCutsShared& SharedResults(AliVEvent *ev) {
+    const Long64_t entry = AliAnalysisManager::GetAnalysisManager()->GetCurrentEntry();
+    const unsigned long evid = ((unsigned long)(ev->GetBunchCrossNumber()) << 32) + ev->GetTimeStamp();
+    const int run = ev->GetRunNumber();
+    if (entry != gShared.fEntry || ev != gShared.fEvent || evid != gShared.fEventId || run != gShared.fRun) {
+      gShared.fEntry = entry;
+      gShared.fEvent = ev;
+      gShared.fEventId = evid;
+      gShared.fRun = run;
+      gShared.fGoodAODvertex = -1;
+      gShared.fSPDpileUp.clear();
+      gShared.fSelections.clear();
+    }
+    return gShared;
+  }
+
+  /// GoodPrimaryAODVertex depends only on the event
+  bool SharedGoodPrimaryAODVertex(AliVEvent *ev) {
+    if (gShared.fGoodAODvertex < 0) gShared.fGoodAODvertex = AliEventCuts::GoodPrimaryAODVertex(ev);
+    return gShared.fGoodAODvertex;
+  }
+
+  template<typename T> void AppendToKey(string &key, const T &val) {
+    key.append(reinterpret_cast<const char*>(&val), sizeof(T));
+  }
+
+  template<typename T, size_t N> void AppendToKey(string &key, const T (&val)[N]) {
+    key.append(reinterpret_cast<const char*>(val), N * sizeof(T));
+  }
+
+  void AppendToKey(string &key, const string &val) {
+    AppendToKey(key, val.size());
+    key.append(val);
+  }
+}
+
 bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
   if (fGreenLight) return true; /// Bypass all the selections
 
@@ -133,6 +203,127 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
     AddQAplotsToList();
   }
 
+  /// The multiplicity dependent pile-up cuts are set before comparing the configuration with the other instances
+  AliVMultiplicity* mult = ev->GetMultiplicity();
+  const int ntrkl = mult->GetNumberOfTracklets();
+  if (fUseMultiplicityDependentPileUpCuts) {
+    if (ntrkl < 20) fSPDpileupMinContributors = 3;
+    else if (ntrkl < 50) fSPDpileupMinContributors = 4;
+    else fSPDpileupMinContributors = 5;
+  }
+
+  /// Identically configured instances (e.g. in different wagons of a train) compute the selection once per event
+  AliEventCutsShared& shared = SharedResults(ev);
+  const string config = GetConfigurationKey();
+  const AliEventCutsSelection* selection = nullptr;
+  for (const auto& sel : shared.fSelections) {
+    if (sel.fConfig == config) {
+      selection = &sel;
+      break;
+    }
+  }
+  double dz = 0.;
+  if (selection) {
+    fFlag = selection->fFlag;
+    fPrimaryVertex = selection->fPrimaryVertex;
+    dz = selection->fDeltaZ;
+    if (fCentralityFramework) {
+      fCentPercentiles[0] = selection->fCentPercentiles[0];
+      fCentPercentiles[1] = selection->fCentPercentiles[1];
+    }
+    if (fUseVariablesCorrelationCuts && !fMC) fContainer = selection->fContainer;
+  } else {
+    dz = ComputeSelection(ev, ntrkl);
+    shared.fSelections.emplace_back();
+    AliEventCutsSelection& sel = shared.fSelections.back();
+    sel.fConfig = config;
+    sel.fFlag = fFlag;
+    sel.fCentPercentiles[0] = fCentPercentiles[0];
+    sel.fCentPercentiles[1] = fCentPercentiles[1];
+    sel.fPrimaryVertex = fPrimaryVertex;
+    sel.fDeltaZ = dz;
+    sel.fContainer = fContainer;
+  }
+
+  /// Pile-up rejection: the SPD pile-up flag is shared by all the instances using the same parameters,
+  /// the AliAnalysisUtils checks depend on the configuration of fUtils and are done by each instance.
+  bool spdPileUp = false, spdPileUpFound = false;
+  for (const auto& pu : shared.fSPDpileUp) {
+    if (pu.fMinContrib == fSPDpileupMinContributors && pu.fMinZdist == fSPDpileupMinZdist && pu.fNsigmaZdist == fSPDpileupNsigmaZdist &&
+        pu.fNsigmaDiamXY == fSPDpileupNsigmaDiamXY && pu.fNsigmaDiamZ == fSPDpileupNsigmaDiamZ) {
+      spdPileUp = pu.fPileUp;
+      spdPileUpFound = true;
+      break;
+    }
+  }
+  if (!spdPileUpFound) {
+    spdPileUp = ev->IsPileupFromSPD(fSPDpileupMinContributors,fSPDpileupMinZdist,fSPDpileupNsigmaZdist,fSPDpileupNsigmaDiamXY,fSPDpileupNsigmaDiamZ);
+    shared.fSPDpileUp.push_back({fSPDpileupMinContributors,fSPDpileupMinZdist,fSPDpileupNsigmaZdist,fSPDpileupNsigmaDiamXY,fSPDpileupNsigmaDiamZ,spdPileUp});
+  }
+  if (!spdPileUp &&
+      (!fTrackletBGcut || !fUtils.IsSPDClusterVsTrackletBG(ev)) &&
+      (!fPileUpCutMV || !fUtils.IsPileUpMV(ev)))
+    fFlag |= BIT(kPileUp);
+
+  const AliVVertex* vtx = fPrimaryVertex;
+
+  /// Ignore SPD/tracks vertex position and reconstruction individual flags
+  bool allcuts = CheckNormalisationMask(kPassesAllCuts);
+  if (allcuts) {
+    fFlag |= BIT(kAllCuts);
+  }
+  if (fCutStats) {
+    for (int iCut = kNoCuts; iCut <= kAllCuts; ++iCut) {
+      if (TESTBIT(fFlag,iCut)) {
+        fCutStats->Fill(iCut);
+        if (TESTBIT(fFlag,kTrigger)) {
+          fCutStatsAfterTrigger->Fill(iCut);
+        }
+        if (TESTBIT(fFlag,kMultiplicity)) {
+          fCutStatsAfterMultSelection->Fill(iCut);
+        }
+      }
+    }
+  }
+
+  /// Filling normalisation histogram
+  array <NormMask,4> norm_masks {
+    kAnyEvent,
+    kPassesNonVertexRelatedSelections,
+    kHasReconstructedVertex,
+    kPassesAllCuts
+  };
+  for (int iC = 0; iC < 4; ++iC) {
+    if (CheckNormalisationMask(norm_masks[iC])) {
+      if (fNormalisationHist) {
+        fNormalisationHist->Fill(iC);
+      }
+    }
+  }
+
+  /// Filling the monitoring histograms (first iteration always filled, second iteration only for selected events.
+  for (int befaft = 0; befaft < 2; ++befaft) {
+    if (fCentrality[befaft]) fCentrality[befaft]->Fill(fCentPercentiles[0]);
+    if (fEstimCorrelation[befaft]) fEstimCorrelation[befaft]->Fill(fCentPercentiles[1],fCentPercentiles[0]);
+    if (fMultCentCorrelation[befaft]) fMultCentCorrelation[befaft]->Fill(fCentPercentiles[0],ntrkl);
+    if (fVtz[befaft]) fVtz[befaft]->Fill(vtx->GetZ());
+    if (fDeltaTrackSPDvtz[befaft]) fDeltaTrackSPDvtz[befaft]->Fill(dz);
+    if (fUseVariablesCorrelationCuts) {
+      if (fTOFvsFB32[befaft]) fTOFvsFB32[befaft]->Fill(fContainer.fMultTrkFB32,fContainer.fMultTrkFB32TOF);
+      if (fTPCvsAll[befaft])  fTPCvsAll[befaft]->Fill(fContainer.fMultTrkTPC,float(fContainer.fMultESD) - fESDvsTPConlyLinearCut[1] * fContainer.fMultTrkTPC);
+      if (fMultvsV0M[befaft]) fMultvsV0M[befaft]->Fill(GetCentrality(),fContainer.fMultTrkFB32Acc);
+      if (fTPCvsTrkl[befaft]) fTPCvsTrkl[befaft]->Fill(ntrkl,fContainer.fMultTrkTPC);
+      if (fVZEROvsTPCout[befaft]) fVZEROvsTPCout[befaft]->Fill(fContainer.fMultTrkTPCout,fContainer.fMultVZERO);
+    }
+    if (!allcuts) return false; /// Do not fill the "after" histograms if the event does not pass the cuts.
+  }
+
+  return true;
+}
+
+/// Evaluates all the cuts but the pile-up ones, returns the difference between the track and SPD vertex z
+///
+double AliEventCuts::ComputeSelection(AliVEvent *ev, int ntrkl) {
   /// Event selection flag, as soon as the event does not pass one cut this becomes false.
   fFlag = BIT(kNoCuts);
 
@@ -155,7 +346,7 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
   const AliVVertex* vtSPD = ev->GetPrimaryVertexSPD();
   /// On current AODs primary vertex could be from TPC or invalid SPD vertex
   /// The following check should be applied only on AOD.
-  bool goodAODvtx = (dynamic_cast<AliAODEvent*>(ev) ? GoodPrimaryAODVertex(ev) : true) || !fCheckAODvertex;
+  bool goodAODvtx = (dynamic_cast<AliAODEvent*>(ev) ? SharedGoodPrimaryAODVertex(ev) : true) || !fCheckAODvertex;
 
   if (vtSPD->GetNContributors() > 0) fFlag |= BIT(kVertexSPD);
   if (vtTrc->GetNContributors() > 1 && goodAODvtx) fFlag |= BIT(kVertexTracks);
@@ -182,19 +373,6 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
      ) // quality cut on vertexer SPD z
     fFlag |= BIT(kVertexQuality);
 
-  /// Pile-up rejection
-  AliVMultiplicity* mult = ev->GetMultiplicity();
-  const int ntrkl = mult->GetNumberOfTracklets();
-  if (fUseMultiplicityDependentPileUpCuts) {
-    if (ntrkl < 20) fSPDpileupMinContributors = 3;
-    else if (ntrkl < 50) fSPDpileupMinContributors = 4;
-    else fSPDpileupMinContributors = 5;
-  }
-  if (!ev->IsPileupFromSPD(fSPDpileupMinContributors,fSPDpileupMinZdist,fSPDpileupNsigmaZdist,fSPDpileupNsigmaDiamXY,fSPDpileupNsigmaDiamZ) &&
-      (!fTrackletBGcut || !fUtils.IsSPDClusterVsTrackletBG(ev)) &&
-      (!fPileUpCutMV || !fUtils.IsPileUpMV(ev)))
-    fFlag |= BIT(kPileUp);
-
   /// Centrality cuts:
   /// * Check for min and max centrality
   /// * Cross check correlation between two centrality estimators
@@ -247,58 +425,57 @@ bool AliEventCuts::AcceptEvent(AliVEvent *ev) {
       fFlag |= BIT(kCorrelations);
   } else fFlag |= BIT(kCorrelations);
 
-  /// Ignore SPD/tracks vertex position and reconstruction individual flags
-  bool allcuts = CheckNormalisationMask(kPassesAllCuts);
-  if (allcuts) {
-    fFlag |= BIT(kAllCuts);
-  }
-  if (fCutStats) {
-    for (int iCut = kNoCuts; iCut <= kAllCuts; ++iCut) {
-      if (TESTBIT(fFlag,iCut)) {
-        fCutStats->Fill(iCut);
-        if (TESTBIT(fFlag,kTrigger)) {
-          fCutStatsAfterTrigger->Fill(iCut);
-        }
-        if (TESTBIT(fFlag,kMultiplicity)) {
-          fCutStatsAfterMultSelection->Fill(iCut);
-        }
-      }
-    }
-  }
-
-  /// Filling normalisation histogram
-  array <NormMask,4> norm_masks {
-    kAnyEvent,
-    kPassesNonVertexRelatedSelections,
-    kHasReconstructedVertex,
-    kPassesAllCuts
-  };
-  for (int iC = 0; iC < 4; ++iC) {
-    if (CheckNormalisationMask(norm_masks[iC])) {
-      if (fNormalisationHist) {
-        fNormalisationHist->Fill(iC);
-      }
-    }
-  }
-
-  /// Filling the monitoring histograms (first iteration always filled, second iteration only for selected events.
-  for (int befaft = 0; befaft < 2; ++befaft) {
-    if (fCentrality[befaft]) fCentrality[befaft]->Fill(fCentPercentiles[0]);
-    if (fEstimCorrelation[befaft]) fEstimCorrelation[befaft]->Fill(fCentPercentiles[1],fCentPercentiles[0]);
-    if (fMultCentCorrelation[befaft]) fMultCentCorrelation[befaft]->Fill(fCentPercentiles[0],ntrkl);
-    if (fVtz[befaft]) fVtz[befaft]->Fill(vtx->GetZ());
-    if (fDeltaTrackSPDvtz[befaft]) fDeltaTrackSPDvtz[befaft]->Fill(dz);
-    if (fUseVariablesCorrelationCuts) {
-      if (fTOFvsFB32[befaft]) fTOFvsFB32[befaft]->Fill(fContainer.fMultTrkFB32,fContainer.fMultTrkFB32TOF);
-      if (fTPCvsAll[befaft])  fTPCvsAll[befaft]->Fill(fContainer.fMultTrkTPC,float(fContainer.fMultESD) - fESDvsTPConlyLinearCut[1] * fContainer.fMultTrkTPC);
-      if (fMultvsV0M[befaft]) fMultvsV0M[befaft]->Fill(GetCentrality(),fContainer.fMultTrkFB32Acc);
-      if (fTPCvsTrkl[befaft]) fTPCvsTrkl[befaft]->Fill(ntrkl,fContainer.fMultTrkTPC);
-      if (fVZEROvsTPCout[befaft]) fVZEROvsTPCout[befaft]->Fill(fContainer.fMultTrkTPCout,fContainer.fMultVZERO);
-    }
-    if (!allcuts) return false; /// Do not fill the "after" histograms if the event does not pass the cuts.
-  }
+  return dz;
+}
 
-  return true;
+/// Configuration of the cuts, identical for the instances selecting exactly the same events.
+/// The AliAnalysisUtils based pile-up cuts are not included, they are always evaluated by each instance.
+///
+string AliEventCuts::GetConfigurationKey() const {
+  string key;
+  AppendToKey(key, fMC);
+  AppendToKey(key, fRequireTrackVertex);
+  AppendToKey(key, fMinVtz);
+  AppendToKey(key, fMaxVtz);
+  AppendToKey(key, fMaxDeltaSpdTrackAbsolute);
+  AppendToKey(key, fMaxDeltaSpdTrackNsigmaSPD);
+  AppendToKey(key, fMaxDeltaSpdTrackNsigmaTrack);
+  AppendToKey(key, fMaxResolutionSPDvertex);
+  AppendToKey(key, fCheckAODvertex);
+  AppendToKey(key, fRejectDAQincomplete);
+  AppendToKey(key, fRequiredSolenoidPolarity);
+  AppendToKey(key, fCentralityFramework);
+  AppendToKey(key, fMinCentrality);
+  AppendToKey(key, fMaxCentrality);
+  AppendToKey(key, fSelectInelGt0);
+  AppendToKey(key, fUseVariablesCorrelationCuts);
+  AppendToKey(key, fUseEstimatorsCorrelationCut);
+  AppendToKey(key, fUseStrongVarCorrelationCut);
+  AppendToKey(key, fEstimatorsCorrelationCoef);
+  AppendToKey(key, fEstimatorsSigmaPars);
+  AppendToKey(key, fDeltaEstimatorNsigma);
+  AppendToKey(key, fTOFvsFB32correlationPars);
+  AppendToKey(key, fTOFvsFB32sigmaPars);
+  AppendToKey(key, fTOFvsFB32nSigmaCut);
+  AppendToKey(key, fESDvsTPConlyLinearCut);
+  AppendToKey(key, fFB128vsTrklLinearCut);
+  AppendToKey(key, fVZEROvsTPCoutPolCut);
+  AppendToKey(key, fRequireExactTriggerMask);
+  AppendToKey(key, fTriggerMask);
+  AppendToKey(key, fCentEstimators[0]);
+  AppendToKey(key, fCentEstimators[1]);
+  AppendToKey(key, fMultSelectionEvCuts);
+  /// Different TF1 objects with the same formula and parameters give the same cut
+  const bool hasV0McorrCut = fMultiplicityV0McorrCut;
+  AppendToKey(key, hasV0McorrCut);
+  if (hasV0McorrCut) {
+    AppendToKey(key, string(fMultiplicityV0McorrCut->GetExpFormula().Data()));
+    const int npar = fMultiplicityV0McorrCut->GetNpar();
+    AppendToKey(key, npar);
+    for (int iPar = 0; iPar < npar; ++iPar)
+      AppendToKey(key, fMultiplicityV0McorrCut->GetParameter(iPar));
+  }
+  return key;
 }
 
 void AliEventCuts::AddQAplotsToList(TList *qaList, bool addCorrelationPlots) {
@@ -0,0 +1,189 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//-------------------------------------------------------------------------
+//  Per-event table of the ITS, TPC and TOF n sigma of all tracks
+//
+//  In a train every wagon asks the PID response for the n sigma of the
+//  same tracks. AliPIDnSigmaCacheTask fills this table once per event,
+//  the PID helpers which are switched to it read from the table:
+//
+//    Float_t n = AliPIDnSigmaCache::NumberOfSigmas(pidResponse, AliPIDResponse::kTPC, track, AliPID::kPion);
+//
+//  gives the same value as pidResponse->NumberOfSigmas(AliPIDResponse::kTPC, track, AliPID::kPion)
+//  (or NumberOfSigmasTPC(track, AliPID::kPion)). The PID response is asked
+//  directly if there is no table for the current event, if the table was
+//  filled with another PID response, or if the track, detector or species
+//  is not in the table (e.g. a copy of a track, or a track outside the
+//  filter mask).
+//-------------------------------------------------------------------------
+
+#include "AliPIDnSigmaCache.h"
+#include "AliAnalysisManager.h"
+#include "AliAODTrack.h"
+#include "AliVEvent.h"
+#include "AliVTrack.h"
+
+ClassImp(AliPIDnSigmaCache)
+
+AliPIDnSigmaCache *AliPIDnSigmaCache::fgCurrent = 0;
+
+//_____________________________________________________________________________
+AliPIDnSigmaCache::AliPIDnSigmaCache(Int_t nSpecies, UInt_t filterMask) :
+  TObject(),
+  fNSpecies(nSpecies),
+  fFilterMask(filterMask),
+  fPIDResponse(0),
+  fEntry(-1),
+  fTracks(),
+  fRowOfID(),
+  fRowOfNegativeID()
+{
+  //
+  // Constructor
+  //
+}
+
+//_____________________________________________________________________________
+AliPIDnSigmaCache::~AliPIDnSigmaCache()
+{
+  //
+  // Destructor
+  //
+  if (fgCurrent == this) fgCurrent = 0;
+}
+
+//_____________________________________________________________________________
+void AliPIDnSigmaCache::Reset()
+{
+  //
+  // Empties the table
+  //
+  fPIDResponse = 0;
+  fEntry = -1;
+  fTracks.clear();
+  fRowOfID.clear();
+  fRowOfNegativeID.clear();
+  for (Int_t iDet = 0; iDet < kNDetectors; iDet++) fNSigma[iDet].clear();
+}
+
+//_____________________________________________________________________________
+void AliPIDnSigmaCache::Fill(const AliVEvent *event, const AliPIDResponse *pidResponse)
+{
+  //
+  // Fills the table with the n sigma of all tracks of the event
+  //
+  static const AliPIDResponse::EDetector kDetectors[kNDetectors] = {AliPIDResponse::kITS, AliPIDResponse::kTPC, AliPIDResponse::kTOF};
+
+  Reset();
+  if (!event || !pidResponse) return;
+
+  Int_t nTracks = event->GetNumberOfTracks();
+  fTracks.reserve(nTracks);
+  for (Int_t iTrack = 0; iTrack < nTracks; iTrack++) {
+    const AliVTrack *track = static_cast<const AliVTrack*>(event->GetTrack(iTrack));
+    if (!track) continue;
+    if (fFilterMask) {
+      const AliAODTrack *aodTrack = dynamic_cast<const AliAODTrack*>(track);
+      if (aodTrack && !aodTrack->TestFilterBit(fFilterMask)) continue;
+    }
+    Int_t id = track->GetID();
+    std::vector<Int_t> &rowOf = (id < 0 ? fRowOfNegativeID : fRowOfID);
+    UInt_t key = (id < 0 ? -1-id : id);
+    if (key >= rowOf.size()) rowOf.resize(key+1, -1);
+    rowOf[key] = fTracks.size();
+    fTracks.push_back(track);
+  }
+
+  Int_t nRows = fTracks.size();
+  for (Int_t iDet = 0; iDet < kNDetectors; iDet++) fNSigma[iDet].resize(fNSpecies*nRows);
+  for (Int_t iRow = 0; iRow < nRows; iRow++) {
+    for (Int_t iDet = 0; iDet < kNDetectors; iDet++) {
+      Float_t *nSigma = &fNSigma[iDet][iRow];
+      for (Int_t iSpecies = 0; iSpecies < fNSpecies; iSpecies++)
+        nSigma[iSpecies*nRows] = pidResponse->NumberOfSigmas(kDetectors[iDet], fTracks[iRow], (AliPID::EParticleType)iSpecies);
+    }
+  }
+
+  fPIDResponse = pidResponse;
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  fEntry = (mgr ? mgr->GetCurrentEntry() : -1);
+}
+
+//_____________________________________________________________________________
+Int_t AliPIDnSigmaCache::GetRow(const AliVTrack *track) const
+{
+  //
+  // Row of the track, -1 if it is not in the table
+  //
+  Int_t id = track->GetID();
+  const std::vector<Int_t> &rowOf = (id < 0 ? fRowOfNegativeID : fRowOfID);
+  UInt_t key = (id < 0 ? -1-id : id);
+  if (key >= rowOf.size()) return -1;
+  Int_t row = rowOf[key];
+  // two tracks with the same ID, or a copy of the track
+  if (row < 0 || fTracks[row] != track) return -1;
+  return row;
+}
+
+//_____________________________________________________________________________
+Int_t AliPIDnSigmaCache::GetColumn(AliPIDResponse::EDetector detector)
+{
+  //
+  // Index of the detector in the table, -1 if not in the table
+  //
+  switch (detector) {
+    case AliPIDResponse::kITS: return 0;
+    case AliPIDResponse::kTPC: return 1;
+    case AliPIDResponse::kTOF: return 2;
+    default: return -1;
+  }
+}
+
+//_____________________________________________________________________________
+Bool_t AliPIDnSigmaCache::GetNumberOfSigmas(const AliPIDResponse *pidResponse, AliPIDResponse::EDetector detector,
+                                            const AliVTrack *track, AliPID::EParticleType type, Float_t &nSigma) const
+{
+  //
+  // n sigma of the track as given by pidResponse, kFALSE if it is not in the table
+  // of the current event
+  //
+  if (!fPIDResponse || pidResponse != fPIDResponse || !track) return kFALSE;
+  if (type < 0 || type >= fNSpecies) return kFALSE;
+  Int_t column = GetColumn(detector);
+  if (column < 0) return kFALSE;
+
+  // the table is only valid for the event it was filled with
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  if (!mgr || mgr->GetCurrentEntry() != fEntry) return kFALSE;
+
+  Int_t row = GetRow(track);
+  if (row < 0) return kFALSE;
+  nSigma = fNSigma[column][type*fTracks.size()+row];
+  return kTRUE;
+}
+
+//_____________________________________________________________________________
+Float_t AliPIDnSigmaCache::NumberOfSigmas(const AliPIDResponse *pidResponse, AliPIDResponse::EDetector detector,
+                                          const AliVTrack *track, AliPID::EParticleType type)
+{
+  //
+  // Same as pidResponse->NumberOfSigmas(detector, track, type), from the table of the
+  // current event if it has the track
+  //
+  Float_t nSigma = 0.;
+  if (fgCurrent && fgCurrent->GetNumberOfSigmas(pidResponse, detector, track, type, nSigma)) return nSigma;
+  return pidResponse->NumberOfSigmas(detector, track, type);
+}
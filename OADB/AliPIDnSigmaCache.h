@@ -0,0 +1,67 @@
+#ifndef ALIPIDNSIGMACACHE_H
+#define ALIPIDNSIGMACACHE_H
+
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+//-------------------------------------------------------------------------
+//  Per-event table of the ITS, TPC and TOF n sigma of all tracks,
+//  filled once per event by AliPIDnSigmaCacheTask and read by the PID
+//  helpers of the analysis tasks instead of calling the PID response
+//-------------------------------------------------------------------------
+
+#include <vector>
+#include <TObject.h>
+#include "AliPID.h"
+#include "AliPIDResponse.h"
+
+class AliVEvent;
+class AliVTrack;
+
+class AliPIDnSigmaCache : public TObject {
+ public:
+  enum { kNDetectors = 3 }; // ITS, TPC, TOF
+
+  AliPIDnSigmaCache(Int_t nSpecies = AliPID::kSPECIES, UInt_t filterMask = 0);
+  virtual ~AliPIDnSigmaCache();
+
+  void   Fill(const AliVEvent *event, const AliPIDResponse *pidResponse);
+  void   Reset();
+
+  Int_t  GetNSpecies()   const { return fNSpecies; }
+  UInt_t GetFilterMask() const { return fFilterMask; }
+  Int_t  GetNRows()      const { return fTracks.size(); }
+
+  Bool_t GetNumberOfSigmas(const AliPIDResponse *pidResponse, AliPIDResponse::EDetector detector,
+                           const AliVTrack *track, AliPID::EParticleType type, Float_t &nSigma) const;
+
+  // table of the current event, published by AliPIDnSigmaCacheTask
+  static AliPIDnSigmaCache* GetCurrent() { return fgCurrent; }
+  static void               SetCurrent(AliPIDnSigmaCache *cache) { fgCurrent = cache; }
+
+  // n sigma from the current table if possible, otherwise from the PID response
+  static Float_t NumberOfSigmas(const AliPIDResponse *pidResponse, AliPIDResponse::EDetector detector,
+                                const AliVTrack *track, AliPID::EParticleType type);
+
+ private:
+  AliPIDnSigmaCache(const AliPIDnSigmaCache&);
+  AliPIDnSigmaCache& operator=(const AliPIDnSigmaCache&);
+
+  Int_t  GetRow(const AliVTrack *track) const;
+  static Int_t GetColumn(AliPIDResponse::EDetector detector);
+
+  Int_t                          fNSpecies;               // number of species, starting from AliPID::kElectron
+  UInt_t                         fFilterMask;             // AOD: only tracks with one of these filter bits (0: all tracks)
+  const AliPIDResponse          *fPIDResponse;            //! PID response used to fill the table
+  Long64_t                       fEntry;                  //! analysis manager entry of the event in the table
+  std::vector<const AliVTrack*>  fTracks;                 //! track of each row
+  std::vector<Int_t>             fRowOfID;                //! row of the track with ID >= 0
+  std::vector<Int_t>             fRowOfNegativeID;        //! row of the track with ID < 0, at index -1-ID
+  std::vector<Float_t>           fNSigma[kNDetectors];    //! n sigma, for each detector fNSpecies columns of GetNRows() rows
+
+  static AliPIDnSigmaCache      *fgCurrent;               //! table of the current event
+
+  ClassDef(AliPIDnSigmaCache, 1);
+};
+
+#endif
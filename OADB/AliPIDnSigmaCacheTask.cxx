@@ -0,0 +1,91 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//-------------------------------------------------------------------------
+//  Train-level task filling the AliPIDnSigmaCache table once per event
+//
+//  Must be added after the PID response task and before the wagons
+//  reading the table (see macros/AddTaskPIDnSigmaCache.C). It does not
+//  select events, so the table is filled for every event.
+//-------------------------------------------------------------------------
+
+#include "AliPIDnSigmaCacheTask.h"
+#include "AliPIDnSigmaCache.h"
+#include "AliAnalysisManager.h"
+#include "AliInputEventHandler.h"
+#include "AliPIDResponse.h"
+#include "AliLog.h"
+
+ClassImp(AliPIDnSigmaCacheTask)
+
+//_____________________________________________________________________________
+AliPIDnSigmaCacheTask::AliPIDnSigmaCacheTask() :
+  AliAnalysisTaskSE(),
+  fNSpecies(AliPID::kSPECIES),
+  fFilterMask(0),
+  fCache(0)
+{
+  //
+  // Default constructor
+  //
+}
+
+//_____________________________________________________________________________
+AliPIDnSigmaCacheTask::AliPIDnSigmaCacheTask(const char *name) :
+  AliAnalysisTaskSE(name),
+  fNSpecies(AliPID::kSPECIES),
+  fFilterMask(0),
+  fCache(0)
+{
+  //
+  // Constructor
+  //
+}
+
+//_____________________________________________________________________________
+AliPIDnSigmaCacheTask::~AliPIDnSigmaCacheTask()
+{
+  //
+  // Destructor
+  //
+  delete fCache;
+}
+
+//_____________________________________________________________________________
+void AliPIDnSigmaCacheTask::UserCreateOutputObjects()
+{
+  //
+  // Creates the table and publishes it for the other tasks
+  //
+  if (AliPIDnSigmaCache::GetCurrent()) AliWarning("Another n sigma table is already published, it is replaced");
+  fCache = new AliPIDnSigmaCache(fNSpecies, fFilterMask);
+  AliPIDnSigmaCache::SetCurrent(fCache);
+}
+
+//_____________________________________________________________________________
+void AliPIDnSigmaCacheTask::UserExec(Option_t *)
+{
+  //
+  // Fills the table for the current event
+  //
+  AliInputEventHandler *handler = dynamic_cast<AliInputEventHandler*>(AliAnalysisManager::GetAnalysisManager()->GetInputEventHandler());
+  AliPIDResponse *pidResponse = (handler ? handler->GetPIDResponse() : 0);
+  if (!pidResponse) {
+    AliError("No PID response, the table is left empty (was the PID response task added before?)");
+    fCache->Reset();
+    return;
+  }
+  fCache->Fill(InputEvent(), pidResponse);
+}
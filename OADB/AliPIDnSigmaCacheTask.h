@@ -0,0 +1,40 @@
+#ifndef ALIPIDNSIGMACACHETASK_H
+#define ALIPIDNSIGMACACHETASK_H
+
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+//-------------------------------------------------------------------------
+//  Train-level task filling the AliPIDnSigmaCache table once per event
+//-------------------------------------------------------------------------
+
+#include "AliAnalysisTaskSE.h"
+
+class AliPIDnSigmaCache;
+
+class AliPIDnSigmaCacheTask : public AliAnalysisTaskSE {
+ public:
+  AliPIDnSigmaCacheTask();
+  AliPIDnSigmaCacheTask(const char *name);
+  virtual ~AliPIDnSigmaCacheTask();
+
+  virtual void UserCreateOutputObjects();
+  virtual void UserExec(Option_t *option);
+
+  void SetNSpecies(Int_t n)           { fNSpecies = n; }        // AliPID::kSPECIES (default) or AliPID::kSPECIESC with light nuclei
+  void SetFilterMask(UInt_t mask)     { fFilterMask = mask; }   // AOD: only tracks with one of these filter bits (default: all tracks)
+
+  AliPIDnSigmaCache* GetCache() const { return fCache; }
+
+ private:
+  AliPIDnSigmaCacheTask(const AliPIDnSigmaCacheTask&);
+  AliPIDnSigmaCacheTask& operator=(const AliPIDnSigmaCacheTask&);
+
+  Int_t               fNSpecies;   // number of species in the table
+  UInt_t              fFilterMask; // filter mask of the AOD tracks in the table
+  AliPIDnSigmaCache  *fCache;      //! table of the current event
+
+  ClassDef(AliPIDnSigmaCacheTask, 1);
+};
+
+#endif
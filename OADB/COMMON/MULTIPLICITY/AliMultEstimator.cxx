@@ -25,6 +25,7 @@ ClassImp(AliMultEstimator);
 //________________________________________________________________
 AliMultEstimator::AliMultEstimator() :
   TNamed(), fDefinition(""), fIsInteger(kFALSE), fValue(0), fMean(0), fPercentile(0), fFormula(0),
+fNUsedVars(0), fUsedVarIndex(0), fUsedVar(0), fSetupSerial(0),
 fkUseAnchor(kFALSE), fAnchorPoint(0), fAnchorPercentile(100.0)
 {
   // Constructor
@@ -32,6 +33,7 @@ fkUseAnchor(kFALSE), fAnchorPoint(0), fAnchorPercentile(100.0)
 }
 AliMultEstimator::AliMultEstimator(const char * name, const char * title, TString lInitDef):
 TNamed(name,title), fDefinition(""), fIsInteger(kFALSE), fValue(0), fMean(0), fPercentile(0), fFormula(0),
+fNUsedVars(0), fUsedVarIndex(0), fUsedVar(0), fSetupSerial(0),
 fkUseAnchor(kFALSE), fAnchorPoint(0), fAnchorPercentile(100.0)
 {
     //Named, titled, definition constructor
@@ -46,11 +48,16 @@ fValue(e.fValue),
 fMean(e.fMean),
 fPercentile(e.fPercentile),
 fFormula(0),
+fNUsedVars(0),
+fUsedVarIndex(0),
+fUsedVar(0),
+fSetupSerial(0),
 fkUseAnchor(e.fkUseAnchor),
 fAnchorPoint(e.fAnchorPoint),
 fAnchorPercentile(e.fAnchorPercentile)
 {
   if (e.fFormula) fFormula = new TFormula(*e.fFormula);
+  CopyUsedVariables(e);
 }
 //________________________________________________________________
 AliMultEstimator& AliMultEstimator::operator=(const AliMultEstimator& e)
@@ -67,6 +74,7 @@ AliMultEstimator& AliMultEstimator::operator=(const AliMultEstimator& e)
     if (fFormula) delete fFormula;
     fFormula = 0;
     if (e.fFormula) fFormula = new TFormula(*e.fFormula);
+    CopyUsedVariables(e);
     
     //Anchor point configs
     fkUseAnchor         = e.fkUseAnchor;
@@ -96,6 +104,7 @@ void AliMultEstimator::Set(const AliMultEstimator* e)
 AliMultEstimator::~AliMultEstimator(){
   // destructor
   if (fFormula) delete fFormula;   
+  ClearUsedVariables();
 }
 //________________________________________________________________
 Float_t AliMultEstimator::GetZ() const {
@@ -107,6 +116,30 @@ Float_t AliMultEstimator::GetZ() const {
     return lReturnVal; 
 }
 //________________________________________________________________
+void AliMultEstimator::ClearUsedVariables()
+{
+    delete [] fUsedVarIndex;
+    delete [] fUsedVar;
+    fUsedVarIndex = 0;
+    fUsedVar      = 0;
+    fNUsedVars    = 0;
+    fSetupSerial  = 0;
+}
+//________________________________________________________________
+void AliMultEstimator::CopyUsedVariables(const AliMultEstimator& e)
+{
+    ClearUsedVariables();
+    if (!e.fUsedVarIndex) return;
+    fNUsedVars    = e.fNUsedVars;
+    fUsedVarIndex = new Int_t[fNUsedVars+1];
+    fUsedVar      = new AliMultVariable*[fNUsedVars+1];
+    for (Int_t i = 0; i < fNUsedVars; i++) {
+        fUsedVarIndex[i] = e.fUsedVarIndex[i];
+        fUsedVar[i]      = e.fUsedVar[i];
+    }
+    fSetupSerial = e.fSetupSerial;
+}
+//________________________________________________________________
 void AliMultEstimator::SetupFormula(const AliMultInput* lInput)
 {
     TString expr = fDefinition;
@@ -121,15 +154,41 @@ void AliMultEstimator::SetupFormula(const AliMultInput* lInput)
         lVarName.Prepend("(");
         expr.ReplaceAll(lVarName, repl);
     }
+    if (fFormula) delete fFormula;
     fFormula = new TFormula(Form("e%s", GetName()), expr);
 #if ROOT_VERSION_CODE < ROOT_VERSION(5,99,4)
     fFormula->Optimize();
 #endif
+    
+    //Remember which variables enter the formula: only those
+    //have to be passed as parameters when evaluating
+    ClearUsedVariables();
+    fUsedVarIndex = new Int_t[nVar+1];
+    fUsedVar      = new AliMultVariable*[nVar+1];
+    for (Int_t i = 0; i < nVar; i++) {
+        if (!expr.Contains(Form("[%d]", i))) continue;
+        fUsedVarIndex[fNUsedVars] = i;
+        fUsedVar[fNUsedVars]      = lInput->GetVariable(i);
+        fNUsedVars++;
+    }
+    fSetupSerial = lInput->GetSerial();
 }
 //________________________________________________________________
 Float_t AliMultEstimator::Evaluate(const AliMultInput* lInput)
 {
     if (!fFormula) return fValue = 0;
+    if (fUsedVar && lInput->GetSerial() == fSetupSerial) {
+        //Fast path: variables cached in SetupFormula. The identifier is
+        //compared rather than the pointer: a new input may be allocated
+        //at the address of the deleted one used in SetupFormula
+        for (Int_t i = 0; i < fNUsedVars; i++) {
+            const AliMultVariable* v = fUsedVar[i];
+            fFormula->SetParameter(fUsedVarIndex[i], v->IsInteger() ?
+                                   v->GetValueInteger() :
+                                   v->GetValue());
+        }
+        return fValue = fFormula->Eval(0);
+    }
     for (Int_t i = 0; i < lInput->GetNVariables(); i++) {
         AliMultVariable* v = lInput->GetVariable(i);
         fFormula->SetParameter(i, v->IsInteger() ?
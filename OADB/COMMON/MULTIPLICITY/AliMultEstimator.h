@@ -2,6 +2,7 @@
 #define AliMultEstimator_H
 #include <TNamed.h>
 class AliMultInput;
+class AliMultVariable;
 class TFormula;
 
 class AliMultEstimator : public TNamed {
@@ -45,6 +46,9 @@ public:
     Float_t Evaluate(const AliMultInput* lInput);
     
 private:
+    void CopyUsedVariables(const AliMultEstimator& e);
+    void ClearUsedVariables();
+    
     TString fDefinition; //How to evaluate based on AliMultVariables
     Bool_t fIsInteger; //Requires special treatment when calibrating
     
@@ -53,6 +57,12 @@ private:
     Float_t fPercentile;   //Percentile
     TFormula* fFormula; //!
     
+    //Variables used in the formula, collected in SetupFormula
+    Int_t fNUsedVars;                 //! number of variables used in formula
+    Int_t* fUsedVarIndex;             //! index of used variable in AliMultInput (= formula parameter)
+    AliMultVariable** fUsedVar;       //! used variables of the input used in SetupFormula
+    UInt_t fSetupSerial;              //! identifier (AliMultInput::GetSerial) of the input used in SetupFormula
+    
     //Anchor point definition
     Bool_t  fkUseAnchor;        //Use Anchor Logic (default: No)
     Float_t fAnchorPoint;       //Raw value below which
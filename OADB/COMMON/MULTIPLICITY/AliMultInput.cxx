@@ -16,22 +16,24 @@
 
 ClassImp(AliMultInput);
 
+UInt_t AliMultInput::fgSerialCounter = 0;
+
 AliMultInput::AliMultInput() :
-  TNamed(), fNVars(0), fVariableList(0x0)
+  TNamed(), fNVars(0), fVariableList(0x0), fSerial(++fgSerialCounter)
 {
   // Constructor
     fVariableList = new TList();
 }
 
 AliMultInput::AliMultInput(const char * name, const char * title):
-TNamed(name,title), fNVars(0), fVariableList(0x0)
+TNamed(name,title), fNVars(0), fVariableList(0x0), fSerial(++fgSerialCounter)
 {
   // Constructor
     fVariableList = new TList();
 }
 
 AliMultInput::AliMultInput(const AliMultInput& o)
-: TNamed(o), fNVars(0), fVariableList(0x0)
+: TNamed(o), fNVars(0), fVariableList(0x0), fSerial(++fgSerialCounter)
 {
     // Constructor
     fVariableList = new TList();
@@ -48,6 +50,7 @@ AliMultInput& AliMultInput::operator=(const AliMultInput& o)
     if (!fVariableList) fVariableList = new TList();
     fVariableList->Clear();
     fNVars = 0;
+    fSerial = ++fgSerialCounter;
     TIter next(o.fVariableList);
     AliMultVariable* v  = 0;
     while ((v = static_cast<AliMultVariable*>(next())))  AddVariable(v);
@@ -77,6 +80,7 @@ void AliMultInput::AddVariable ( AliMultVariable *lVar )
     
     fVariableList->Add(lVar);
     fNVars++;
+    fSerial = ++fgSerialCounter;
 }
 
 AliMultVariable* AliMultInput::GetVariable (const TString& lName) const
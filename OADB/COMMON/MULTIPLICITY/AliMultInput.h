@@ -16,6 +16,9 @@ public:
     AliMultVariable* GetVariable (const TString& lName) const;
     AliMultVariable* GetVariable (Long_t iIdx) const;
     Long_t GetNVariables         () const { return fNVars; }
+    //Identifier of this instance and its set of variables: unique for the
+    //process, changes when variables are added or replaced
+    UInt_t GetSerial             () const { return fSerial; }
     void Clear(Option_t* option="");
     void Set(const AliMultInput* other);
     void Print(Option_t* option="") const;
@@ -23,6 +26,9 @@ public:
 private:
     Long_t fNVars;
     TList *fVariableList; //List containing all AliMultVariables
+    UInt_t fSerial;       //! identifier, see GetSerial
+    
+    static UInt_t fgSerialCounter; //! last identifier given
     
     ClassDef(AliMultInput, 1)
 };
@@ -240,42 +240,12 @@ void AliMultSelection::Evaluate( AliMultInput *lInput )
 //a set of input variables. Error handling to be done with care...
 {
     //Loop over estimators defined in the acquired list
+    //(formulas are prepared once per run in Setup)
     AliMultEstimator* estimator = 0;
     TIter             next(fEstimatorList);
     while ((estimator = static_cast<AliMultEstimator*>(next())))
         estimator->Evaluate(lInput);
 
-//deprecated evaluation
-#if 0
-    AliMultEstimator *fThisEstimator = 0;
-    for( Long_t iEst = 0; iEst<fNEsts; iEst++)
-    {
-        //Acquiring estimator from list
-        fThisEstimator = GetEstimator(iEst);
-        //cout<<"Estimator found: "<<fThisEstimator->GetName()<<", defined as "<<fThisEstimator->GetDefinition()<<endl;
-        TString lEvaluateMe = fThisEstimator->GetDefinition();
-        
-        //FIXME: replace mean values if so desired
-        
-        //Looping over all defined inputs
-        for(Long_t iVar = 0; iVar<lInput->GetNVariables(); iVar++){
-            AliMultVariable *lVar1 = (AliMultVariable*) lInput->GetVariable(iVar);
-            TString lReplacement = lVar1->GetName();
-            lReplacement.Append(")");
-            lReplacement.Prepend("(");
-            if( !lVar1->IsInteger() ){
-		lEvaluateMe.ReplaceAll( lReplacement, Form("%.10f",lVar1->GetValue() ) );
-	    }else{
-		lEvaluateMe.ReplaceAll( lReplacement, Form("%i",lVar1->GetValueInteger() ) );
-	    }
-        }
-        //cout<<"String to evaluate: "<<lEvaluateMe<<endl;
-        //FIXME: Error Handling needs to improve here
-        TFormula lEvaluateMeForm("lEvaluateMeForm", lEvaluateMe );
-        
-        fThisEstimator -> SetValue ( lEvaluateMeForm.Eval(0) );
-    }
-#endif
 }
 //________________________________________________________________
 void AliMultSelection::Setup(const AliMultInput* inp)
@@ -25,10 +25,26 @@
 #include "AliESDEvent.h"
 #include "TList.h"
 #include "TFile.h"
+#include "TEntryList.h"
 #include "TStopwatch.h"
+#include <vector>
+#include <algorithm>
 
 ClassImp(AliMultSelectionCalibrator);
 
+namespace {
+    //Ranks value indices in decreasing order of the values, equal values in
+    //increasing order of the index
+    struct CompareDecreasing {
+        CompareDecreasing(const std::vector<Double_t> &lValues) : fValues(lValues) {}
+        bool operator()(Long64_t a, Long64_t b) const {
+            if( fValues[a] != fValues[b] ) return fValues[a] > fValues[b];
+            return a < b;
+        }
+        const std::vector<Double_t> &fValues;
+    };
+}
+
 AliMultSelectionCalibrator::AliMultSelectionCalibrator() :
     TNamed(), fInputFileName(""), fBufferFileName("buffer.root"),
     fOutputFileName(""), fInput(0), fSelection(0), fMultSelectionCuts(0), fCalibHists(0),
@@ -250,11 +266,11 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
     Int_t lNRuns = 0;
     Bool_t lNewRun = kTRUE;
     Int_t lThisRunIndex = -1;
-    //Buffer file with run-by-run TTree objects needed for later processing
-
-    TFile *fOutput = new TFile (fBufferFileName.Data(), "RECREATE");
-    TTree *sTree[lMaxQuantiles];
-    cout<<"Creating Trees..."<<endl;
+    //Selected events are remembered per run (entry lists). The estimators of
+    //one run are evaluated when that run is processed, from the entries of
+    //the run only, and released afterwards: no buffer file has to be written
+    //and re-read, and only the values of one run are held in memory at a time
+    cout<<"Creating event lists..."<<endl;
     //N.B. No need to Exceed Run Ranges in Calibration Code here!
     Int_t lNTrees = 0;
     if( !lAutoDiscover ){
@@ -262,22 +278,13 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
     }else{
         lNTrees = lMax;
     }
+    std::vector<TEntryList*> lRunEvents(lNTrees);
     for(Int_t iRun=0; iRun<lNTrees; iRun++) {
-        sTree[iRun] = new TTree(Form("sTree%i",iRun),Form("sTree%i",iRun));
-        
-        //useful for debugging / cross-checking
-        sTree[iRun]->Branch("fRunNumber", &fRunNumber, "fRunNumber/I");
-        
-        for( Int_t iQvar = 0; iQvar<fInput->GetNVariables(); iQvar++) {
-            if( !fInput->GetVariable(iQvar)->IsInteger() ) {
-                sTree[iRun]->Branch(Form("%s", fInput->GetVariable(iQvar)->GetName()  ),
-                                    &fInput->GetVariable(iQvar)->GetRValue(),Form("%s/F",fInput->GetVariable(iQvar)->GetName()));
-            } else {
-                sTree[iRun]->Branch(Form("%s", fInput->GetVariable(iQvar)->GetName()  ),
-                                    &fInput->GetVariable(iQvar)->GetRValueInteger(),Form("%s/I",fInput->GetVariable(iQvar)->GetName()));
-            }
-        }
+        lRunEvents[iRun] = new TEntryList();
+        // Calibration pre-optimization and setup
+        if ( !lAutoDiscover ) ((AliMultSelection*) fMultSelectionList->At(iRun))->Setup ( fInput );
     }
+    if ( lAutoDiscover ) fSelection->Setup ( fInput );
 
     //const int lNEstimators = fSelection->GetNEstimators();
     
@@ -375,25 +382,20 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
                 fNRunRanges++;
             }
         }
-        if ( lSaveThisEvent ) {
-            sTree [ lIndex ] -> Fill();
-        }
-            
+        if ( lSaveThisEvent ) lRunEvents[ lIndex ]->Enter( iEv );
+
     }
-    
-    //Write buffer to file
-    for(Int_t iRun=0; iRun<lNRuns; iRun++) sTree[iRun]->Write();
 
     if(!lAutoDiscover){
     cout<<"(3) Inspect Run Ranges and corresponding statistics: "<<endl;
     for(Int_t iRun = 0; iRun<fNRunRanges; iRun++) {
-        cout<<" --- Range #"<<iRun<<", ("<<fFirstRun[iRun]<<" - "<<fLastRun[iRun]<<"), N(events) = "<<sTree[iRun]->GetEntries()<<endl;
+        cout<<" --- Range #"<<iRun<<", ("<<fFirstRun[iRun]<<" - "<<fLastRun[iRun]<<"), N(events) = "<<lRunEvents[iRun]->GetN()<<endl;
     }
     cout<<endl;
     }else{
         cout<<"(3) Inspect Runs and corresponding statistics: "<<endl;
         for(Int_t iRun = 0; iRun<fNRunRanges; iRun++) {
-            cout<<" --- Run #"<<iRun<<", (#"<<lRunNumbers[iRun]<<"), N(events) = "<<sTree[iRun]->GetEntries()<<endl;
+            cout<<" --- Run #"<<iRun<<", (#"<<lRunNumbers[iRun]<<"), N(events) = "<<lRunEvents[iRun]->GetN()<<endl;
         }
         cout<<endl;
     }
@@ -408,34 +410,61 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
     }
 
     // STEP 4: Actual determination of boundaries...
-    Long64_t *index;
-    Double_t *lValues; 
 
     //Histograms to store calibration information
     TH1F *hCalib[1000][lNEstimators];
     
-    cout<<"(4) Look at average values"<<endl;
+    //might be needed
+    Long64_t lAcceptedEvents;
+    
+    //=========================================
+    // Determine Calibration Information 
+    //=========================================
+    
+    //Open output OADB file, generate everything within loop
+    TFile * f = new TFile (fOutputFileName.Data(), "recreate");
+    AliOADBContainer * oadbContMS = new AliOADBContainer("MultSel");
+    
+    AliOADBMultSelection * oadbMultSelection = 0x0; 
+    AliMultSelectionCuts * cuts = 0x0; 
+    AliMultSelection     * fsels = 0x0;
+
+    //Actual Calibration Histograms
+    TH1F * hCalibData[lNEstimators];
+
+    cout<<"(4) Look at average values and (5) generate boundaries, run by run, in all desired estimators"<<endl;
     for(Int_t iRun=0; iRun<fNRunRanges; iRun++) {
 
         //Contextualize AliMultSelection for this run
         if ( !lAutoDiscover ) fSelection = (AliMultSelection*) fMultSelectionList->At(iRun);
-
-        // Calibration pre-optimization and setup
-        fSelection->Setup ( fInput );
-
-        const Int_t lNEstimatorsThis = fSelection->GetNEstimators();
 	
-        const Long64_t ntot = (Long64_t) sTree[iRun]->GetEntries();
+        const Int_t lNEstimatorsThis = fSelection->GetNEstimators(); 
+
+        const Long64_t ntot = lRunEvents[iRun]->GetN();
         if ( !lAutoDiscover ){
             cout<<"--- Processing run range "<<fFirstRun[iRun]<<"-"<<fLastRun[iRun]<<" ("<<iRun<<"/"<<fNRunRanges<<"), with "<<ntot<<" events..."<<endl;
         }else{
             cout<<"--- Processing run "<<lRunNumbers[iRun]<<" ("<<iRun<<"/"<<fNRunRanges<<"), with "<<ntot<<" events..."<<endl;
         }
-        sTree[iRun]->SetEstimate(ntot+1);
-        //Cast Run Number into drawing conditions
+        
+        //Entries of the selected events of this run, in the order in which they
+        //were filled into the former run-by-run buffer trees
+        std::vector<Long64_t> lEntries;
+        lEntries.reserve( ntot );
+        for(Long64_t iEv = lRunEvents[iRun]->GetEntry(0); iEv >= 0; iEv = lRunEvents[iRun]->Next()) lEntries.push_back( iEv );
+        
+        //Estimator values of this run: same TTree::Draw (TTreeFormula, double
+        //precision) as on the former buffer trees, restricted to the entries
+        //of the run with the entry list
+        fTree->SetEntryList( lRunEvents[iRun] );
+        fTree->SetEstimate( ntot+1 );
+        std::vector< std::vector<Double_t> > lEstValues( lNEstimatorsThis );
         for(Int_t iEst=0; iEst<lNEstimatorsThis; iEst++) {
-            lRunStats[iRun] = sTree[iRun]->Draw(fSelection->GetEstimator(iEst)->GetDefinition(),"","goff");
-            lValues = sTree[iRun]->GetV1();
+            if( ntot > 0 ) {
+                lRunStats[iRun] = fTree->Draw(fSelection->GetEstimator(iEst)->GetDefinition(),"","goff");
+                lEstValues[iEst].assign( fTree->GetV1(), fTree->GetV1()+ntot );
+            }
+            const std::vector<Double_t> &lValues = lEstValues[iEst];
             cout<<"--- Calculating averages: "<<flush;
             for( Long64_t iEntry=0; iEntry<ntot; iEntry++) {
                 Float_t lThisVal = lValues[iEntry]; //Test
@@ -447,66 +476,24 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
                     lMaxEst[iEst][iRun] = lThisVal;
                 }
             }
-            if( sTree[iRun]->GetEntries() < 1 ) {
+            if( ntot < 1 ) {
                 lAvEst[iEst][iRun] = -1;
             } else {
-                lAvEst[iEst][iRun] /= ( (Double_t) (sTree[iRun]->GetEntries()) );
+                lAvEst[iEst][iRun] /= ( (Double_t) (ntot) );
             }
             cout<<" Min = "<<lMinEst[iEst][iRun]<<", Max = "<<lMaxEst[iEst][iRun]<<", Av = "<<lAvEst[iEst][iRun]<<endl;
             
             if ( TMath::Abs( lMinEst[iEst][iRun] - lMaxEst[iEst][iRun] ) < 1e-6 ){
                 lInsane[iEst][iRun] = kTRUE; //No valid information to do calibration, please be careful !
             }
-            
-        }
-    }
-    //might be needed
-    Long64_t lAcceptedEvents;
-    
-    //=========================================
-    // Determine Calibration Information 
-    //=========================================
-    
-    //Open output OADB file, generate everything within loop
-    TFile * f = new TFile (fOutputFileName.Data(), "recreate");
-    AliOADBContainer * oadbContMS = new AliOADBContainer("MultSel");
-    
-    AliOADBMultSelection * oadbMultSelection = 0x0; 
-    AliMultSelectionCuts * cuts = 0x0; 
-    AliMultSelection     * fsels = 0x0;
-
-    //Actual Calibration Histograms
-    TH1F * hCalibData[lNEstimators];
-
-    cout<<"(5) Generate Boundaries through a loop in all desired estimators"<<endl;
-    for(Int_t iRun=0; iRun<fNRunRanges; iRun++) {
-
-        //Contextualize AliMultSelection for this run
-        if ( !lAutoDiscover ) fSelection = (AliMultSelection*) fMultSelectionList->At(iRun);
-
-        // Calibration pre-optimization and setup
-        fSelection->Setup ( fInput );
-	
-        const Int_t lNEstimatorsThis = fSelection->GetNEstimators(); 
-
-        const Long64_t ntot = (Long64_t) sTree[iRun]->GetEntries();
-        if ( !lAutoDiscover ){
-            cout<<"--- Processing run range "<<fFirstRun[iRun]<<"-"<<fLastRun[iRun]<<" ("<<iRun<<"/"<<fNRunRanges<<"), with "<<ntot<<" events..."<<endl;
-        }else{
-            cout<<"--- Processing run "<<lRunNumbers[iRun]<<" ("<<iRun<<"/"<<fNRunRanges<<"), with "<<ntot<<" events..."<<endl;
         }
-        sTree[iRun]->SetEstimate(ntot+1);
-        // Memory allocation: don't repeat it per estimator! only per run
-        index = new Long64_t[ntot];
-        //Cast Run Number into drawing conditions
+        
         for(Int_t iEst=0; iEst<lNEstimatorsThis; iEst++) {
+            const std::vector<Double_t> &lValues = lEstValues[iEst];
             if( ! ( fSelection->GetEstimator(iEst)->IsInteger() ) ) {
                 //==== Floating Point Calibration Engine ====
-                lRunStats[iRun] = sTree[iRun]->Draw(fSelection->GetEstimator(iEst)->GetDefinition(),"","goff");
-                cout<<"--- Sorting estimator "<<fSelection->GetEstimator(iEst)->GetName()<<"..."<<flush;
-                
-                TMath::Sort(ntot,sTree[iRun]->GetV1(),index);
-                cout<<" Done! Getting Boundaries... "<<flush;
+                lRunStats[iRun] = ntot;
+                cout<<"--- Getting Boundaries for estimator "<<fSelection->GetEstimator(iEst)->GetName()<<"... "<<flush;
                 
                 //Special override in case anchored estimator
                 if( fSelection->GetEstimator(iEst)->GetUseAnchor() ){
@@ -515,9 +502,18 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
                     //Count fraction of accepted
                     TString lCondition = fSelection->GetEstimator(iEst)->GetDefinition();
                     lCondition.Append(Form("> %.10f",fSelection->GetEstimator(iEst)->GetAnchorPoint() ) );
-                    lAcceptedEvents = sTree[iRun]->Draw(fSelection->GetEstimator(iEst)->GetDefinition(),lCondition.Data(),"goff");
+                    lAcceptedEvents = fTree->Draw(fSelection->GetEstimator(iEst)->GetDefinition(),lCondition.Data(),"goff");
                     lRunStats[iRun] = lAcceptedEvents;
                 }
+                //Boundaries are order statistics in decreasing order: partial selection
+                //(nth_element) of the entry indices around each requested position instead
+                //of a full TMath::Sort. Indices before the previous position are all
+                //ranked before the ones after it, so each selection only has to look at
+                //one side of it. Equal values are ranked in entry order
+                std::vector<Long64_t> lIndex( ntot );
+                for( Long64_t iEntry=0; iEntry<ntot; iEntry++) lIndex[iEntry] = iEntry;
+                CompareDecreasing lCompare( lValues );
+                Long64_t lPrevPosition = -1;
                 lNrawBoundaries[0] = 0.0; //Defined OK even if anchored
                 //Overwrite lower boundary in case this has a negative minimum...
                 if ( lMinEst[iEst][iRun] < 0 ) {
@@ -538,10 +534,26 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
                         if(position > ntot-1 ) position = ntot-1; //protection !
                     }
                     //cout<<"Position requested: "<<position<<flush;
-                    sTree[iRun]->GetEntry( index[position] );
+                    if( ntot < 1 ) {
+                        //Nothing to select from: evaluate current input, please
+                        fSelection->Evaluate ( fInput );
+                        lNrawBoundaries[lB] = fSelection->GetEstimator(iEst)->GetValue();
+                        continue;
+                    }
+                    if( position > ntot-1 ) position = ntot-1; //protection !
+                    if( position != lPrevPosition ) {
+                        std::vector<Long64_t>::iterator lFirst = lIndex.begin();
+                        std::vector<Long64_t>::iterator lLast  = lIndex.end();
+                        if( lPrevPosition >= 0 ) {
+                            if( position < lPrevPosition ) lLast  = lIndex.begin()+lPrevPosition;
+                            else                           lFirst = lIndex.begin()+lPrevPosition+1;
+                        }
+                        std::nth_element( lFirst, lIndex.begin()+position, lLast, lCompare );
+                        lPrevPosition = position;
+                    }
+                    fTree->GetEntry( lEntries[ lIndex[position] ] );
                     //Calculate the estimator with this input, please
                     fSelection->Evaluate ( fInput );
-                    //fSelection->PrintInfo();
                     lNrawBoundaries[lB] = fSelection->GetEstimator(iEst)->GetValue();
                 }
                 //Cross-check correct rejection of anything beyond anchor point
@@ -594,14 +606,14 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
                 Float_t lLowEdge = lMinEst[iEst][iRun]-0.5;
                 Float_t lHighEdge= lMaxEst[iEst][iRun]+0.5;
                 cout<<"Inspect: "<<lNBins<<", low "<<lLowEdge<<", high "<<lHighEdge<<endl;
-                if( sTree[iRun]->GetEntries() < 1 ) {
+                if( ntot < 1 ) {
                     //Case of an empty run!
                     hCalib[iRun][iEst] = new TH1F(Form("hCalib_%i_%s",lRunNumbers[iRun],fSelection->GetEstimator(iEst)->GetName()),"",1,0,1);
                     hCalib[iRun][iEst]->SetDirectory(0);
                 } else {
                     TH1F *hTemporary = new TH1F("hTemporary", "", lNBins, lMinEst[iEst][iRun]-0.5, lMaxEst[iEst][iRun]+0.5 );
                     //hTemporary->SetDirectory(0);
-                    lRunStats[iRun] = sTree[iRun]->Draw(Form("%s>>hTemporary",fSelection->GetEstimator(iEst)->GetDefinition().Data()),"","goff");
+                    lRunStats[iRun] = fTree->Draw(Form("%s>>hTemporary",fSelection->GetEstimator(iEst)->GetDefinition().Data()),"","goff");
                     cout<<"entries = "<<lRunStats[iRun]<<endl;
                     //In memory now: histogram with content, please normalize to unity
                     hTemporary->Scale(1./((double)(lRunStats[iRun])));
@@ -702,8 +714,10 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
             //DEFAULT OADB Object saving procedure ENDS here
             //========================================================================
         }
-        //Cleanup: Delete index variable
-        delete[] index;
+        //Cleanup: the estimator values of this run are released at the end of the iteration
+        fTree->SetEntryList( 0x0 );
+        delete lRunEvents[iRun];
+        lRunEvents[iRun] = 0x0;
     }
     
     if( fRunToUseAsDefault < 0 ){
@@ -738,6 +752,8 @@ Bool_t AliMultSelectionCalibrator::Calibrate() {
         //========================================================================
     }
     
+    for(Int_t iRun=0; iRun<lNTrees; iRun++) delete lRunEvents[iRun];
+    
     cout<<"All done, will write OADB..."<<endl;
 
     oadbContMS->Write();
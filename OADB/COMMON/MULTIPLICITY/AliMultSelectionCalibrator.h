@@ -86,7 +86,7 @@ private:
     TList *fMultSelectionList; // List of AliMultSelection objects to be used per run period 
     
     TString fInputFileName;  // Filename for TTree object for calibration purposes
-    TString fBufferFileName; // Filename for TTree object (buffer file)
+    TString fBufferFileName; // Filename for TTree object (buffer file, unused: runs are selected with entry lists)
     TString fOutputFileName; // Filename for calibration OADB output
     
     // Object for storing event selection configuration
@@ -1654,19 +1654,18 @@ void AliMultSelectionTask::UserExec(Option_t *)
 
         //Determine Quantiles from calibration histogram
         TH1F *lThisCalibHisto = 0x0;
-        TString lThisCalibHistoName;
         Float_t lThisQuantile = -1;
         for(Long_t iEst=0; iEst<lSelection->GetNEstimators(); iEst++) {
             //Changed: no need for run number, object already matches required one
-            lThisCalibHistoName = Form("hCalib_%s",lSelection->GetEstimator(iEst)->GetName());
-            lThisCalibHisto = 0x0;
-            lThisCalibHisto = fOadbMultSelection->GetCalibHisto( lThisCalibHistoName );
+            //Histogram "hCalib_<estimator>" cached per estimator at run change
+            lThisCalibHisto = fOadbMultSelection->GetEstimatorCalibHisto( iEst );
             if ( ! lThisCalibHisto ) {
                 lThisQuantile = AliMultSelectionCuts::kNoCalib;
                 if( iEst < fNDebug ) fQuantiles[iEst] = lThisQuantile;
                 lSelection->GetEstimator(iEst)->SetPercentile(lThisQuantile);
             } else {
-                lThisQuantile = lThisCalibHisto->GetBinContent( lThisCalibHisto->FindBin( lSelection->GetEstimator(iEst)->GetValue() ));
+                //Calibration histograms are never extended: FindFixBin (binary search for variable bins)
+                lThisQuantile = lThisCalibHisto->GetBinContent( lThisCalibHisto->GetXaxis()->FindFixBin( lSelection->GetEstimator(iEst)->GetValue() ));
                 if( iEst < fNDebug ) {
                     fQuantiles[iEst] = lThisQuantile; //Debug, please
                 }
@@ -10,6 +10,7 @@
 #include "TObjString.h"
 #include "TBrowser.h"
 #include <TMap.h>
+#include <TObjArray.h>
 #include <TROOT.h>
 
 ClassImp(AliOADBMultSelection);
@@ -17,7 +18,7 @@ ClassImp(AliOADBMultSelection);
 //________________________________________________________________
 //Constructors/Destructor
 AliOADBMultSelection::AliOADBMultSelection() :
-TNamed("multSel",""), fCalibList(0), fEventCuts(0), fSelection(0), fMap(0)
+TNamed("multSel",""), fCalibList(0), fEventCuts(0), fSelection(0), fMap(0), fEstimatorHistos(0)
 {
     // constructor
     // fCalibList = new TList();
@@ -29,7 +30,8 @@ AliOADBMultSelection::AliOADBMultSelection(const AliOADBMultSelection& o)
 fCalibList(0),
 fEventCuts(0),
 fSelection(0),
-fMap(0)
+fMap(0),
+fEstimatorHistos(0)
 {
     fCalibList = new TList();
     fCalibList->SetOwner (kTRUE);
@@ -41,7 +43,7 @@ fMap(0)
 }
 //________________________________________________________________
 AliOADBMultSelection::AliOADBMultSelection(const char * name, const char * title) :
-TNamed(name, title), fCalibList(0), fEventCuts(0), fSelection(0), fMap(0)
+TNamed(name, title), fCalibList(0), fEventCuts(0), fSelection(0), fMap(0), fEstimatorHistos(0)
 {
     // constructor
     fCalibList = new TList();
@@ -61,6 +63,10 @@ AliOADBMultSelection& AliOADBMultSelection::operator=(const AliOADBMultSelection
         delete fMap;
         fMap = 0;
     }
+    if (fEstimatorHistos) {
+        delete fEstimatorHistos;
+        fEstimatorHistos = 0;
+    }
     fCalibList = new TList();
     fCalibList->SetOwner (kTRUE);
     TIter next(o.fCalibList);
@@ -75,6 +81,7 @@ AliOADBMultSelection::~AliOADBMultSelection(){
     // Destructor
     if(fEventCuts)     delete fEventCuts;
     if(fSelection)     delete fSelection;
+    if(fEstimatorHistos) delete fEstimatorHistos;
     
     //if( fCalibList) {
     //    fCalibList -> Delete();
@@ -124,6 +131,19 @@ TH1F* AliOADBMultSelection::GetCalibHisto(const TString& lCalibHistoName) const
     return ((TH1F*)fCalibList->FindObject(lCalibHistoName));
 }
 //________________________________________________________________
+TH1F* AliOADBMultSelection::GetEstimatorCalibHisto(Long_t iEst) const
+{
+    //Calibration histogram of estimator iEst of the AliMultSelection,
+    //cached in Setup (look-up by name otherwise)
+    if (fEstimatorHistos) {
+        if (iEst < 0 || iEst >= fEstimatorHistos->GetSize()) return 0;
+        return static_cast<TH1F*>(fEstimatorHistos->UncheckedAt(iEst));
+    }
+    AliMultEstimator* e = fSelection ? fSelection->GetEstimator(iEst) : 0;
+    if (!e) return 0;
+    return GetCalibHisto(Form("hCalib_%s", e->GetName()));
+}
+//________________________________________________________________
 void AliOADBMultSelection::Print(Option_t* option) const
 {
     Printf("%s: %s/%s", ClassName(), GetName(), GetTitle());
@@ -231,11 +251,17 @@ void AliOADBMultSelection::Setup()
         delete fMap;
         fMap = 0;
     }
+    if (fEstimatorHistos) {
+        delete fEstimatorHistos;
+        fEstimatorHistos = 0;
+    }
     AliMultSelection* sel = GetMultSelection();
     if (!sel) return;
     
     fMap = new TMap;
     fMap->SetOwner(false);
+    fEstimatorHistos = new TObjArray(sel->GetNEstimators() > 0 ? sel->GetNEstimators() : 1);
+    fEstimatorHistos->SetOwner(kFALSE);
     
     for(Long_t iEst=0; iEst<sel->GetNEstimators(); iEst++) {
         AliMultEstimator* e = sel->GetEstimator(iEst);
@@ -246,6 +272,7 @@ void AliOADBMultSelection::Setup()
         if (!h) continue;
         
         fMap->Add(e, h);
+        fEstimatorHistos->AddAt(h, iEst);
     }
 }
 
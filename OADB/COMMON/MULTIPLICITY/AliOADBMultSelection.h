@@ -9,6 +9,7 @@ class TList;
 class AliMultSelectionCuts;
 class AliMultEstimator;
 class TMap;
+class TObjArray;
 
 class AliOADBMultSelection : public TNamed {
     
@@ -24,6 +25,7 @@ public:
     
     TH1F *GetCalibHisto(Long_t iEst) const;
     TH1F *GetCalibHisto(const TString& lCalibHistoName) const;
+    TH1F *GetEstimatorCalibHisto(Long_t iEst) const;
     
     void AddCalibHisto (TH1F * var);
     AliMultSelectionCuts * GetEventCuts() const                           { return fEventCuts;     }
@@ -46,6 +48,7 @@ private:
     AliMultSelectionCuts * fEventCuts; // EventCuts
     AliMultSelection     * fSelection; // Definition of Estimators
     TMap*                  fMap; //! Map estimator to histogram
+    TObjArray*             fEstimatorHistos; //! Histogram for each estimator index
     ClassDef(AliOADBMultSelection, 1)
     
     
@@ -24,6 +24,8 @@
 #pragma link C++ class AliCollisionNormalizationTask+;
 #pragma link C++ class AliEventCuts+;
 #pragma link C++ class AliEventCutsContainer+;
+#pragma link C++ class AliPIDnSigmaCache+;
+#pragma link C++ class AliPIDnSigmaCacheTask+;
 
 #pragma link C++ class AliMultVariable+;
 #pragma link C++ class AliMultInput+;
@@ -26,6 +26,7 @@
 #include <TMath.h>
 #include <TRandom.h>
 #include <TChain.h>
+#include <TBranch.h>
 #include <TGrid.h>
 #include <TGridResult.h>
 #include <TSystem.h>
@@ -126,6 +127,8 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper() :
   fRandomEventNumberAccess(kFALSE),
   fRandomFileAccess(kTRUE),
   fCreateHisto(true),
+  fSelectiveRead(true),
+  fPrefetchNextFile(true),
   fYAMLConfig(),
   fUseInternalEventSelection(false),
   fUseManualInternalEventCuts(false),
@@ -151,6 +154,9 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper() :
   fLowerEntry(0),
   fUpperEntry(0),
   fOffset(0),
+  fSelectionTreeNumber(-1),
+  fSelectionBranches(),
+  fPrefetchedFilename(),
   fMaxNumberOfFiles(0),
   fFileNumber(0),
   fHistManager(),
@@ -194,6 +200,8 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper(const c
   fRandomEventNumberAccess(kFALSE),
   fRandomFileAccess(kTRUE),
   fCreateHisto(true),
+  fSelectiveRead(true),
+  fPrefetchNextFile(true),
   fYAMLConfig(),
   fUseInternalEventSelection(false),
   fUseManualInternalEventCuts(false),
@@ -219,6 +227,9 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper(const c
   fLowerEntry(0),
   fUpperEntry(0),
   fOffset(0),
+  fSelectionTreeNumber(-1),
+  fSelectionBranches(),
+  fPrefetchedFilename(),
   fMaxNumberOfFiles(0),
   fFileNumber(0),
   fHistManager(name),
@@ -252,6 +263,7 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper(const c
 AliAnalysisTaskEmcalEmbeddingHelper::~AliAnalysisTaskEmcalEmbeddingHelper()
 {
   if (fgInstance == this) fgInstance = nullptr;
+  ReleasePrefetchedFile();
   if (fExternalEvent) delete fExternalEvent;
   if (fExternalFile) {
     fExternalFile->Close();
@@ -310,6 +322,8 @@ void AliAnalysisTaskEmcalEmbeddingHelper::RetrieveTaskPropertiesFromYAMLConfig()
   res = fYAMLConfig.GetProperty("randomEventNumberAccess", fRandomEventNumberAccess, false);
   res = fYAMLConfig.GetProperty("randomFileAccess", fRandomFileAccess, false);
   res = fYAMLConfig.GetProperty("createHisto", fCreateHisto, false);
+  res = fYAMLConfig.GetProperty("selectiveRead", fSelectiveRead, false);
+  res = fYAMLConfig.GetProperty("prefetchNextFile", fPrefetchNextFile, false);
   // More general embedding helper properties
   res = fYAMLConfig.GetProperty("filePattern", fFilePattern, false);
   res = fYAMLConfig.GetProperty("inputFilename", fInputFilename, false);
@@ -791,11 +805,16 @@ void AliAnalysisTaskEmcalEmbeddingHelper::DetermineFirstFileToEmbed()
  * next tree within the TChain. In the case of running of out files to embed, an error is thrown and embedding
  * begins again from the start of the file list.
  *
+ * If selective read is enabled, candidate entries are only partially read (see LoadEntryForSelection()) and
+ * the full event is read once an entry has been accepted.
+ *
  * @return kTRUE if successful
  */
 Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
 {
   Int_t attempts = -1;
+  Long64_t selectedEntry = -1;
+  bool readSelectionBranchesOnly = false;
 
   do {
     // Reset to start of tree
@@ -821,7 +840,7 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
     // Load current event
     // Can be a simple less than, because fFileNumber counts from 0.
     if (fFileNumber < fMaxNumberOfFiles) {
-      fChain->GetEntry(fCurrentEntry);
+      readSelectionBranchesOnly = LoadEntryForSelection(fCurrentEntry);
     }
     else {
       AliError("====================================================================================================");
@@ -839,8 +858,9 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
 
       // Access the relevant entry
       // We are certain that fFileNumber is less than fMaxNumberOfFiles, so we are resetting to start
-      fChain->GetEntry(fCurrentEntry);
+      readSelectionBranchesOnly = LoadEntryForSelection(fCurrentEntry);
     }
+    selectedEntry = fCurrentEntry;
     AliDebug(4, TString::Format("Loading entry %i between %i-%i, starting with offset %i from the lower bound of %i", fCurrentEntry, fLowerEntry, fUpperEntry, fOffset, fLowerEntry));
 
     // Set relevant event properties
@@ -861,6 +881,13 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
 
   } while (!IsEventSelected());
 
+  // Only the branches needed for the selection have been read so far: load the full accepted event.
+  // Objects such as the pythia header are recreated when reading, so the event properties are set again.
+  if (readSelectionBranchesOnly) {
+    fChain->GetEntry(selectedEntry);
+    SetEmbeddedEventProperties();
+  }
+
   if (fCreateHisto) {
     fHistManager.FillTH1("fHistEventCount", "Accepted");
     fHistManager.FillTH1("fHistEmbeddedEventsAttempted", attempts);
@@ -871,6 +898,52 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
   return kTRUE;
 }
 
+/**
+ * Load an entry of the TChain for the embedded event selection. If selective read is enabled and the
+ * external event is an AOD, only the branches used by SetEmbeddedEventProperties() and CheckIsEmbeddedEventSelected()
+ * (header, vertices and MC header) are read. Most candidate entries are rejected, so the (much larger) rest of
+ * the event is only read by GetNextEntry() once an entry has been accepted.
+ *
+ * @param[in] entry Entry in the TChain to load.
+ *
+ * @return true if only the selection branches were read and the full entry still needs to be loaded.
+ */
+bool AliAnalysisTaskEmcalEmbeddingHelper::LoadEntryForSelection(Long64_t entry)
+{
+  if (!fSelectiveRead || !dynamic_cast<AliAODEvent*>(fExternalEvent)) {
+    fChain->GetEntry(entry);
+    return false;
+  }
+
+  // Past the end of the chain. As for GetEntry(), nothing is filled in this case.
+  Long64_t localEntry = fChain->LoadTree(entry);
+  if (localEntry < 0) {
+    return false;
+  }
+
+  // The branches belong to the tree of the current file, so they need to be retrieved again for each new tree
+  if (fChain->GetTreeNumber() != fSelectionTreeNumber) {
+    fSelectionTreeNumber = fChain->GetTreeNumber();
+    fSelectionBranches.clear();
+    const char * branchNames[] = {"header", "vertices", AliAODMCHeader::StdBranchName()};
+    for (auto branchName : branchNames) {
+      TBranch * branch = fChain->GetTree()->GetBranch(branchName);
+      if (branch) {
+        fSelectionBranches.push_back(branch);
+      }
+      else {
+        AliDebugStream(3) << "Branch \"" << branchName << "\" needed for the embedded event selection not found.\n";
+      }
+    }
+  }
+
+  for (auto branch : fSelectionBranches) {
+    branch->GetEntry(localEntry);
+  }
+
+  return true;
+}
+
 /**
  * Set some properties of the event that are not immediately available from the external event to make them
  * available to user tasks.
@@ -1392,6 +1465,14 @@ void AliAnalysisTaskEmcalEmbeddingHelper::InitTree()
   // next tree (in the next file) since entries are indexed starting from 0.
   fChain->GetEntry(fUpperEntry);
 
+  // The TChain did not use the file opened in the background if it moved to another file
+  ReleasePrefetchedFile();
+
+  // The file for this tree is now open, so the next one can already be opened in the background
+  if (fPrefetchNextFile) {
+    PrefetchNextFile();
+  }
+
   // Determine tree size and current entry
   // Set the limits of the new tree
   fLowerEntry = fUpperEntry;
@@ -1451,6 +1532,50 @@ void AliAnalysisTaskEmcalEmbeddingHelper::InitTree()
   fInitializedNewFile = kTRUE;
 }
 
+/**
+ * Start opening the file following the current tree in the TChain asynchronously. When the TChain switches to the
+ * next tree, TFile::Open() picks up the pending request instead of opening the file again, so the (usually remote)
+ * file open overlaps with the processing of the current file.
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::PrefetchNextFile()
+{
+  Int_t nextTreeNumber = fChain->GetTreeNumber() + 1;
+  // Nothing has been loaded yet, or this is the last file
+  if (nextTreeNumber <= 0 || nextTreeNumber >= fChain->GetNtrees()) {
+    return;
+  }
+
+  TObject * chainElement = fChain->GetListOfFiles()->At(nextTreeNumber);
+  if (!chainElement) {
+    return;
+  }
+
+  // The title of the chain element is the filename
+  AliDebugStream(3) << "Opening next file to embed \"" << chainElement->GetTitle() << "\" in the background.\n";
+  if (TFile::AsyncOpen(chainElement->GetTitle())) {
+    fPrefetchedFilename = chainElement->GetTitle();
+  }
+}
+
+/**
+ * Release the asynchronous open request of PrefetchNextFile() if the TChain did not pick it up, because it moved to
+ * another file, the open failed, or the embedding ends before the file is reached. TFile::Open() completes the
+ * pending request and deletes its handle, and the file is closed again.
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::ReleasePrefetchedFile()
+{
+  if (fPrefetchedFilename.empty()) {
+    return;
+  }
+
+  if (TFile::GetAsyncOpenStatus(fPrefetchedFilename.c_str()) != TFile::kAOSNotAsync) {
+    AliDebugStream(3) << "Releasing the unused background open of \"" << fPrefetchedFilename << "\".\n";
+    TFile * file = TFile::Open(fPrefetchedFilename.c_str());
+    delete file;
+  }
+  fPrefetchedFilename = "";
+}
+
 /**
  * Extract pythia information from a cross section file. Modified from AliAnalysisTaskEmcal::PythiaInfoFromFile().
  *
@@ -1739,6 +1864,8 @@ std::string AliAnalysisTaskEmcalEmbeddingHelper::toString(bool includeFileList)
   tempSS << "Tree name: " << fTreeName << "\n";
   tempSS << "Random event number access: " << fRandomEventNumberAccess << "\n";
   tempSS << "Random file access: " << fRandomFileAccess << "\n";
+  tempSS << "Selective read for embedded event selection: " << fSelectiveRead << "\n";
+  tempSS << "Prefetch next file: " << fPrefetchNextFile << "\n";
   tempSS << "Starting file index: " << fFilenameIndex << "\n";
   tempSS << "Number of files to embed: " << fFilenames.size() << "\n";
   tempSS << "YAML configuration path: \"" << fConfigurationPath << "\"\n";
@@ -18,6 +18,7 @@
 
 class TString;
 class TChain;
+class TBranch;
 class TFile;
 class AliVEvent;
 class AliVHeader;
@@ -114,6 +115,8 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   Int_t GetStartingFileIndex()                              const { return fFilenameIndex; }
   TString GetFileListFilename()                             const { return fFileListFilename; }
   bool GetCreateHistos()                                    const { return fCreateHisto; }
+  bool GetSelectiveRead()                                   const { return fSelectiveRead; }
+  bool GetPrefetchNextFile()                                const { return fPrefetchNextFile; }
 
   // Set
   /// Set the pt hard bin which will be added into the file pattern. Can also be omitted and set directly in the pattern.
@@ -144,6 +147,10 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   void SetFileListFilename(const char * filename)                 { fFileListFilename = filename; }
   /// Create QA histograms. These are necessary for proper scaling, so be careful disabling them!
   void SetCreateHistos(bool b)                                    { fCreateHisto = b; }
+  /// Read only the branches needed for the embedded event selection until an entry is accepted (AOD only)
+  void SetSelectiveRead(bool b = true)                            { fSelectiveRead = b; }
+  /// Open the next file to embed in the background while the current one is being used
+  void SetPrefetchNextFile(bool b = true)                         { fPrefetchNextFile = b; }
   /// Set path to %YAML configuration file
   void SetConfigurationPath(const char * path)                    { fConfigurationPath = path; }
   /* @} */
@@ -288,12 +295,15 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   Bool_t          SetupInputFiles()     ;
   std::string     ConstructFullPythiaXSecFilename(std::string inputFilename, const std::string & pythiaFilename, bool testIfExists) const;
   Bool_t          GetNextEntry()        ;
+  bool            LoadEntryForSelection(Long64_t entry);
   void            SetEmbeddedEventProperties();
   void            RecordEmbeddedEventProperties();
   Bool_t          IsEventSelected()     ;
   Bool_t          CheckIsEmbeddedEventSelected();
   Bool_t          InitEvent()           ;
   void            InitTree()            ;
+  void            PrefetchNextFile()    ;
+  void            ReleasePrefetchedFile();
   bool            PythiaInfoFromCrossSectionFile(std::string filename);
   // Helper functions
   bool            IsFileAccessible() const;
@@ -318,6 +328,8 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   Bool_t                                        fRandomEventNumberAccess; ///<  If true, it will start embedding from a random entry in the file rather than from the first
   Bool_t                                        fRandomFileAccess ; ///<  If true, it will start embedding from a random file in the input files list
   bool                                          fCreateHisto      ; ///<  If true, create QA histograms
+  bool                                          fSelectiveRead    ; ///<  If true, only the branches needed for the embedded event selection are read before an entry is accepted
+  bool                                          fPrefetchNextFile ; ///<  If true, the next file in the TChain is opened asynchronously while the current one is used
   PWG::Tools::AliYAMLConfiguration              fYAMLConfig       ; ///<  Hanldes configuration from YAML
 
   bool                                  fUseInternalEventSelection; ///<  If true, apply internal event selection though AliEventCuts
@@ -347,6 +359,9 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   Int_t                                         fLowerEntry       ; //!<! First entry of the current tree to be used for embedding
   Int_t                                         fUpperEntry       ; //!<! Last entry of the current tree to be used for embedding
   Int_t                                         fOffset           ; //!<! Offset from fLowerEntry where the loop over the tree should start
+  Int_t                                         fSelectionTreeNumber; //!<! Tree number in the TChain for which fSelectionBranches were retrieved
+  std::vector <TBranch *>                       fSelectionBranches; //!<! Branches needed for the embedded event selection in the current tree
+  std::string                                   fPrefetchedFilename; //!<! File opened asynchronously by PrefetchNextFile() and not yet picked up by the TChain
   UInt_t                                        fMaxNumberOfFiles ; //!<! Max number of files that are in the TChain
   UInt_t                                        fFileNumber       ; //!<! File number corresponding to the current tree
   THistManager                                  fHistManager      ; ///< Manages access to all histograms
@@ -368,7 +383,7 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   AliAnalysisTaskEmcalEmbeddingHelper &operator=(const AliAnalysisTaskEmcalEmbeddingHelper&); // not implemented
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisTaskEmcalEmbeddingHelper, 10);
+  ClassDef(AliAnalysisTaskEmcalEmbeddingHelper, 11);
   /// \endcond
 };
 #endif
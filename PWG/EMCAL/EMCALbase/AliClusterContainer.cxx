@@ -146,7 +146,7 @@ AliVCluster* AliClusterContainer::GetAcceptCluster(Int_t i) const
   if (!vc) return 0;
 
   UInt_t rejectionReason = 0;
-  if (AcceptCluster(vc, rejectionReason))
+  if (AcceptObjectCached(i, rejectionReason))
     return vc;
   else {
     AliDebug(2,"Cluster not accepted.");
@@ -421,13 +421,7 @@ Bool_t AliClusterContainer::ApplyClusterCuts(const AliVCluster* clus, UInt_t &re
  */
 Int_t AliClusterContainer::GetNAcceptedClusters() const
 {
-  UInt_t rejectionReason = 0;
-  Int_t nClus = 0;
-  for(int iclust = 0; iclust < this->fClArray->GetEntries(); ++iclust){
-    AliVCluster *clust = this->GetCluster(iclust);
-    if(this->AcceptCluster(clust, rejectionReason)) nClus++;
-  }
-  return nClus;
+  return GetNAcceptEntries();
 }
 
 /**
@@ -13,6 +13,7 @@
  * provided "as is" without express or implied warranty.                  *
  **************************************************************************/
 #include <TClonesArray.h>
+#include "AliAnalysisManager.h"
 #include "AliVEvent.h"
 #include "AliLog.h"
 #include "AliNamedArrayI.h"
@@ -51,10 +52,16 @@ AliEmcalContainer::AliEmcalContainer():
   fMaxMCLabel(-1),
   fMassHypothesis(-1),
   fIsEmbedding(kFALSE),
+  fUseAcceptCache(kFALSE),
   fClArray(0),
   fCurrentID(0),
   fLabelMap(0),
   fLoadedClass(0),
+  fAcceptFlags(),
+  fRejectionReasons(),
+  fAcceptIndices(),
+  fNAcceptEntries(-1),
+  fAcceptCacheEntry(-1),
   fClassName()
 {
   fVertex[0] = 0;
@@ -88,10 +95,16 @@ AliEmcalContainer::AliEmcalContainer(const char *name):
   fMaxMCLabel(-1),
   fMassHypothesis(-1),
   fIsEmbedding(kFALSE),
+  fUseAcceptCache(kFALSE),
   fClArray(0),
   fCurrentID(0),
   fLabelMap(0),
   fLoadedClass(0),
+  fAcceptFlags(),
+  fRejectionReasons(),
+  fAcceptIndices(),
+  fNAcceptEntries(-1),
+  fAcceptCacheEntry(-1),
   fClassName()
 {
   fVertex[0] = 0;
@@ -153,6 +166,7 @@ void AliEmcalContainer::SetArray(const AliVEvent *event)
   if (!event) return;
 
   GetVertexFromEvent(event);
+  ResetAcceptCache();
 
   if (!fClArrayName.IsNull() && !fClArray) {
     fClArray = dynamic_cast<TClonesArray*>(event->FindListObject(fClArrayName));
@@ -190,6 +204,51 @@ void AliEmcalContainer::NextEvent(const AliVEvent * event)
   if (!event) return;
 
   GetVertexFromEvent(event);
+  ResetAcceptCache();
+}
+
+/**
+ * Evaluate the selection of all entries in the container, unless
+ * it is already cached for the current event.
+ */
+void AliEmcalContainer::UpdateAcceptCache() const
+{
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  Long64_t entry = mgr ? mgr->GetCurrentEntry() : -1;
+  const Int_t n = GetNEntries();
+  if (fUseAcceptCache && fNAcceptEntries >= 0 && entry == fAcceptCacheEntry && n == fAcceptFlags.GetSize()) return;
+
+  fAcceptFlags.Set(n);
+  fRejectionReasons.Set(n);
+  fAcceptIndices.Set(n);
+  fNAcceptEntries = 0;
+  for(int index = 0; index < n; index++){
+    UInt_t rejectionReason = 0;
+    Bool_t accepted = AcceptObject(index, rejectionReason);
+    fAcceptFlags[index] = accepted;
+    fRejectionReasons[index] = rejectionReason;
+    if(accepted) fAcceptIndices[fNAcceptEntries++] = index;
+  }
+  fAcceptCacheEntry = entry;
+}
+
+/**
+ * Selection of the entry at a given index, as given by AcceptObject(i, rejectionReason),
+ * read from the selection cached for the current event.
+ * @param[in] i Index of the entry
+ * @param[out] rejectionReason Bitmap for reason why object is rejected (not reset)
+ * @return True if the entry is accepted, false otherwise
+ */
+Bool_t AliEmcalContainer::AcceptObjectCached(Int_t i, UInt_t &rejectionReason) const
+{
+  if (!fUseAcceptCache) return AcceptObject(i, rejectionReason);
+  if (i < 0 || i >= GetNEntries()) {
+    rejectionReason |= kNullObject;
+    return kFALSE;
+  }
+  UpdateAcceptCache();
+  rejectionReason |= fRejectionReasons[i];
+  return fAcceptFlags[i];
 }
 
 /**
@@ -197,12 +256,17 @@ void AliEmcalContainer::NextEvent(const AliVEvent * event)
  * @return Number of accepted events in the container
  */
 Int_t AliEmcalContainer::GetNAcceptEntries() const{
-  Int_t result = 0;
-  for(int index = 0; index < GetNEntries(); index++){
-    UInt_t rejectionReason = 0;
-    if(AcceptObject(index, rejectionReason)) result++;
-  }
-  return result;
+  UpdateAcceptCache();
+  return fNAcceptEntries;
+}
+
+/**
+ * Indices of the accepted entries in the container
+ * @return Array of GetNAcceptEntries() indices, valid until the selection is evaluated again
+ */
+const Int_t *AliEmcalContainer::GetAcceptIndices() const{
+  UpdateAcceptCache();
+  return fAcceptIndices.GetArray();
 }
 
 /**
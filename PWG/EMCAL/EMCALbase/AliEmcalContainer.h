@@ -12,6 +12,8 @@ class AliNamedArrayI;
 class AliVParticle;
 
 #include <TNamed.h>
+#include <TArrayC.h>
+#include <TArrayI.h>
 #include <TClonesArray.h>
 
 #if !(defined(__CINT__) || defined(__MAKECINT__))
@@ -70,6 +72,15 @@ typedef EMCALIterableContainer::AliEmcalIterableContainerT<TObject, EMCALIterabl
  * }
  * ~~~
  *
+ * With SetUseAcceptCache() the selection of all entries is evaluated once per event, the
+ * first time it is needed, and cached: the iterators over accepted entries, GetNAcceptEntries()
+ * and the GetAccept... getters of the derived containers read the cached result. The cache is
+ * invalidated when the event changes (NextEvent(), or a new entry of the analysis manager) and
+ * when the number of entries changes. A task switching the cache on has to call
+ * ResetAcceptCache() whenever it changes the cuts, or modifies the objects (e.g. sets matched
+ * jets), in the middle of an event. The cache is off by default; the AddTask functions of the
+ * jet finder (AliEmcalJetTask) and of the rho tasks switch it on for their containers.
+ *
  * The usage of EMCAL containers is described under \subpage EMCALcontainers
  */
 class AliEmcalContainer : public TObject {
@@ -150,7 +161,12 @@ class AliEmcalContainer : public TObject {
   virtual Bool_t              GetNextAcceptMomentum(TLorentzVector &mom) = 0;
   virtual Bool_t              AcceptObject(Int_t i, UInt_t &rejectionReason) const = 0;
   virtual Bool_t              AcceptObject(const TObject* obj, UInt_t &rejectionReason) const = 0;
+  Bool_t                      AcceptObjectCached(Int_t i, UInt_t &rejectionReason) const;
   Int_t                       GetNAcceptEntries() const;
+  const Int_t                *GetAcceptIndices() const;
+  void                        ResetAcceptCache()                    { fNAcceptEntries = -1              ; }
+  void                        SetUseAcceptCache(Bool_t b=kTRUE)     { fUseAcceptCache = b ; ResetAcceptCache(); }
+  Bool_t                      GetUseAcceptCache()             const { return fUseAcceptCache            ; }
   void                        ResetCurrentID(Int_t i=-1)            { fCurrentID = i                    ; }
   virtual void                SetArray(const AliVEvent *event);
   void                        SetArrayName(const char *n)           { fClArrayName = n                  ; }
@@ -203,6 +219,7 @@ class AliEmcalContainer : public TObject {
    */
   virtual TString             GetDefaultArrayName(const AliVEvent * const ev) const { return ""; }
   void                        GetVertexFromEvent(const AliVEvent * event);
+  void                        UpdateAcceptCache() const;
 
   TString                     fName;                    ///< object name
   TString                     fClArrayName;             ///< name of branch
@@ -221,11 +238,17 @@ class AliEmcalContainer : public TObject {
   Int_t                       fMaxMCLabel;              ///< maximum MC label
   Double_t                    fMassHypothesis;          ///< if < 0 it will use a PID mass when available
   Bool_t                      fIsEmbedding;             ///< if true, this container will connect to an external event
+  Bool_t                      fUseAcceptCache;          ///< if true, the selection of the entries is cached for the current event
   TClonesArray               *fClArray;                 //!<! Pointer to array in input event
   Int_t                       fCurrentID;               //!<! current ID for automatic loops
   AliNamedArrayI             *fLabelMap;                //!<! Label-Index map
   Double_t                    fVertex[3];               //!<! event vertex array
   TClass                     *fLoadedClass;             //!<! Class of the objects contained in the TClonesArray
+  mutable TArrayC             fAcceptFlags;             //!<! cached selection of each entry
+  mutable TArrayI             fRejectionReasons;        //!<! cached rejection reason of each entry
+  mutable TArrayI             fAcceptIndices;           //!<! cached indices of the accepted entries (first fNAcceptEntries)
+  mutable Int_t               fNAcceptEntries;          //!<! cached number of accepted entries, -1 if the cache is not valid
+  mutable Long64_t            fAcceptCacheEntry;        //!<! analysis manager entry of the cached selection
 
  private:
   TString                     fClassName;               ///< name of the class in the TClonesArray
@@ -234,7 +257,7 @@ class AliEmcalContainer : public TObject {
   AliEmcalContainer& operator=(const AliEmcalContainer& other); // assignment
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalContainer,9);
+  ClassDef(AliEmcalContainer,10);
   /// \endcond
 };
 #endif
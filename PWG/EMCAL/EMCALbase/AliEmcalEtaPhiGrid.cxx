@@ -0,0 +1,253 @@
+/************************************************************************************
+ * Copyright (C) 2018, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <TMath.h>
+#include <TRandom3.h>
+#include <TVector2.h>
+#include "AliEmcalEtaPhiGrid.h"
+
+/// \cond CLASSIMP
+ClassImp(PWG::EMCAL::AliEmcalEtaPhiGrid)
+ClassImp(PWG::EMCAL::TestAliEmcalEtaPhiGrid)
+/// \endcond
+
+using namespace PWG::EMCAL;
+
+const double AliEmcalEtaPhiGrid::kMinCellSize = 0.02;
+
+AliEmcalEtaPhiGrid::AliEmcalEtaPhiGrid() :
+  TObject(),
+  fNObjects(0),
+  fNCellsEta(0),
+  fNCellsPhi(0),
+  fEtaMin(0.),
+  fCellSizeEta(1.),
+  fCellSizePhi(TMath::TwoPi()),
+  fCellStart(),
+  fCellContent(),
+  fObjectCell(),
+  fUnbinned()
+{
+
+}
+
+void AliEmcalEtaPhiGrid::Build(const std::vector<double> &eta, const std::vector<double> &phi, double maxdistance) {
+  // Cells are slightly larger than the maximum distance so that rounding
+  // can never move a matching object beyond the neighbouring cell
+  double cellsize = std::max(1.01 * maxdistance, kMinCellSize);
+  const int kMaxCellsEta = 1000;
+
+  fNObjects = eta.size();
+  fObjectCell.resize(fNObjects);
+  fUnbinned.clear();
+
+  double etamin = std::numeric_limits<double>::max(), etamax = -std::numeric_limits<double>::max();
+  int nfinite = 0;
+  for(int iobj = 0; iobj < fNObjects; iobj++) {
+    if(!(std::isfinite(eta[iobj]) && std::isfinite(phi[iobj]))) continue;
+    etamin = std::min(etamin, eta[iobj]);
+    etamax = std::max(etamax, eta[iobj]);
+    nfinite++;
+  }
+  // For few objects larger cells are cheaper: not more than ~4 cells per object
+  if(nfinite) cellsize = std::max(cellsize, std::sqrt((etamax - etamin + cellsize) * TMath::TwoPi() / (4. * nfinite)));
+
+  if(etamin > etamax) {
+    // no object at a finite position
+    fNCellsEta = fNCellsPhi = 0;
+  } else {
+    fEtaMin = etamin;
+    fCellSizeEta = std::max(cellsize, (etamax - etamin) / kMaxCellsEta);
+    fNCellsEta = static_cast<int>((etamax - etamin) / fCellSizeEta) + 1;
+    // phi is periodic: with less than 3 cells the neighbours of a cell would be the cell itself
+    fNCellsPhi = static_cast<int>(TMath::TwoPi() / cellsize);
+    if(fNCellsPhi < 3) fNCellsPhi = 1;
+    fCellSizePhi = TMath::TwoPi() / fNCellsPhi;
+  }
+
+  // Counting sort of the objects into the cells
+  const int ncells = fNCellsEta * fNCellsPhi;
+  fCellStart.assign(ncells + 1, 0);
+  for(int iobj = 0; iobj < fNObjects; iobj++) {
+    if(!(std::isfinite(eta[iobj]) && std::isfinite(phi[iobj]))) {
+      fObjectCell[iobj] = -1;
+      fUnbinned.push_back(iobj);
+      continue;
+    }
+    int cell = CellEta(eta[iobj]) * fNCellsPhi + CellPhi(phi[iobj]);
+    fObjectCell[iobj] = cell;
+    fCellStart[cell + 1]++;
+  }
+  for(int icell = 0; icell < ncells; icell++) fCellStart[icell + 1] += fCellStart[icell];
+  fCellContent.resize(fCellStart[ncells]);
+  std::vector<int> fill(fCellStart.begin(), fCellStart.end() - 1);
+  for(int iobj = 0; iobj < fNObjects; iobj++) {
+    if(fObjectCell[iobj] < 0) continue;
+    fCellContent[fill[fObjectCell[iobj]]++] = iobj;
+  }
+}
+
+void AliEmcalEtaPhiGrid::FindCandidates(double eta, double phi, std::vector<int> &candidates) const {
+  candidates.clear();
+  if(!(std::isfinite(eta) && std::isfinite(phi))) {
+    // the distance to a non-finite position cannot be bound, all objects are candidates
+    for(int iobj = 0; iobj < fNObjects; iobj++) candidates.push_back(iobj);
+    return;
+  }
+
+  if(fNCellsEta) {
+    const double celleta = std::floor((eta - fEtaMin) / fCellSizeEta);
+    if(celleta >= -1. && celleta <= fNCellsEta) {
+      const int ceta = static_cast<int>(celleta), cphi = CellPhi(phi);
+      const int nphi = fNCellsPhi > 1 ? 3 : 1;
+      for(int ieta = std::max(ceta - 1, 0); ieta <= std::min(ceta + 1, fNCellsEta - 1); ieta++) {
+        for(int dphi = 0; dphi < nphi; dphi++) {
+          const int iphi = (cphi + dphi + fNCellsPhi - 1) % fNCellsPhi;
+          const int cell = ieta * fNCellsPhi + iphi;
+          candidates.insert(candidates.end(), fCellContent.begin() + fCellStart[cell], fCellContent.begin() + fCellStart[cell + 1]);
+        }
+      }
+    }
+  }
+  candidates.insert(candidates.end(), fUnbinned.begin(), fUnbinned.end());
+}
+
+int AliEmcalEtaPhiGrid::CellEta(double eta) const {
+  int cell = static_cast<int>((eta - fEtaMin) / fCellSizeEta);
+  return std::min(std::max(cell, 0), fNCellsEta - 1);
+}
+
+int AliEmcalEtaPhiGrid::CellPhi(double phi) const {
+  double phimod = std::fmod(phi, TMath::TwoPi());
+  if(phimod < 0) phimod += TMath::TwoPi();
+  int cell = static_cast<int>(phimod / fCellSizePhi);
+  return std::min(std::max(cell, 0), fNCellsPhi - 1);
+}
+
+bool TestAliEmcalEtaPhiGrid::RunAllTests() const {
+  return TestRandom() && TestBoundaries() && TestLargeDistance();
+}
+
+bool TestAliEmcalEtaPhiGrid::TestRandom() const {
+  const int kMultiplicities[] = {0, 1, 10, 100, 1000, 5000};
+  const double kDistances[] = {0.0, 0.01, 0.025, 0.1, 0.3};
+  TRandom3 rng(1234);
+  int failure(0);
+  for(auto mult : kMultiplicities) {
+    for(auto dist : kDistances) {
+      std::vector<double> clustereta(mult), clusterphi(mult), tracketa(mult), trackphi(mult);
+      for(int i = 0; i < mult; i++) {
+        clustereta[i] = rng.Uniform(-0.7, 0.7);
+        clusterphi[i] = rng.Uniform(1.4, 5.7);
+        tracketa[i] = rng.Uniform(-0.75, 0.75);
+        trackphi[i] = rng.Uniform(1.35, 5.75);
+      }
+      if(!AssertSameMatches(clustereta, clusterphi, tracketa, trackphi, dist)) {
+        std::cout << "Random test failed for multiplicity " << mult << " and distance " << dist << std::endl;
+        failure++;
+      }
+    }
+  }
+  return failure == 0;
+}
+
+bool TestAliEmcalEtaPhiGrid::TestBoundaries() const {
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  TRandom3 rng(4321);
+  std::vector<double> clustereta, clusterphi, tracketa, trackphi;
+  for(int i = 0; i < 500; i++) {
+    // phi around 0 = 2pi in different conventions
+    clustereta.push_back(rng.Uniform(-0.1, 0.1));
+    clusterphi.push_back(rng.Uniform(-0.2, 0.2));
+    tracketa.push_back(rng.Uniform(-0.1, 0.1));
+    trackphi.push_back(rng.Uniform(-0.2, 0.2) + (i % 2 ? TMath::TwoPi() : 0.));
+  }
+  clustereta.push_back(nan);
+  clusterphi.push_back(0.);
+  clustereta.push_back(0.);
+  clusterphi.push_back(nan);
+  tracketa.push_back(nan);
+  trackphi.push_back(0.);
+  tracketa.push_back(0.);
+  trackphi.push_back(TMath::Pi());
+  tracketa.push_back(0.);
+  trackphi.push_back(-TMath::Pi());
+  bool testresult(true);
+  for(auto dist : {0.01, 0.1}) {
+    if(!AssertSameMatches(clustereta, clusterphi, tracketa, trackphi, dist)) testresult = false;
+  }
+  if(!testresult) std::cout << "Boundary test failed" << std::endl;
+  return testresult;
+}
+
+bool TestAliEmcalEtaPhiGrid::TestLargeDistance() const {
+  TRandom3 rng(5678);
+  std::vector<double> clustereta(200), clusterphi(200), tracketa(200), trackphi(200);
+  for(int i = 0; i < 200; i++) {
+    clustereta[i] = rng.Uniform(-0.7, 0.7);
+    clusterphi[i] = rng.Uniform(-TMath::Pi(), TMath::Pi());
+    tracketa[i] = rng.Uniform(-0.7, 0.7);
+    trackphi[i] = rng.Uniform(-TMath::Pi(), TMath::Pi());
+  }
+  bool testresult(true);
+  for(auto dist : {1., 2.5, 5.}) {
+    if(!AssertSameMatches(clustereta, clusterphi, tracketa, trackphi, dist)) testresult = false;
+  }
+  if(!testresult) std::cout << "Large distance test failed" << std::endl;
+  return testresult;
+}
+
+bool TestAliEmcalEtaPhiGrid::AssertSameMatches(const std::vector<double> &clustereta, const std::vector<double> &clusterphi,
+                                               const std::vector<double> &tracketa, const std::vector<double> &trackphi, double maxdistance) const {
+  // Distance as in AliEmcalCorrectionComponent::GetEtaPhiDiff, a NaN distance counts as match
+  auto matches = [&](int itrk, int icl) {
+    double deta = tracketa[itrk] - clustereta[icl], dphi = trackphi[itrk] - clusterphi[icl];
+    if(std::isfinite(dphi)) dphi = TVector2::Phi_mpi_pi(dphi);
+    return !(deta * deta + dphi * dphi > maxdistance * maxdistance);
+  };
+
+  AliEmcalEtaPhiGrid grid;
+  grid.Build(clustereta, clusterphi, maxdistance);
+  std::vector<int> candidates, bruteforce, fromgrid;
+  for(size_t itrk = 0; itrk < tracketa.size(); itrk++) {
+    bruteforce.clear();
+    for(size_t icl = 0; icl < clustereta.size(); icl++) {
+      if(matches(itrk, icl)) bruteforce.push_back(icl);
+    }
+    fromgrid.clear();
+    grid.FindCandidates(tracketa[itrk], trackphi[itrk], candidates);
+    for(auto icl : candidates) {
+      if(matches(itrk, icl)) fromgrid.push_back(icl);
+    }
+    std::sort(fromgrid.begin(), fromgrid.end());
+    if(bruteforce != fromgrid) return false;
+  }
+  return true;
+}
@@ -0,0 +1,171 @@
+/************************************************************************************
+ * Copyright (C) 2018, Copyright Holders of the ALICE Collaboration                 *
+ * All rights reserved.                                                             *
+ *                                                                                  *
+ * Redistribution and use in source and binary forms, with or without               *
+ * modification, are permitted provided that the following conditions are met:      *
+ *     * Redistributions of source code must retain the above copyright             *
+ *       notice, this list of conditions and the following disclaimer.              *
+ *     * Redistributions in binary form must reproduce the above copyright          *
+ *       notice, this list of conditions and the following disclaimer in the        *
+ *       documentation and/or other materials provided with the distribution.       *
+ *     * Neither the name of the <organization> nor the                             *
+ *       names of its contributors may be used to endorse or promote products       *
+ *       derived from this software without specific prior written permission.      *
+ *                                                                                  *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND  *
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED    *
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE           *
+ * DISCLAIMED. IN NO EVENT SHALL ALICE COLLABORATION BE LIABLE FOR ANY              *
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES       *
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;     *
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND      *
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT       *
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS    *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.                     *
+ ************************************************************************************/
+#ifndef ALIEMCALETAPHIGRID_H
+#define ALIEMCALETAPHIGRID_H
+
+#include <TObject.h>
+#include <vector>
+
+namespace PWG {
+
+namespace EMCAL {
+
+/**
+ * @class AliEmcalEtaPhiGrid
+ * @brief Spatial index of objects in the \f$\eta\f$-\f$\varphi\f$ plane
+ * @ingroup EMCALCOREFW
+ * @since Mar 12, 2018
+ *
+ * Objects (i.e. clusters) are sorted into square cells of the \f$\eta\f$-\f$\varphi\f$
+ * plane, with a cell size of at least the maximum matching distance. All objects
+ * within the matching distance of a given position are therefore found in the
+ * cell of the position or in one of its 8 neighbours (\f$\varphi\f$ is periodic).
+ * The grid is meant to be built once per event with Build and then queried
+ * for each track with FindCandidates:
+ * ~~~{.cxx}
+ * grid.Build(clustereta, clusterphi, maxdistance);
+ * for(auto trk : tracks) {
+ *   grid.FindCandidates(trk->GetTrackEtaOnEMCal(), trk->GetTrackPhiOnEMCal(), candidates);
+ *   for(auto icl : candidates) {
+ *     // exact distance test
+ *   }
+ * }
+ * ~~~
+ * The candidates are a superset of the objects within the matching distance, the
+ * exact test must still be applied by the user. Candidates are grouped by cell and
+ * not sorted by index: users depending on the order of the matches have to sort the
+ * (few) matches found. Objects at non-finite positions are candidates for every
+ * query, and queries at non-finite positions return all objects.
+ */
+class AliEmcalEtaPhiGrid : public TObject {
+public:
+  AliEmcalEtaPhiGrid();
+  virtual ~AliEmcalEtaPhiGrid() {}
+
+  /**
+   * @brief Sort objects into the grid
+   *
+   * Replaces the content from the previous call
+   * @param[in] eta Pseudorapidity of the objects
+   * @param[in] phi Azimuthal angle of the objects (any range)
+   * @param[in] maxdistance Maximum distance in the \f$\eta\f$-\f$\varphi\f$ plane for which objects must be found
+   */
+  void Build(const std::vector<double> &eta, const std::vector<double> &phi, double maxdistance);
+
+  /**
+   * @brief Find all objects which can be within the maximum distance of a given position
+   * @param[in] eta Pseudorapidity of the position
+   * @param[in] phi Azimuthal angle of the position (any range)
+   * @param[out] candidates Indices of the candidate objects (not sorted)
+   */
+  void FindCandidates(double eta, double phi, std::vector<int> &candidates) const;
+
+  int GetNumberOfObjects() const { return fNObjects; }
+  int GetNumberOfCellsEta() const { return fNCellsEta; }
+  int GetNumberOfCellsPhi() const { return fNCellsPhi; }
+
+  /// Minimum cell size, keeps the number of cells small for very small matching distances
+  static const double kMinCellSize;
+
+private:
+  int CellEta(double eta) const;
+  int CellPhi(double phi) const;
+
+  int                   fNObjects;          //!<! Number of objects in the grid
+  int                   fNCellsEta;         //!<! Number of cells in eta
+  int                   fNCellsPhi;         //!<! Number of cells in phi
+  double                fEtaMin;            //!<! Lower eta edge of the grid
+  double                fCellSizeEta;       //!<! Cell size in eta
+  double                fCellSizePhi;       //!<! Cell size in phi
+  std::vector<int>      fCellStart;         //!<! Index of the first object of each cell in fCellContent (+ end marker)
+  std::vector<int>      fCellContent;       //!<! Object indices ordered by cell, ascending within the cell
+  std::vector<int>      fObjectCell;        //!<! Cell of each object (-1 for objects at non-finite positions)
+  std::vector<int>      fUnbinned;          //!<! Objects at non-finite positions
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalEtaPhiGrid, 1);
+  /// \endcond
+};
+
+/**
+ * @class TestAliEmcalEtaPhiGrid
+ * @brief Unit test for class AliEmcalEtaPhiGrid
+ * @ingroup EMCALCOREFW
+ * @since Mar 12, 2018
+ *
+ * Compares matches found using the grid candidates with matches
+ * found by testing all pairs, for random positions at several
+ * multiplicities and matching distances, including positions at
+ * the \f$\varphi\f$ boundary and non-finite positions.
+ */
+class TestAliEmcalEtaPhiGrid : public TObject {
+public:
+  TestAliEmcalEtaPhiGrid() {}
+  virtual ~TestAliEmcalEtaPhiGrid() {}
+
+  /**
+   * @brief Run test suite
+   * @return true All tests passed
+   * @return false At least one test failed
+   */
+  bool RunAllTests() const;
+
+  /**
+   * @brief Test random positions in the EMCal/DCal acceptance
+   * @return true Test passed
+   * @return false Test failed
+   */
+  bool TestRandom() const;
+
+  /**
+   * @brief Test positions close to the \f$\varphi\f$ boundary and non-finite positions
+   * @return true Test passed
+   * @return false Test failed
+   */
+  bool TestBoundaries() const;
+
+  /**
+   * @brief Test matching distances of the order of the full acceptance
+   * @return true Test passed
+   * @return false Test failed
+   */
+  bool TestLargeDistance() const;
+
+private:
+  bool AssertSameMatches(const std::vector<double> &clustereta, const std::vector<double> &clusterphi,
+                         const std::vector<double> &tracketa, const std::vector<double> &trackphi, double maxdistance) const;
+
+  /// \cond CLASSIMP
+  ClassDef(TestAliEmcalEtaPhiGrid, 1);
+  /// \endcond
+};
+
+}
+
+}
+
+#endif
@@ -266,7 +266,7 @@ AliVTrack* AliTrackContainer::GetAcceptTrack(Int_t i) const
 {
   UInt_t rejectionReason;
   if (i == -1) i = fCurrentID;
-  if (AcceptTrack(i, rejectionReason)) {
+  if (AcceptObjectCached(i, rejectionReason)) {
       return GetTrack(i);
   }
   else {
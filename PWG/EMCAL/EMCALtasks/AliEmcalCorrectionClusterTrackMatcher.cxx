@@ -3,8 +3,13 @@
 
 #include "AliEmcalCorrectionClusterTrackMatcher.h"
 
+#include <algorithm>
+#include <limits>
+
 #include <TH1.h>
 #include <TList.h>
+#include <TVector2.h>
+#include <TVector3.h>
 
 #include "AliClusterContainer.h"
 #include "AliParticleContainer.h"
@@ -39,6 +44,11 @@ AliEmcalCorrectionClusterTrackMatcher::AliEmcalCorrectionClusterTrackMatcher() :
   fUpdateClusters(kTRUE),
   fClusterContainerIndexMap(),
   fParticleContainerIndexMap(),
+  fClusterGrid(),
+  fClusterEta(),
+  fClusterPhi(),
+  fMatchCandidates(),
+  fMatchedClusters(),
   fEmcalTracks(0),
   fEmcalClusters(0),
   fNEmcalTracks(0),
@@ -368,20 +378,54 @@ void AliEmcalCorrectionClusterTrackMatcher::DoMatching()
 {
   const Double_t maxd2 = fMaxDistance*fMaxDistance;
 
+  // Cluster positions are needed for every track, calculate them once (as in GetEtaPhiDiff)
+  fClusterEta.resize(fNEmcalClusters);
+  fClusterPhi.resize(fNEmcalClusters);
+  for (Int_t icluster = 0; icluster < fNEmcalClusters; icluster++) {
+    AliEmcalParticle* emcalCluster = static_cast<AliEmcalParticle*>(fEmcalClusters->At(icluster));
+    AliVCluster* cluster = emcalCluster->GetCluster();
+    if (!cluster) {
+      // never matched (as in GetEtaPhiDiff), skipped below
+      fClusterEta[icluster] = fClusterPhi[icluster] = std::numeric_limits<double>::quiet_NaN();
+      continue;
+    }
+    Float_t pos[3] = {0};
+    cluster->GetPosition(pos);
+    TVector3 cpos(pos);
+    fClusterEta[icluster] = cpos.Eta();
+    fClusterPhi[icluster] = cpos.Phi();
+  }
+  fClusterGrid.Build(fClusterEta, fClusterPhi, fMaxDistance);
+
   for (Int_t itrack = 0; itrack < fNEmcalTracks; itrack++) {
     AliEmcalParticle* emcalTrack = static_cast<AliEmcalParticle*>(fEmcalTracks->At(itrack));
     AliVTrack* track = emcalTrack->GetTrack();
+    if (!track) continue;
+    Double_t veta = track->GetTrackEtaOnEMCal();
+    Double_t vphi = track->GetTrackPhiOnEMCal();
+
+    // Only clusters in the neighbouring grid cells can be within the maximum distance
+    fClusterGrid.FindCandidates(veta, vphi, fMatchCandidates);
+    fMatchedClusters.clear();
+    for (std::vector<int>::const_iterator icand = fMatchCandidates.begin(); icand != fMatchCandidates.end(); ++icand) {
+      if (!static_cast<AliEmcalParticle*>(fEmcalClusters->At(*icand))->GetCluster()) continue;
+      Double_t deta = veta - fClusterEta[*icand];
+      Double_t dphi = TVector2::Phi_mpi_pi(vphi - fClusterPhi[*icand]);
+      Double_t d2 = deta * deta + dphi * dphi;
+      if (d2 > maxd2) continue;
+      fMatchedClusters.push_back(*icand);
+    }
 
-    for (Int_t icluster = 0; icluster < fNEmcalClusters; icluster++) {
+    // Candidates are not ordered: add the matches in cluster order, as when testing all clusters
+    std::sort(fMatchedClusters.begin(), fMatchedClusters.end());
+    for (std::vector<int>::const_iterator imatch = fMatchedClusters.begin(); imatch != fMatchedClusters.end(); ++imatch) {
+      Int_t icluster = *imatch;
       AliEmcalParticle* emcalCluster = static_cast<AliEmcalParticle*>(fEmcalClusters->At(icluster));
       AliVCluster* cluster = emcalCluster->GetCluster();
       
-      Double_t deta = 999;
-      Double_t dphi = 999;
-      GetEtaPhiDiff(track, cluster, dphi, deta);
+      Double_t deta = veta - fClusterEta[icluster];
+      Double_t dphi = TVector2::Phi_mpi_pi(vphi - fClusterPhi[icluster]);
       Double_t d2 = deta * deta + dphi * dphi;
-
-      if (d2 > maxd2) continue;
       
       Double_t d = TMath::Sqrt(d2);
       emcalCluster->AddMatchedObj(itrack, d);
@@ -1,7 +1,10 @@
 #ifndef ALIEMCALCORRECTIONCLUSTERTRACKMATCHER_H
 #define ALIEMCALCORRECTIONCLUSTERTRACKMATCHER_H
 
+#include <vector>
+
 #include "AliEmcalCorrectionComponent.h"
+#include "AliEmcalEtaPhiGrid.h"
 
 #if !(defined(__CINT__) || defined(__MAKECINT__))
 #include "AliEmcalContainerIndexMap.h"
@@ -17,7 +20,7 @@ class AliVParticle;
  * @ingroup EMCALCOREFW
  * @brief Cluster-track matcher component in the EMCal correction framework.
  *
- * Tracks and clusters are matched using a simple geometrical algorithm. Multiple tracks can be matched to a single cluster; however only one cluster can be matched to a track. The default configuration of the task is such that it will attempt track propagation to the EMCal surface (440 cm) if the track is not already propagated. This means that the OCDB has to be loaded beforehand (e.g. using the CDBConnect task), as well as the geometry (handled automatically by AliEmcalCorrectionTask). This should usually work in both AOD and ESD events.
+ * Tracks and clusters are matched using a simple geometrical algorithm. To avoid testing all track-cluster pairs, the clusters are sorted into an \f$\eta\f$-\f$\varphi\f$ grid (PWG::EMCAL::AliEmcalEtaPhiGrid) once per event, and each track is only tested against the clusters in the neighbouring cells. The matches are identical to the ones obtained testing all pairs. Multiple tracks can be matched to a single cluster; however only one cluster can be matched to a track. The default configuration of the task is such that it will attempt track propagation to the EMCal surface (440 cm) if the track is not already propagated. This means that the OCDB has to be loaded beforehand (e.g. using the CDBConnect task), as well as the geometry (handled automatically by AliEmcalCorrectionTask). This should usually work in both AOD and ESD events.
  
  The number of tracks matched to a cluster can be retrieved using `cluster->GetNTracksMatched()`. Unfortunately the method to access the tracks matched to a cluster depend on the data format. For ESD clusters (AliESDCaloClusters):
  ~~~{.cxx}
@@ -94,6 +97,12 @@ class AliEmcalCorrectionClusterTrackMatcher : public AliEmcalCorrectionComponent
   AliEmcalContainerIndexMap <AliParticleContainer, AliVParticle> fParticleContainerIndexMap; //!<! Mapping between index and particle containers
 #endif
 
+  PWG::EMCAL::AliEmcalEtaPhiGrid fClusterGrid; //!<!eta-phi grid of the emcal clusters, built once per event
+  std::vector<double> fClusterEta;      //!<!eta of the emcal clusters
+  std::vector<double> fClusterPhi;      //!<!phi of the emcal clusters
+  std::vector<int> fMatchCandidates;    //!<!clusters close enough to the current track to be tested
+  std::vector<int> fMatchedClusters;    //!<!clusters matched to the current track
+
   TClonesArray *fEmcalTracks;           //!<!emcal tracks
   TClonesArray *fEmcalClusters;         //!<!emcal clusters
   Int_t         fNEmcalTracks;          //!<!number of emcal tracks
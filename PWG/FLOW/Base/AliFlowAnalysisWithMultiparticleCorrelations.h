@@ -30,6 +30,7 @@
 #include "TStopwatch.h"
 #include "AliFlowEventSimple.h"
 #include "AliFlowTrackSimple.h"
+#include "AliFlowGenericCorrelator.h"
 
 class AliFlowAnalysisWithMultiparticleCorrelations{
  public:
@@ -307,6 +308,8 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
   virtual TComplex Six(Int_t n1, Int_t n2, Int_t n3, Int_t n4, Int_t n5, Int_t n6);
   virtual TComplex Seven(Int_t n1, Int_t n2, Int_t n3, Int_t n4, Int_t n5, Int_t n6, Int_t n7);
   virtual TComplex Eight(Int_t n1, Int_t n2, Int_t n3, Int_t n4, Int_t n5, Int_t n6, Int_t n7, Int_t n8);
+  virtual void FillGenericCorrelator();
+  virtual TComplex GenericCorrelator(Int_t order, Int_t *harmonic);
   virtual TComplex OneDiff(Int_t n1);
   virtual TComplex TwoDiff(Int_t n1, Int_t n2);
   virtual TComplex ThreeDiff(Int_t n1, Int_t n2, Int_t n3);
@@ -403,6 +406,7 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
   Bool_t fCalculateOnlyForSC;         // calculate only correlations needed for 'standard candles'
   Bool_t fCalculateOnlyCos;           // calculate only 'cos' correlations
   Bool_t fCalculateOnlySin;           // calculate only 'sin' correlations
+  AliFlowGenericCorrelator *fGenericCorrelator; //! generic correlator with memoized sub-terms, used for 5-p,...,8-p correlations
 
   // 4.) Event-by-event cumulants:
   TList *fEbECumulantsList;         // list to hold all e-b-e cumulants objects
@@ -476,7 +480,7 @@ class AliFlowAnalysisWithMultiparticleCorrelations{
   Int_t fHighestHarmonicEtaGaps;      // 2-p correlations with eta gaps will be calculated for harmonics [fLowestHarmonicEtaGaps,fHighestHarmonicEtaGaps]
   TProfile *fEtaGapsPro[6];           // [harmonic] different eta gaps are different bins
 
-  ClassDef(AliFlowAnalysisWithMultiparticleCorrelations,6);
+  ClassDef(AliFlowAnalysisWithMultiparticleCorrelations,7);
 
 };
 
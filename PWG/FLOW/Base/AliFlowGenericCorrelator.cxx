@@ -0,0 +1,222 @@
+/*************************************************************************
+* Copyright(c) 1998-2008, ALICE Experiment at CERN, All rights reserved. *
+*                                                                        *
+* Author: The ALICE Off-line Project.                                    *
+* Contributors are mentioned in the code where appropriate.              *
+*                                                                        *
+* Permission to use, copy, modify and distribute this software and its   *
+* documentation strictly for non-commercial purposes is hereby granted   *
+* without fee, provided that the above copyright notice appears in all   *
+* copies and that both the copyright notice and this permission notice   *
+* appear in the supporting documentation. The authors make no claims     *
+* about the suitability of this software for any purpose. It is          *
+* provided "as is" without express or implied warranty.                  *
+**************************************************************************/
+
+/************************************************
+ * generic multi-particle correlator: any       *
+ * m-particle correlator (m <= 8) from table of *
+ * Q(n,p) components, sub-terms are memoized    *
+ * and shared between correlators in one event  *
+ ************************************************/
+
+#include "TMath.h"
+#include "AliFlowGenericCorrelator.h"
+
+ClassImp(AliFlowGenericCorrelator)
+
+AliFlowGenericCorrelator::AliFlowGenericCorrelator(Int_t maxHarmonic, Int_t maxCorrelator):
+ TObject(),
+ fMaxHarmonic(maxHarmonic),
+ fMaxCorrelator(maxCorrelator),
+ fMaxN(maxHarmonic*maxCorrelator),
+ fReQ(),
+ fImQ(),
+ fCacheIsValid(kFALSE),
+ fCache(),
+ fCacheRe(),
+ fCacheIm(),
+ fNCached(0)
+{
+ // Constructor.
+
+ if(fMaxHarmonic<0 || fMaxHarmonic>7){Fatal("AliFlowGenericCorrelator::AliFlowGenericCorrelator","fMaxHarmonic = %d is out of range",fMaxHarmonic);}
+ if(fMaxCorrelator<1 || fMaxCorrelator>kMaxOrder){Fatal("AliFlowGenericCorrelator::AliFlowGenericCorrelator","fMaxCorrelator = %d is out of range",fMaxCorrelator);}
+
+ fReQ.Set((fMaxN+1)*(fMaxCorrelator+1));
+ fImQ.Set((fMaxN+1)*(fMaxCorrelator+1));
+ fCacheRe.Set(256);
+ fCacheIm.Set(256);
+
+} // end of AliFlowGenericCorrelator::AliFlowGenericCorrelator(Int_t maxHarmonic, Int_t maxCorrelator)
+
+//================================================================================================================
+
+AliFlowGenericCorrelator::~AliFlowGenericCorrelator()
+{
+ // Destructor.
+
+} // end of AliFlowGenericCorrelator::~AliFlowGenericCorrelator()
+
+//================================================================================================================
+
+void AliFlowGenericCorrelator::Reset()
+{
+ // Reset Q-vector components before starting a new event.
+
+ fReQ.Reset();
+ fImQ.Reset();
+ fCacheIsValid = kFALSE;
+
+} // end of void AliFlowGenericCorrelator::Reset()
+
+//================================================================================================================
+
+void AliFlowGenericCorrelator::Fill(Double_t phi, Double_t weight)
+{
+ // Add one particle to Q-vector components, cos(n*phi) and sin(n*phi) are obtained by angle addition.
+
+ const Double_t dCos1 = TMath::Cos(phi);
+ const Double_t dSin1 = TMath::Sin(phi);
+ Double_t dCos = 1., dSin = 0.; // cos(n*phi) and sin(n*phi)
+ for(Int_t n=0;n<=fMaxN;n++)
+ {
+  Double_t wToPowerP = 1.;
+  Double_t *re = fReQ.GetArray()+n*(fMaxCorrelator+1);
+  Double_t *im = fImQ.GetArray()+n*(fMaxCorrelator+1);
+  for(Int_t p=0;p<=fMaxCorrelator;p++)
+  {
+   re[p] += wToPowerP*dCos;
+   im[p] += wToPowerP*dSin;
+   wToPowerP *= weight;
+  }
+  const Double_t dCosNext = dCos*dCos1-dSin*dSin1;
+  dSin = dSin*dCos1+dCos*dSin1;
+  dCos = dCosNext;
+ } // for(Int_t n=0;n<=fMaxN;n++)
+ fCacheIsValid = kFALSE;
+
+} // end of void AliFlowGenericCorrelator::Fill(Double_t phi, Double_t weight)
+
+//================================================================================================================
+
+void AliFlowGenericCorrelator::SetQvector(Int_t n, Int_t p, const TComplex &q)
+{
+ // Set Q-vector component Q(n,p) for n >= 0 (Q(-n,p) = Q(n,p)^* is used for negative harmonics).
+
+ if(n<0 || n>fMaxN || p<0 || p>fMaxCorrelator){Fatal("AliFlowGenericCorrelator::SetQvector","Q(%d,%d) is out of range",n,p);}
+
+ fReQ[n*(fMaxCorrelator+1)+p] = q.Re();
+ fImQ[n*(fMaxCorrelator+1)+p] = q.Im();
+ fCacheIsValid = kFALSE;
+
+} // end of void AliFlowGenericCorrelator::SetQvector(Int_t n, Int_t p, const TComplex &q)
+
+//================================================================================================================
+
+TComplex AliFlowGenericCorrelator::Q(Int_t n, Int_t p) const
+{
+ // Using the fact that Q{-n,p} = Q{n,p}^*.
+
+ if(n>=0){return TComplex(fReQ[n*(fMaxCorrelator+1)+p],fImQ[n*(fMaxCorrelator+1)+p]);}
+ return TComplex(fReQ[-n*(fMaxCorrelator+1)+p],-fImQ[-n*(fMaxCorrelator+1)+p]);
+
+} // end of TComplex AliFlowGenericCorrelator::Q(Int_t n, Int_t p) const
+
+//================================================================================================================
+
+TComplex AliFlowGenericCorrelator::Correlator(Int_t order, const Int_t *harmonic)
+{
+ // Generic order-particle correlation <exp[i(n1*phi1+...+nk*phik)]> (numerator, i.e. not normalized).
+ // The correlator is symmetric in the harmonics, so they are sorted and the result is kept for the rest of the event.
+
+ if(order<0 || order>fMaxCorrelator){Fatal("AliFlowGenericCorrelator::Correlator","order = %d is out of range",order);}
+
+ Int_t sorted[kMaxOrder] = {0};
+ Int_t nSumAbs = 0;
+ for(Int_t i=0;i<order;i++)
+ {
+  nSumAbs += TMath::Abs(harmonic[i]);
+  Int_t j = i;
+  for(;j>0 && sorted[j-1]>harmonic[i];j--){sorted[j] = sorted[j-1];}
+  sorted[j] = harmonic[i];
+ }
+ if(nSumAbs>fMaxN){Fatal("AliFlowGenericCorrelator::Correlator","sum of |harmonics| = %d is larger than %d",nSumAbs,fMaxN);}
+
+ return this->Calculate(order,sorted);
+
+} // end of TComplex AliFlowGenericCorrelator::Correlator(Int_t order, const Int_t *harmonic)
+
+//================================================================================================================
+
+void AliFlowGenericCorrelator::CalculateBatch(Int_t nCorrelators, const Int_t *order, const Int_t *harmonics, TComplex *results)
+{
+ // Calculate nCorrelators correlators at once, harmonics of correlator c are harmonics[c*kMaxOrder+i].
+ // Sub-terms common to several correlators are calculated only once.
+
+ for(Int_t c=0;c<nCorrelators;c++)
+ {
+  results[c] = this->Correlator(order[c],harmonics+c*kMaxOrder);
+ }
+
+} // end of void AliFlowGenericCorrelator::CalculateBatch(Int_t nCorrelators, const Int_t *order, const Int_t *harmonics, TComplex *results)
+
+//================================================================================================================
+
+TComplex AliFlowGenericCorrelator::Calculate(Int_t order, const Int_t *sorted)
+{
+ // N(S) = sum over blocks B containing the last harmonic of S of (-1)^{|B|-1} (|B|-1)! Q(sum_{B} n,|B|) N(S\B),
+ // where S is the set of harmonics and N({}) = 1. Harmonics must be sorted, removing some of them keeps the rest sorted.
+
+ static const Double_t dCoefficient[kMaxOrder] = {1.,-1.,2.,-6.,24.,-120.,720.,-5040.}; // (-1)^{k-1} (k-1)!, k = 1,...,8
+
+ if(0==order){return TComplex(1.,0.);}
+ if(1==order){return this->Q(sorted[0],1);}
+
+ if(!fCacheIsValid)
+ {
+  fCache.Delete();
+  fNCached = 0;
+  fCacheIsValid = kTRUE;
+ }
+
+ // key: order in lowest 4 bits, then 7 bits per harmonic (|n| <= fMaxN < 64):
+ ULong64_t key = 0;
+ for(Int_t i=0;i<order;i++){key = (key<<7)|(ULong64_t)(sorted[i]+64);}
+ key = (key<<4)|(ULong64_t)order;
+ Long64_t index = fCache.GetValue(key,(Long64_t)key);
+ if(index>0){return TComplex(fCacheRe[index-1],fCacheIm[index-1]);}
+
+ const Int_t last = order-1;
+ Int_t rest[kMaxOrder] = {0};
+ Double_t dRe = 0., dIm = 0.;
+ for(Int_t mask=0;mask<(1<<last);mask++)
+ {
+  Int_t nBlock = 1;
+  Int_t nRest = 0;
+  Int_t hBlock = sorted[last];
+  for(Int_t i=0;i<last;i++)
+  {
+   if(mask & (1<<i)){nBlock++; hBlock += sorted[i];}
+   else{rest[nRest++] = sorted[i];}
+  }
+  TComplex term = dCoefficient[nBlock-1]*this->Q(hBlock,nBlock)*this->Calculate(nRest,rest);
+  dRe += term.Re();
+  dIm += term.Im();
+ } // for(Int_t mask=0;mask<(1<<last);mask++)
+
+ if(fNCached>=fCacheRe.GetSize())
+ {
+  fCacheRe.Set(2*fCacheRe.GetSize());
+  fCacheIm.Set(2*fCacheIm.GetSize());
+ }
+ fCacheRe[fNCached] = dRe;
+ fCacheIm[fNCached] = dIm;
+ fNCached++;
+ fCache.Add(key,(Long64_t)key,fNCached);
+
+ return TComplex(dRe,dIm);
+
+} // end of TComplex AliFlowGenericCorrelator::Calculate(Int_t order, const Int_t *sorted)
+
+//================================================================================================================
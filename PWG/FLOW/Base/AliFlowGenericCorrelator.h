@@ -0,0 +1,65 @@
+/*
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved.
+ * See cxx source for full Copyright notice
+ * $Id$
+ */
+
+/************************************************
+ * generic multi-particle correlator: any       *
+ * m-particle correlator (m <= 8) from table of *
+ * Q(n,p) components, sub-terms are memoized    *
+ * and shared between correlators in one event  *
+ ************************************************/
+
+#ifndef ALIFLOWGENERICCORRELATOR_H
+#define ALIFLOWGENERICCORRELATOR_H
+
+#include "TObject.h"
+#include "TComplex.h"
+#include "TArrayD.h"
+#include "TExMap.h"
+
+class AliFlowGenericCorrelator: public TObject {
+ public:
+  enum {kMaxOrder = 8}; // not going beyond 8-p correlators
+
+  AliFlowGenericCorrelator(Int_t maxHarmonic = 6, Int_t maxCorrelator = 8);
+  virtual ~AliFlowGenericCorrelator();
+
+  void Reset();
+  void Fill(Double_t phi, Double_t weight = 1.);
+  void SetQvector(Int_t n, Int_t p, const TComplex &q);
+  TComplex Q(Int_t n, Int_t p) const;
+
+  TComplex Correlator(Int_t order, const Int_t *harmonic);
+  void CalculateBatch(Int_t nCorrelators, const Int_t *order, const Int_t *harmonics, TComplex *results);
+
+  Int_t GetMaxHarmonic() const {return this->fMaxHarmonic;};
+  Int_t GetMaxCorrelator() const {return this->fMaxCorrelator;};
+  Int_t GetNumberOfCachedTerms() const {return this->fNCached;};
+
+ private:
+  AliFlowGenericCorrelator(const AliFlowGenericCorrelator& gc);
+  AliFlowGenericCorrelator& operator=(const AliFlowGenericCorrelator& gc);
+
+  TComplex Calculate(Int_t order, const Int_t *sorted);
+
+  Int_t fMaxHarmonic; //! largest harmonic of a single particle
+  Int_t fMaxCorrelator; //! largest order of correlator = largest power of weights
+  Int_t fMaxN; //! largest harmonic in Q-vector table = fMaxHarmonic*fMaxCorrelator
+  TArrayD fReQ; //! [n][p] = sum_{i=1}^{M} w_{i}^{p} cos(n*phi_{i}), n = 0,...,fMaxN, p = 0,...,fMaxCorrelator
+  TArrayD fImQ; //! [n][p] = sum_{i=1}^{M} w_{i}^{p} sin(n*phi_{i})
+
+  // sub-terms N(n1,...,nk) computed in this event, keyed by sorted harmonics:
+  Bool_t fCacheIsValid; //! kFALSE after Q-vector table has changed
+  TExMap fCache; //! key => index in fCacheRe and fCacheIm (+1)
+  TArrayD fCacheRe; //! real parts of cached sub-terms
+  TArrayD fCacheIm; //! imaginary parts of cached sub-terms
+  Int_t fNCached; //! number of cached sub-terms
+
+  ClassDef(AliFlowGenericCorrelator, 1);
+};
+
+//================================================================================================================
+
+#endif
@@ -0,0 +1,386 @@
+/*************************************************************************
+* Copyright(c) 1998-2008, ALICE Experiment at CERN, All rights reserved. *
+*                                                                        *
+* Author: The ALICE Off-line Project.                                    *
+* Contributors are mentioned in the code where appropriate.              *
+*                                                                        *
+* Permission to use, copy, modify and distribute this software and its   *
+* documentation strictly for non-commercial purposes is hereby granted   *
+* without fee, provided that the above copyright notice appears in all   *
+* copies and that both the copyright notice and this permission notice   *
+* appear in the supporting documentation. The authors make no claims     *
+* about the suitability of this software for any purpose. It is          *
+* provided "as is" without express or implied warranty.                  *
+**************************************************************************/
+
+/************************************************
+ * e-b-e Q-vectors for flow analysis with       *
+ * Q-cumulants: tracks are buffered and         *
+ * processed in blocks into flat arrays,        *
+ * differential p/q-vectors are accumulated     *
+ * into flat per-bin arrays                     *
+ ************************************************/
+
+#include "TMath.h"
+#include "TAxis.h"
+#include "TProfile.h"
+#include "TProfile2D.h"
+#include "AliFlowQVectorEngine.h"
+
+ClassImp(AliFlowQVectorEngine)
+
+AliFlowQVectorEngine::AliFlowQVectorEngine():
+ TObject(),
+ fHarmonic(2),
+ fNTracks(0),
+ fPhi(),
+ fPt(),
+ fEta(),
+ fWeight(),
+ fType(),
+ fAxisPt2D(NULL)
+{
+ // constructor
+
+ for(Int_t a=0;a<3;a++)
+ {
+  fNBins[a] = 0;
+  fAxis[a] = NULL;
+  fNUsedBins[a] = 0;
+ }
+ this->Clear();
+
+} // end of constructor
+
+//================================================================================================================
+
+AliFlowQVectorEngine::~AliFlowQVectorEngine()
+{
+ // destructor
+
+} // end of AliFlowQVectorEngine::~AliFlowQVectorEngine()
+
+//================================================================================================================
+
+void AliFlowQVectorEngine::SetDiffFlowAxis(Int_t pe, const TAxis *axis)
+{
+ // Set binning of e-b-e 1D profiles in pt (pe = 0) or eta (pe = 1), NULL = not used.
+
+ fAxis[pe] = axis;
+ fNBins[pe] = axis ? axis->GetNbins()+2 : 0;
+ fDiffRe[pe].Set(fNBins[pe]*kNTypes*kNDiffMultiples*kNPowers);
+ fDiffIm[pe].Set(fNBins[pe]*kNTypes*kNDiffMultiples*kNPowers);
+ fDiffS[pe].Set(fNBins[pe]*kNTypes*kNPowers);
+ fDiffEntries[pe].Set(fNBins[pe]*kNTypes);
+ fBinUsed[pe].Set(fNBins[pe]);
+ fUsedBins[pe].Set(fNBins[pe]);
+ fDiffRe[pe].Reset();
+ fDiffIm[pe].Reset();
+ fDiffS[pe].Reset();
+ fDiffEntries[pe].Reset();
+ fBinUsed[pe].Reset();
+ fNUsedBins[pe] = 0;
+
+} // end of void AliFlowQVectorEngine::SetDiffFlowAxis(Int_t pe, const TAxis *axis)
+
+//================================================================================================================
+
+void AliFlowQVectorEngine::Set2DDiffFlowAxes(const TAxis *ptAxis, const TAxis *etaAxis)
+{
+ // Set binning of e-b-e 2D profiles, NULL = not used (global bin numbering as in TH2).
+
+ fAxis[2] = (ptAxis && etaAxis) ? etaAxis : NULL;
+ fAxisPt2D = fAxis[2] ? ptAxis : NULL;
+ Int_t nBins = fAxis[2] ? (ptAxis->GetNbins()+2)*(etaAxis->GetNbins()+2) : 0;
+ fNBins[2] = nBins;
+ fDiffRe[2].Set(nBins*kNTypes*kNDiffMultiples*kNPowers);
+ fDiffIm[2].Set(nBins*kNTypes*kNDiffMultiples*kNPowers);
+ fDiffS[2].Set(nBins*kNTypes*kNPowers);
+ fDiffEntries[2].Set(nBins*kNTypes);
+ fBinUsed[2].Set(nBins);
+ fUsedBins[2].Set(nBins);
+ fDiffRe[2].Reset();
+ fDiffIm[2].Reset();
+ fDiffS[2].Reset();
+ fDiffEntries[2].Reset();
+ fBinUsed[2].Reset();
+ fNUsedBins[2] = 0;
+
+} // end of void AliFlowQVectorEngine::Set2DDiffFlowAxes(const TAxis *ptAxis, const TAxis *etaAxis)
+
+//================================================================================================================
+
+void AliFlowQVectorEngine::Clear(Option_t * /*option*/)
+{
+ // Remove all tracks and reset e-b-e quantities (only bins filled in this event are reset).
+
+ fNTracks = 0;
+ for(Int_t i=0;i<kNMultiples*kNPowers;i++)
+ {
+  fReQ[i] = 0.;
+  fImQ[i] = 0.;
+ }
+ for(Int_t k=0;k<kNPowers;k++)
+ {
+  fS[k] = 0.;
+ }
+ for(Int_t a=0;a<3;a++)
+ {
+  for(Int_t u=0;u<fNUsedBins[a];u++)
+  {
+   Int_t b = fUsedBins[a][u];
+   for(Int_t i=b*kNTypes*kNDiffMultiples*kNPowers;i<(b+1)*kNTypes*kNDiffMultiples*kNPowers;i++)
+   {
+    fDiffRe[a][i] = 0.;
+    fDiffIm[a][i] = 0.;
+   }
+   for(Int_t i=b*kNTypes*kNPowers;i<(b+1)*kNTypes*kNPowers;i++)
+   {
+    fDiffS[a][i] = 0.;
+   }
+   for(Int_t t=0;t<kNTypes;t++)
+   {
+    fDiffEntries[a][b*kNTypes+t] = 0.;
+   }
+   fBinUsed[a][b] = 0;
+  }
+  fNUsedBins[a] = 0;
+ }
+
+} // end of void AliFlowQVectorEngine::Clear(Option_t *option)
+
+//================================================================================================================
+
+void AliFlowQVectorEngine::ResizeTracks(Int_t size)
+{
+ // Resize track buffers.
+
+ fPhi.Set(size);
+ fPt.Set(size);
+ fEta.Set(size);
+ fWeight.Set(size);
+ fType.Set(size);
+ for(Int_t a=0;a<3;a++)
+ {
+  fBin[a].Set(size);
+ }
+
+} // end of void AliFlowQVectorEngine::ResizeTracks(Int_t size)
+
+//================================================================================================================
+
+void AliFlowQVectorEngine::AddTrack(Double_t phi, Double_t pt, Double_t eta, Double_t weight, Bool_t isRP, Bool_t isPOI)
+{
+ // Add track to the buffer (weight is the product of all particle weights, 1 for POIs which are not RPs).
+
+ if(fNTracks >= fPhi.GetSize())
+ {
+  this->ResizeTracks(fNTracks > 0 ? 2*fNTracks : 1024);
+ }
+ fPhi[fNTracks] = phi;
+ fPt[fNTracks] = pt;
+ fEta[fNTracks] = eta;
+ fWeight[fNTracks] = weight;
+ fType[fNTracks] = (isRP ? 1 : 0) | (isPOI ? 2 : 0);
+ // the same bins as in TProfile::Fill (including underflow and overflow):
+ for(Int_t pe=0;pe<2;pe++)
+ {
+  if(fAxis[pe])
+  {
+   fBin[pe][fNTracks] = fAxis[pe]->FindFixBin(pe==0 ? pt : eta);
+  }
+ }
+ if(fAxis[2])
+ {
+  fBin[2][fNTracks] = fAxisPt2D->FindFixBin(pt) + (fAxisPt2D->GetNbins()+2)*fAxis[2]->FindFixBin(eta);
+ }
+ fNTracks++;
+
+} // end of void AliFlowQVectorEngine::AddTrack(...)
+
+//================================================================================================================
+
+void AliFlowQVectorEngine::Calculate()
+{
+ // Calculate Q-vectors for reference flow and p/q-vectors for differential flow of all buffered tracks.
+
+ for(Int_t first=0;first<fNTracks;first+=kBlockSize)
+ {
+  this->CalculateBlock(first,TMath::Min((Int_t)kBlockSize,fNTracks-first));
+ }
+
+} // end of void AliFlowQVectorEngine::Calculate()
+
+//================================================================================================================
+
+void AliFlowQVectorEngine::CalculateBlock(Int_t first, Int_t n)
+{
+ // Process n tracks starting from first. Loops over tracks are innermost, so that they can be vectorized.
+
+ const Double_t *phi = fPhi.GetArray()+first;
+ const Double_t *w = fWeight.GetArray()+first;
+ const Char_t *type = fType.GetArray()+first;
+
+ // a) cos and sin of all harmonics (only the first one is calculated explicitly, the rest with angle addition):
+ for(Int_t i=0;i<n;i++)
+ {
+  fCos[0][i] = TMath::Cos(fHarmonic*phi[i]);
+  fSin[0][i] = TMath::Sin(fHarmonic*phi[i]);
+ }
+ for(Int_t m=1;m<kNMultiples;m++)
+ {
+  for(Int_t i=0;i<n;i++)
+  {
+   fCos[m][i] = fCos[m-1][i]*fCos[0][i]-fSin[m-1][i]*fSin[0][i];
+   fSin[m][i] = fSin[m-1][i]*fCos[0][i]+fCos[m-1][i]*fSin[0][i];
+  }
+ }
+
+ // b) powers of particle weights:
+ for(Int_t i=0;i<n;i++)
+ {
+  fPow[0][i] = 1.;
+ }
+ for(Int_t k=1;k<kNPowers;k++)
+ {
+  for(Int_t i=0;i<n;i++)
+  {
+   fPow[k][i] = fPow[k-1][i]*w[i];
+  }
+ }
+
+ // c) Q_{m*n,k} and S_{1,k} for RPs:
+ Double_t wk[kBlockSize];
+ for(Int_t k=0;k<kNPowers;k++)
+ {
+  Double_t sum = 0.;
+  for(Int_t i=0;i<n;i++)
+  {
+   wk[i] = (type[i] & 1) ? fPow[k][i] : 0.;
+   sum += wk[i];
+  }
+  fS[k] += sum;
+  for(Int_t m=0;m<kNMultiples;m++)
+  {
+   Double_t re = 0.;
+   Double_t im = 0.;
+   for(Int_t i=0;i<n;i++)
+   {
+    re += wk[i]*fCos[m][i];
+    im += wk[i]*fSin[m][i];
+   }
+   fReQ[m*kNPowers+k] += re;
+   fImQ[m*kNPowers+k] += im;
+  }
+ }
+
+ // d) r_{m*n,k}, p_{m*n,k} and q_{m*n,k} and s_{p,k} in bins:
+ for(Int_t a=0;a<3;a++)
+ {
+  if(!fNBins[a]){continue;}
+  const Int_t *bin = fBin[a].GetArray()+first;
+  Double_t *diffRe = fDiffRe[a].GetArray();
+  Double_t *diffIm = fDiffIm[a].GetArray();
+  Double_t *diffS = fDiffS[a].GetArray();
+  Double_t *diffEntries = fDiffEntries[a].GetArray();
+  for(Int_t i=0;i<n;i++)
+  {
+   Int_t b = bin[i];
+   if(!fBinUsed[a][b])
+   {
+    fBinUsed[a][b] = 1;
+    fUsedBins[a][fNUsedBins[a]++] = b;
+   }
+   for(Int_t t=0;t<kNTypes;t++) // 0 = RP, 1 = POI, 2 = RP&&POI
+   {
+    Bool_t inType = (t==0 && (type[i] & 1)) || (t==1 && (type[i] & 2)) || (t==2 && (type[i] & 3) == 3);
+    if(!inType){continue;}
+    Int_t index = b*kNTypes+t;
+    diffEntries[index] += 1.;
+    for(Int_t k=0;k<kNPowers;k++)
+    {
+     diffS[index*kNPowers+k] += fPow[k][i];
+    }
+    Double_t *re = diffRe+index*kNDiffMultiples*kNPowers;
+    Double_t *im = diffIm+index*kNDiffMultiples*kNPowers;
+    for(Int_t m=0;m<kNDiffMultiples;m++)
+    {
+     for(Int_t k=0;k<kNPowers;k++)
+     {
+      re[m*kNPowers+k] += fPow[k][i]*fCos[m][i];
+      im[m*kNPowers+k] += fPow[k][i]*fSin[m][i];
+     }
+    }
+   } // end of for(Int_t t=0;t<kNTypes;t++)
+  } // end of for(Int_t i=0;i<n;i++)
+ } // end of for(Int_t a=0;a<3;a++)
+
+} // end of void AliFlowQVectorEngine::CalculateBlock(Int_t first, Int_t n)
+
+//================================================================================================================
+
+void AliFlowQVectorEngine::FillDiffFlowProfiles(Int_t t, Int_t pe, TProfile *re[][kNPowers], TProfile *im[][kNPowers], TProfile **s) const
+{
+ // Store accumulated sums of type t in e-b-e 1D profiles in pt (pe = 0) or eta (pe = 1) as if they were filled
+ // track by track with weight 1. Only bin contents and bin entries are set (bin errors are not used for e-b-e profiles).
+ // s can be NULL (s_{p,k} is not needed for POIs).
+
+ if(!fNBins[pe]){return;}
+ for(Int_t u=0;u<fNUsedBins[pe];u++)
+ {
+  Int_t b = fUsedBins[pe][u];
+  Int_t index = b*kNTypes+t;
+  Double_t entries = fDiffEntries[pe][index];
+  if(entries == 0.){continue;}
+  for(Int_t m=0;m<kNDiffMultiples;m++)
+  {
+   for(Int_t k=0;k<kNPowers;k++)
+   {
+    re[m][k]->GetArray()[b] = fDiffRe[pe][(index*kNDiffMultiples+m)*kNPowers+k];
+    re[m][k]->SetBinEntries(b,entries);
+    im[m][k]->GetArray()[b] = fDiffIm[pe][(index*kNDiffMultiples+m)*kNPowers+k];
+    im[m][k]->SetBinEntries(b,entries);
+   }
+  }
+  if(!s){continue;}
+  for(Int_t k=0;k<kNPowers;k++)
+  {
+   s[k]->GetArray()[b] = fDiffS[pe][index*kNPowers+k];
+   s[k]->SetBinEntries(b,entries);
+  }
+ }
+
+} // end of void AliFlowQVectorEngine::FillDiffFlowProfiles(...)
+
+//================================================================================================================
+
+void AliFlowQVectorEngine::Fill2DDiffFlowProfiles(Int_t t, TProfile2D *re[][kNPowers], TProfile2D *im[][kNPowers], TProfile2D **s) const
+{
+ // Store accumulated sums of type t in e-b-e 2D profiles (see FillDiffFlowProfiles).
+
+ if(!fNBins[2]){return;}
+ for(Int_t u=0;u<fNUsedBins[2];u++)
+ {
+  Int_t b = fUsedBins[2][u];
+  Int_t index = b*kNTypes+t;
+  Double_t entries = fDiffEntries[2][index];
+  if(entries == 0.){continue;}
+  for(Int_t m=0;m<kNDiffMultiples;m++)
+  {
+   for(Int_t k=0;k<kNPowers;k++)
+   {
+    re[m][k]->GetArray()[b] = fDiffRe[2][(index*kNDiffMultiples+m)*kNPowers+k];
+    re[m][k]->SetBinEntries(b,entries);
+    im[m][k]->GetArray()[b] = fDiffIm[2][(index*kNDiffMultiples+m)*kNPowers+k];
+    im[m][k]->SetBinEntries(b,entries);
+   }
+  }
+  if(!s){continue;}
+  for(Int_t k=0;k<kNPowers;k++)
+  {
+   s[k]->GetArray()[b] = fDiffS[2][index*kNPowers+k];
+   s[k]->SetBinEntries(b,entries);
+  }
+ }
+
+} // end of void AliFlowQVectorEngine::Fill2DDiffFlowProfiles(...)
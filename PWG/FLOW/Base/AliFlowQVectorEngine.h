@@ -0,0 +1,99 @@
+/*
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved.
+ * See cxx source for full Copyright notice
+ * $Id$
+ */
+
+/************************************************
+ * e-b-e Q-vectors for flow analysis with       *
+ * Q-cumulants: tracks are buffered and         *
+ * processed in blocks into flat arrays,        *
+ * differential p/q-vectors are accumulated     *
+ * into flat per-bin arrays                     *
+ ************************************************/
+
+#ifndef ALIFLOWQVECTORENGINE_H
+#define ALIFLOWQVECTORENGINE_H
+
+#include "TObject.h"
+#include "TArrayD.h"
+#include "TArrayI.h"
+#include "TArrayC.h"
+
+class TAxis;
+class TProfile;
+class TProfile2D;
+
+class AliFlowQVectorEngine: public TObject {
+ public:
+  enum {kNMultiples = 12,     // harmonics m*n for reference flow (m = 1,...,12)
+        kNPowers = 9,         // powers k of particle weights (k = 0,...,8)
+        kNDiffMultiples = 4,  // harmonics m*n for differential flow (m = 1,...,4)
+        kNTypes = 3,          // 0 = RP, 1 = POI, 2 = RP&&POI
+        kBlockSize = 64};     // number of tracks processed at once
+
+  AliFlowQVectorEngine();
+  virtual ~AliFlowQVectorEngine();
+
+  void SetHarmonic(Int_t n) {this->fHarmonic = n;};
+  void SetDiffFlowAxis(Int_t pe, const TAxis *axis);
+  void Set2DDiffFlowAxes(const TAxis *ptAxis, const TAxis *etaAxis);
+
+  void Clear(Option_t *option="");
+  void AddTrack(Double_t phi, Double_t pt, Double_t eta, Double_t weight, Bool_t isRP, Bool_t isPOI);
+  void Calculate();
+
+  Int_t GetNumberOfTracks() const {return this->fNTracks;};
+  Double_t GetReQ(Int_t m, Int_t k) const {return fReQ[m*kNPowers+k];};
+  Double_t GetImQ(Int_t m, Int_t k) const {return fImQ[m*kNPowers+k];};
+  Double_t GetS(Int_t k) const {return fS[k];};
+
+  void FillDiffFlowProfiles(Int_t t, Int_t pe, TProfile *re[][kNPowers], TProfile *im[][kNPowers], TProfile **s) const;
+  void Fill2DDiffFlowProfiles(Int_t t, TProfile2D *re[][kNPowers], TProfile2D *im[][kNPowers], TProfile2D **s) const;
+
+ private:
+  AliFlowQVectorEngine(const AliFlowQVectorEngine& engine);
+  AliFlowQVectorEngine& operator=(const AliFlowQVectorEngine& engine);
+
+  void ResizeTracks(Int_t size);
+  void CalculateBlock(Int_t first, Int_t n);
+
+  Int_t fHarmonic; //! harmonic n
+
+  // tracks (SoA):
+  Int_t fNTracks; //! number of buffered tracks
+  TArrayD fPhi; //! azimuthal angles
+  TArrayD fPt; //! transverse momenta
+  TArrayD fEta; //! pseudorapidities
+  TArrayD fWeight; //! particle weights (1 for POIs which are not RPs)
+  TArrayC fType; //! bit 0 = RP, bit 1 = POI
+
+  // reference flow:
+  Double_t fReQ[kNMultiples*kNPowers]; //! [m][k] = sum_{i=1}^{M} w_{i}^{k} cos((m+1)*n*phi_{i})
+  Double_t fImQ[kNMultiples*kNPowers]; //! [m][k] = sum_{i=1}^{M} w_{i}^{k} sin((m+1)*n*phi_{i})
+  Double_t fS[kNPowers]; //! [k] = sum_{i=1}^{M} w_{i}^{k}
+
+  // block buffers:
+  Double_t fCos[kNMultiples][kBlockSize]; //! cos((m+1)*n*phi) for tracks in block
+  Double_t fSin[kNMultiples][kBlockSize]; //! sin((m+1)*n*phi) for tracks in block
+  Double_t fPow[kNPowers][kBlockSize]; //! w^k for tracks in block
+
+  // differential flow, [0=pt,1=eta] and 2D; per bin [t][m][k] for p/q-vectors, [t][k] for s and [t] for entries:
+  Int_t fNBins[3]; //! number of bins including underflow and overflow (0 = not used)
+  const TAxis *fAxis[3]; //! axes of e-b-e profiles [0=pt,1=eta,2=eta in 2D]
+  const TAxis *fAxisPt2D; //! pt axis of e-b-e 2D profiles
+  TArrayD fDiffRe[3]; //! real parts
+  TArrayD fDiffIm[3]; //! imaginary parts
+  TArrayD fDiffS[3]; //! sums of weight powers
+  TArrayD fDiffEntries[3]; //! number of tracks
+  TArrayC fBinUsed[3]; //! flag for bins filled in this event
+  TArrayI fUsedBins[3]; //! list of bins filled in this event
+  Int_t fNUsedBins[3]; //! number of bins filled in this event
+  TArrayI fBin[3]; //! bin of each buffered track
+
+  ClassDef(AliFlowQVectorEngine, 1);
+};
+
+//================================================================================================================
+
+#endif
@@ -32,6 +32,10 @@
 #include <TFile.h>
 #include <TTree.h>
 #include <TF1.h>
+#include <TRandom3.h>
+#include <TROOT.h>
+#include <RVersion.h>
+#include <thread>
 
 #include "AliGlauberNucleon.h"
 #include "AliGlauberNucleus.h"
@@ -172,7 +176,14 @@ AliGlauberMC::AliGlauberMC(Option_t* NA, Option_t* NB, Double_t xsect) :
   fOmega(0),
   fSig0(0),
   fLambda(0),
-  fSigFluc(0)
+  fSigFluc(0),
+  fRandom(0),
+  fSigFlucX(),
+  fSigFlucCDF(),
+  fXA(),
+  fYA(),
+  fD2A(),
+  fNCollA()
 {
   //ctor
   for (UInt_t i=0; i<(sizeof(fdNdEtaParam)/sizeof(fdNdEtaParam[0])); i++)
@@ -322,7 +333,14 @@ AliGlauberMC::AliGlauberMC(const AliGlauberMC& in):
   fOmega(in.fOmega),
   fSig0(in.fSig0),
   fLambda(in.fLambda),
-  fSigFluc(in.fSigFluc)
+  fSigFluc(in.fSigFluc),
+  fRandom(0),
+  fSigFlucX(),
+  fSigFlucCDF(),
+  fXA(),
+  fYA(),
+  fD2A(),
+  fNCollA()
 {
   //copy ctor
   memcpy(fdNdEtaParam,in.fdNdEtaParam,sizeof(fdNdEtaParam));
@@ -480,7 +498,7 @@ Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
     nucleonA->SetInNucleusA();
     nucleonA->SetSigNN(fXSect);
     if (fDoFluc)
-      nucleonA->SetSigNN(fSigFluc->GetRandom());
+      nucleonA->SetSigNN(GetRandomSigNN());
   }
   fBNucleus.ThrowNucleons(bgen/2.);
   fNucleonsB = fBNucleus.GetNucleons();
@@ -493,7 +511,7 @@ Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
     nucleonB->SetInNucleusB();
     nucleonB->SetSigNN(fXSect);
     if (fDoFluc)
-      nucleonB->SetSigNN(fSigFluc->GetRandom());
+      nucleonB->SetSigNN(GetRandomSigNN());
   }
 
   if (fDoFluc) {
@@ -502,7 +520,7 @@ Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
       fSigFluc->SetParameters(1,fSig0,fOmega,fLambda);
       cout << "Setting fluc: " << fSig0 << " " << fOmega << " " << fLambda << endl;
     }
-    fXSect = fSigFluc->GetRandom();
+    fXSect = GetRandomSigNN();
   }
   // "ball" diameter = distance at which two balls interact
   Double_t d2 = (Double_t)fXSect/(TMath::Pi()*10); // in fm^2
@@ -511,33 +529,62 @@ Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
   Double_t Nco   = 0;
   Double_t Ncohc = 0; // hard core
 
+  // positions and interaction distances of the nucleons in A in contiguous arrays, so that
+  // the inner loop of the collision test does not go through the TObjArray of nucleons.
+  // With fluctuations the distance of a pair is the one of the nucleon with the larger sigNN:
+  // max(sigA,sigB)/(pi*10) is the same as max(sigA/(pi*10),sigB/(pi*10)), so it can be
+  // computed per nucleon instead of per pair.
+  fXA.resize(fAN);
+  fYA.resize(fAN);
+  fD2A.resize(fAN);
+  fNCollA.assign(fAN,0);
+  for (Int_t j = 0; j<fAN; j++)
+  {
+    AliGlauberNucleon *nucleonA=(AliGlauberNucleon*)(fNucleonsA->UncheckedAt(j));
+    fXA[j] = nucleonA->GetX();
+    fYA[j] = nucleonA->GetY();
+    fD2A[j] = fDoFluc ? (Double_t)nucleonA->GetSigNN()/(TMath::Pi()*10) : d2;
+  }
+  const Double_t *xA = fAN>0 ? &fXA[0] : 0;
+  const Double_t *yA = fAN>0 ? &fYA[0] : 0;
+  const Double_t *d2A = fAN>0 ? &fD2A[0] : 0;
+  Int_t *nCollA = fAN>0 ? &fNCollA[0] : 0;
+
   // for each of the A nucleons in nucleus B
   for (Int_t i = 0; i<fBN; i++)
   {
     AliGlauberNucleon *nucleonB=(AliGlauberNucleon*)(fNucleonsB->UncheckedAt(i));
+    const Double_t xB = nucleonB->GetX();
+    const Double_t yB = nucleonB->GetY();
+    const Double_t d2B = fDoFluc ? (Double_t)nucleonB->GetSigNN()/(TMath::Pi()*10) : d2;
+    Int_t nCollB = 0;
     for (Int_t j = 0 ; j < fAN ; j++)
     {
-      AliGlauberNucleon *nucleonA=(AliGlauberNucleon*)(fNucleonsA->UncheckedAt(j));
-      Double_t dx = nucleonB->GetX()-nucleonA->GetX();
-      Double_t dy = nucleonB->GetY()-nucleonA->GetY();
+      Double_t dx = xB-xA[j];
+      Double_t dy = yB-yA[j];
       Double_t dij = dx*dx+dy*dy;
-      if (fDoFluc) {
-	//fXSect = nucleonA->GetSigNN();
-	//fXSect = (nucleonA->GetSigNN()+nucleonB->GetSigNN())/2.;
-	fXSect = TMath::Max(nucleonA->GetSigNN(),nucleonB->GetSigNN());
-	d2 = (Double_t)fXSect/(TMath::Pi()*10); // in fm^2
-      }
-      if (dij < d2)
+      Double_t d2ij = TMath::Max(d2A[j],d2B);
+      if (dij < d2ij)
       {
 	bNN += dij;
 	++Nco;
-        nucleonB->Collide();
-        nucleonA->Collide();
-	if (dij<d2/4)
+	++nCollB;
+	++nCollA[j];
+	if (dij<d2ij/4)
 	  ++Ncohc;
       }
     }
+    nucleonB->Collide(nCollB);
   }
+  for (Int_t j = 0; j<fAN; j++)
+  {
+    if (nCollA[j])
+      ((AliGlauberNucleon*)(fNucleonsA->UncheckedAt(j)))->Collide(nCollA[j]);
+  }
+  // the cross section of the last pair is kept as the event cross section
+  if (fDoFluc && fAN>0 && fBN>0)
+    fXSect = TMath::Max(((AliGlauberNucleon*)(fNucleonsA->UncheckedAt(fAN-1)))->GetSigNN(),
+                        ((AliGlauberNucleon*)(fNucleonsB->UncheckedAt(fBN-1)))->GetSigNN());
 
   if (Nco>0) {
     fNcollw = Ncohc;
@@ -1267,7 +1314,7 @@ Int_t AliGlauberMC::NegativeBinomialRandom(Int_t k, Double_t nmean) const
   {
     array[i] = NegativeBinomialDistribution(i,k,nmean) + array[i-1];
   }
-  Double_t r = gRandom->Uniform(0,1);
+  Double_t r = GetRandomGenerator()->Uniform(0,1);
   return TMath::BinarySearch(fMaxPlot,array,r)+2;
 
 }
@@ -1278,7 +1325,7 @@ Int_t AliGlauberMC::NegativeBinomialRandomSV(Double_t k, Double_t nbar) const
   // negative binomial distribution generator, S. Voloshin, 09-May-2007
   Double_t sum=0.;
   Int_t i=0;
-  Double_t ran=gRandom->Rndm();
+  Double_t ran=GetRandomGenerator()->Rndm();
   Double_t trm=1./pow(1.+nbar/k,k);
   if (trm==0.)
   {
@@ -1308,7 +1355,7 @@ Int_t AliGlauberMC::DoubleNegativeBinomialRandom( Int_t k,
   {
     array[i] = alpha*NegativeBinomialDistribution(i,k,nmean)+(1-alpha)*NegativeBinomialDistribution(i,k2,nmean2) + array[i-1];
   }
-  Double_t r = gRandom->Uniform(0,1);
+  Double_t r = GetRandomGenerator()->Uniform(0,1);
   return TMath::BinarySearch(fMaxPlot,array,r)+2;
 }
 
@@ -1506,7 +1553,7 @@ Bool_t AliGlauberMC::NextEvent(Double_t bgen)
   {
     if(bgen<0||!succes) //get impactparameter
     {
-      bgen = TMath::Sqrt((fBMax*fBMax-fBMin*fBMin)*gRandom->Rndm()+fBMin*fBMin);
+      bgen = TMath::Sqrt((fBMax*fBMax-fBMin*fBMin)*GetRandomGenerator()->Rndm()+fBMin*fBMin);
     }
     if ( (succes=CalcEvent(bgen)) ) break; //ends if we have particparts
   }
@@ -1682,9 +1729,10 @@ Double_t AliGlauberMC::GetPsi4m2() const
 }
 */
 //______________________________________________________________________________
-void AliGlauberMC::Run(Int_t nevents)
+void AliGlauberMC::Run(Int_t nevents, Int_t nthreads)
 {
   //example run
+  //with nthreads>1 the events are generated in nthreads threads, see below
   cout << "Generating " << nevents << " events..." << endl;
   TString name(Form("nt_%s_%s",fANucleus.GetName(),fBNucleus.GetName()));
   TString title(Form("%s + %s (x-sect = %d mb)",fANucleus.GetName(),fBNucleus.GetName(),(Int_t) fXSect));
@@ -1696,87 +1744,235 @@ void AliGlauberMC::Run(Int_t nevents)
   }
   Int_t q = 0;
   Int_t u = 0;
-  for (Int_t i = 0; i<nevents; i++)
+  if (nthreads<=1)
   {
-
-    if(!NextEvent())
+    for (Int_t i = 0; i<nevents; i++)
     {
-      u++;
-      continue;
+
+      if(!NextEvent())
+      {
+        u++;
+        continue;
+      }
+
+      q++;
+      Float_t v[48];
+      FillNtupleRow(v);
+
+      //always at the end
+      fnt->Fill(v);
+
+      if ((i%100)==0) std::cout << "Generating Event # " << i << "... \r" << flush;
     }
+    std::cout << "Generating Event # " << nevents << "... \r" << endl << "Done! Succesfull events:  " << q << "  discarded events:  " << u <<"."<< endl;
+    return;
+  }
 
-    q++;
-    Float_t v[48];
-    v[0]  = GetNpart();
-    v[1]  = GetNcoll();
-    v[2]  = fBMC;
-    v[3]  = fMeanXParts;
-    v[4]  = fMeanYParts;
-    v[5]  = fMeanX2Parts;
-    v[6]  = fMeanY2Parts;
-    v[7]  = fMeanXYParts;
-    v[8]  = fSx2Parts;
-    v[9]  = fSy2Parts;
-    v[10] = fSxyParts;
-    v[11] = fMeanXSystem;
-    v[12] = fMeanYSystem;
-    v[13] = fMeanXA;
-    v[14] = fMeanYA;
-    v[15] = fMeanXB;
-    v[16] = fMeanYB;
-    v[17] = GetEccentricity();
-    v[18] = GetStoa();
-    v[19] = GetEccentricityColl();
-    v[20] = GetEccentricityCom();
-    v[21] = GetEccentricityPart();
-    v[22] = GetEccentricityPartColl();
-    v[23] = GetEccentricityPartCom();
-    if (fDoPartProd)
+  //threaded generation: every thread runs its own copy of the generator with its own
+  //TRandom3, seeded from gRandom, so the output only depends on the seed of gRandom and
+  //on the number of threads. The copies draw radii and sigNN from tabulated inverse CDFs
+  //(TF1::GetRandom always uses gRandom), so the events differ from the serial ones.
+  //The events are generated in rounds of kEventsPerRound per thread; after each round the
+  //rows are filled into the ntuple in thread order.
+  const Int_t kEventsPerRound = 10000;
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,6,0)
+  ROOT::EnableThreadSafety();
+#endif
+  std::vector<AliGlauberMC*> workers(nthreads);
+  std::vector<TRandom3*> generators(nthreads);
+  for (Int_t k = 0; k<nthreads; k++)
+  {
+    //TF1s and tables are set up here, creating them is not thread safe
+    workers[k] = new AliGlauberMC(fANucleus.GetName(),fBNucleus.GetName(),fXSect);
+    workers[k]->CopySettings(*this);
+    generators[k] = new TRandom3(1+gRandom->Integer(kMaxInt));
+    workers[k]->SetRandom(generators[k]);
+  }
+  std::vector<std::vector<Float_t> > rows(nthreads);
+  std::vector<Int_t> discarded(nthreads);
+  Int_t done = 0;
+  while (done<nevents)
+  {
+    Int_t nround = TMath::Min(nevents-done,kEventsPerRound*nthreads);
+    std::vector<std::thread> threads;
+    for (Int_t k = 0; k<nthreads; k++)
     {
-      v[24] = GetdNdEta();
-      v[25] = GetdNdEta();
-      v[26] = v[24]+v[25];
+      Int_t nk = nround/nthreads + (k<nround%nthreads ? 1 : 0);
+      threads.push_back(std::thread(GenerateEvents,workers[k],nk,&rows[k],&discarded[k]));
     }
-    else
+    for (Int_t k = 0; k<nthreads; k++)
     {
-      v[24] = 0;
-      v[25] = 0;
-      v[26] = 0;
+      threads[k].join();
+      for (UInt_t r = 0; r<rows[k].size(); r+=48)
+        fnt->Fill(&rows[k][r]);
+      q += rows[k].size()/48;
+      u += discarded[k];
     }
-    v[27]=fXSect;
-
-    Float_t mytAA=-999;
-    if (GetNcoll()>0) mytAA=GetNcoll()/fXSect;
-    v[28]=mytAA;
-    //_____________epsilon2,3,4,4_______
-    v[29] = GetEpsilon2Part();
-    v[30] = GetEpsilon3Part();
-    v[31] = GetEpsilon4Part();
-    v[32] = GetEpsilon5Part();
-    v[33] = GetEpsilon2Coll();
-    v[34] = GetEpsilon3Coll();
-    v[35] = GetEpsilon4Coll();
-    v[36] = GetEpsilon5Coll();
-    v[37] = GetEpsilon2Com();
-    v[38] = GetEpsilon3Com();
-    v[39] = GetEpsilon4Com();
-    v[40] = GetEpsilon5Com();
-    v[41] = GetPsi2();
-    v[42] = GetPsi3();
-    v[43] = GetPsi4();
-    v[44] = GetPsi5();
-    v[45] = fBNN;
-    v[46] = fXSect;
-    v[47] = fNcollw;
-
-    //always at the end
-    fnt->Fill(v);
-
-    if ((i%100)==0) std::cout << "Generating Event # " << i << "... \r" << flush;
+    done += nround;
+    std::cout << "Generating Event # " << done << "... \r" << flush;
+  }
+  for (Int_t k = 0; k<nthreads; k++)
+  {
+    fEvents += workers[k]->fEvents;
+    fTotalEvents += workers[k]->fTotalEvents;
+    if (workers[k]->fMaxNpartFound > fMaxNpartFound) fMaxNpartFound = workers[k]->fMaxNpartFound;
+    delete workers[k];
+    delete generators[k];
   }
   std::cout << "Generating Event # " << nevents << "... \r" << endl << "Done! Succesfull events:  " << q << "  discarded events:  " << u <<"."<< endl;
 }
 
+//______________________________________________________________________________
+void AliGlauberMC::GenerateEvents(AliGlauberMC *mc, Int_t nevents, std::vector<Float_t> *rows, Int_t *ndiscarded)
+{
+  //generate nevents events with mc and store their ntuple rows (worker of the threaded Run)
+  rows->clear();
+  *ndiscarded = 0;
+  for (Int_t i = 0; i<nevents; i++)
+  {
+    if(!mc->NextEvent())
+    {
+      (*ndiscarded)++;
+      continue;
+    }
+    Float_t v[48];
+    mc->FillNtupleRow(v);
+    rows->insert(rows->end(),v,v+48);
+  }
+}
+
+//______________________________________________________________________________
+void AliGlauberMC::FillNtupleRow(Float_t *v) const
+{
+  //fill the variables of the current event in the order of the ntuple columns
+  v[0]  = GetNpart();
+  v[1]  = GetNcoll();
+  v[2]  = fBMC;
+  v[3]  = fMeanXParts;
+  v[4]  = fMeanYParts;
+  v[5]  = fMeanX2Parts;
+  v[6]  = fMeanY2Parts;
+  v[7]  = fMeanXYParts;
+  v[8]  = fSx2Parts;
+  v[9]  = fSy2Parts;
+  v[10] = fSxyParts;
+  v[11] = fMeanXSystem;
+  v[12] = fMeanYSystem;
+  v[13] = fMeanXA;
+  v[14] = fMeanYA;
+  v[15] = fMeanXB;
+  v[16] = fMeanYB;
+  v[17] = GetEccentricity();
+  v[18] = GetStoa();
+  v[19] = GetEccentricityColl();
+  v[20] = GetEccentricityCom();
+  v[21] = GetEccentricityPart();
+  v[22] = GetEccentricityPartColl();
+  v[23] = GetEccentricityPartCom();
+  if (fDoPartProd)
+  {
+    v[24] = GetdNdEta();
+    v[25] = GetdNdEta();
+    v[26] = v[24]+v[25];
+  }
+  else
+  {
+    v[24] = 0;
+    v[25] = 0;
+    v[26] = 0;
+  }
+  v[27]=fXSect;
+
+  Float_t mytAA=-999;
+  if (GetNcoll()>0) mytAA=GetNcoll()/fXSect;
+  v[28]=mytAA;
+  //_____________epsilon2,3,4,4_______
+  v[29] = GetEpsilon2Part();
+  v[30] = GetEpsilon3Part();
+  v[31] = GetEpsilon4Part();
+  v[32] = GetEpsilon5Part();
+  v[33] = GetEpsilon2Coll();
+  v[34] = GetEpsilon3Coll();
+  v[35] = GetEpsilon4Coll();
+  v[36] = GetEpsilon5Coll();
+  v[37] = GetEpsilon2Com();
+  v[38] = GetEpsilon3Com();
+  v[39] = GetEpsilon4Com();
+  v[40] = GetEpsilon5Com();
+  v[41] = GetPsi2();
+  v[42] = GetPsi3();
+  v[43] = GetPsi4();
+  v[44] = GetPsi5();
+  v[45] = fBNN;
+  v[46] = fXSect;
+  v[47] = fNcollw;
+}
+
+//______________________________________________________________________________
+void AliGlauberMC::CopySettings(const AliGlauberMC &in)
+{
+  //copy the generator settings of in (nuclei, impact parameter range, fluctuations, multiplicity)
+  fANucleus.SetN(in.fANucleus.GetN());
+  fANucleus.SetR(in.fANucleus.GetR());
+  fANucleus.SetA(in.fANucleus.GetA());
+  fANucleus.SetW(in.fANucleus.GetW());
+  fANucleus.SetMinDist(in.fANucleus.GetMinDist());
+  fBNucleus.SetN(in.fBNucleus.GetN());
+  fBNucleus.SetR(in.fBNucleus.GetR());
+  fBNucleus.SetA(in.fBNucleus.GetA());
+  fBNucleus.SetW(in.fBNucleus.GetW());
+  fBNucleus.SetMinDist(in.fBNucleus.GetMinDist());
+  fXSect=in.fXSect;
+  fBMin=in.fBMin;
+  fBMax=in.fBMax;
+  memcpy(fdNdEtaParam,in.fdNdEtaParam,sizeof(fdNdEtaParam));
+  fMultType=in.fMultType;
+  fX=in.fX;
+  fNpp=in.fNpp;
+  fDoPartProd=in.fDoPartProd;
+  fDoFluc=in.fDoFluc;
+  fOmega=in.fOmega;
+  fSig0=in.fSig0;
+  fLambda=in.fLambda;
+}
+
+//______________________________________________________________________________
+void AliGlauberMC::SetRandom(TRandom *rnd)
+{
+  //use rnd instead of gRandom for this instance; sigNN fluctuations and nucleon
+  //radii are then drawn from tabulated inverse CDFs instead of TF1::GetRandom
+  fRandom = rnd;
+  fANucleus.SetRandom(rnd);
+  fBNucleus.SetRandom(rnd);
+  fSigFlucX.clear();
+  fSigFlucCDF.clear();
+  if (fRandom && fDoFluc)
+  {
+    if (!fSigFluc) {
+      fSigFluc = new TF1("fSigFluc","[0]*x/[3]/(x/[3]+[1])*exp(-((x/[1]/[3]-1)/[2])^2)",0,250);
+      fSigFluc->SetParameters(1,fSig0,fOmega,fLambda);
+      cout << "Setting fluc: " << fSig0 << " " << fOmega << " " << fLambda << endl;
+    }
+    AliGlauberNucleus::TabulateCDF(fSigFluc,2500,fSigFlucX,fSigFlucCDF);
+  }
+}
+
+//______________________________________________________________________________
+TRandom *AliGlauberMC::GetRandomGenerator() const
+{
+  //generator of this instance
+  return fRandom ? fRandom : gRandom;
+}
+
+//______________________________________________________________________________
+Double_t AliGlauberMC::GetRandomSigNN()
+{
+  //random fluctuating nucleon-nucleon cross section
+  if (fRandom)
+    return AliGlauberNucleus::SampleCDF(fSigFlucX,fSigFlucCDF,fRandom);
+  return fSigFluc->GetRandom();
+}
+
 //---------------------------------------------------------------------------------
 void AliGlauberMC::RunAndSaveNtuple( Int_t n,
                                      const Option_t *sysA,
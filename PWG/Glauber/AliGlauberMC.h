@@ -16,9 +16,11 @@
 #include "AliGlauberNucleus.h"
 #include <Riostream.h>
 #include <TNamed.h>
+#include <vector>
 
 class TObjArray;
 class TNtuple;
+class TRandom;
 
 using std::cout;
 using std::endl;
@@ -38,7 +40,7 @@ public:
    AliGlauberMC& operator=(const AliGlauberMC& in);
    void         Draw(Option_t* option);
 
-   void         Run(Int_t nevents);
+   void         Run(Int_t nevents, Int_t nthreads=1);
    Bool_t       NextEvent(Double_t bgen=-1);
    Bool_t       CalcEvent(Double_t bgen);
 
@@ -100,6 +102,7 @@ public:
    void   Seta(Double_t a)  {fANucleus.SetA(a); fBNucleus.SetA(a);}
    void   SetDoFluc(Double_t omega, Double_t sig0, Double_t lam, Bool_t on=kTRUE) 
             {fDoFluc=on;fOmega=omega;fSig0=sig0;fLambda=lam;}
+   void   SetRandom(TRandom *rnd);
    static void       PrintVersion()         {cout << "AliGlauberMC " << Version() << endl;}
    static const char *Version()             {return "v1.2";}
    static void       RunAndSaveNtuple( Int_t n,
@@ -251,7 +254,19 @@ private:
    Double_t     fSig0;           //regularization parameter 
    Double_t     fLambda;         //lambda parameter
    TF1         *fSigFluc;        //!parameterization for fluctuating sigNN
+   TRandom     *fRandom;         //!generator of this instance (gRandom if not set)
+   std::vector<Double_t> fSigFlucX;   //!tabulated inverse CDF of fSigFluc (used with fRandom): sigNN values
+   std::vector<Double_t> fSigFlucCDF; //!tabulated inverse CDF of fSigFluc (used with fRandom): CDF values
+   std::vector<Double_t> fXA;         //!x of the nucleons in nucleus A, for the collision test
+   std::vector<Double_t> fYA;         //!y of the nucleons in nucleus A, for the collision test
+   std::vector<Double_t> fD2A;        //!interaction distance^2 of the nucleons in nucleus A
+   std::vector<Int_t>    fNCollA;     //!number of collisions of the nucleons in nucleus A
    Bool_t       CalcResults(Double_t bgen);
+   TRandom     *GetRandomGenerator() const;
+   Double_t     GetRandomSigNN();
+   void         FillNtupleRow(Float_t *v) const;
+   void         CopySettings(const AliGlauberMC &in);
+   static void  GenerateEvents(AliGlauberMC *mc, Int_t nevents, std::vector<Float_t> *rows, Int_t *ndiscarded);
 
    ClassDef(AliGlauberMC,4)
 };
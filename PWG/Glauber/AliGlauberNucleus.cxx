@@ -49,7 +49,10 @@ AliGlauberNucleus::AliGlauberNucleus(Option_t* iname, Int_t iN, Double_t iR, Dou
   fF(0),
   fTrials(0),
   fFunction(ifunc),
-  fNucleons(NULL)
+  fNucleons(NULL),
+  fRandom(NULL),
+  fRTable(),
+  fCDFTable()
 {
    if (fN==0) {
       cout << "Setting up nucleus " << iname << endl;
@@ -77,7 +80,10 @@ AliGlauberNucleus::AliGlauberNucleus(const AliGlauberNucleus& in):
   fF(in.fF),
   fTrials(in.fTrials),
   fFunction(in.fFunction),
-  fNucleons(NULL)
+  fNucleons(NULL),
+  fRandom(NULL),
+  fRTable(),
+  fCDFTable()
 {
   //copy ctor
   if (in.fNucleons)
@@ -100,6 +106,7 @@ AliGlauberNucleus& AliGlauberNucleus::operator=(const AliGlauberNucleus& in)
   delete fNucleons;
   fNucleons=static_cast<TObjArray*>((in.fNucleons)->Clone());
   fNucleons->SetOwner();
+  if (fRandom) SetRandom(fRandom);
   return *this;
 }
 
@@ -189,6 +196,7 @@ void AliGlauberNucleus::SetR(Double_t ir)
          fFunction->SetParameter(0,fR);
          break;
    }
+   if (fRandom) SetRandom(fRandom);
 }
 
 //______________________________________________________________________________
@@ -206,6 +214,7 @@ void AliGlauberNucleus::SetA(Double_t ia)
          fFunction->SetParameter(1,fA);
          break;
    }
+   if (fRandom) SetRandom(fRandom);
 }
 
 //______________________________________________________________________________
@@ -223,6 +232,63 @@ void AliGlauberNucleus::SetW(Double_t iw)
          fFunction->SetParameter(2,fW);
          break;
    }
+   if (fRandom) SetRandom(fRandom);
+}
+
+//______________________________________________________________________________
+void AliGlauberNucleus::SetRandom(TRandom *rnd)
+{
+   // Use rnd instead of gRandom in ThrowNucleons. The radii are then drawn from
+   // a tabulated inverse CDF of rho(r), as fFunction->GetRandom() always uses gRandom.
+   // Used by the threaded AliGlauberMC::Run, where every thread has its own generator.
+   fRandom = rnd;
+   fRTable.clear();
+   fCDFTable.clear();
+   if (fRandom && fFunction)
+      TabulateCDF(fFunction, 2000, fRTable, fCDFTable);
+}
+
+//______________________________________________________________________________
+void AliGlauberNucleus::TabulateCDF(const TF1 *f, Int_t nbins, std::vector<Double_t> &x, std::vector<Double_t> &cdf)
+{
+   // Tabulate the normalised cumulative distribution of f in nbins equidistant bins
+   // of its range, for SampleCDF. The integral over a bin is computed with the
+   // two-point Gauss rule, so f is not evaluated at the bin edges (e.g. r=0 for Hulthen).
+   Double_t xmin = f->GetXmin();
+   Double_t xmax = f->GetXmax();
+   Double_t dx = (xmax-xmin)/nbins;
+   Double_t offset = 0.5*dx/TMath::Sqrt(3.);
+   x.resize(nbins+1);
+   cdf.resize(nbins+1);
+   x[0] = xmin;
+   cdf[0] = 0;
+   for (Int_t i = 1; i<=nbins; i++) {
+      x[i] = xmin + i*dx;
+      Double_t xmid = x[i] - 0.5*dx;
+      Double_t integral = 0.5*dx*(f->Eval(xmid-offset)+f->Eval(xmid+offset));
+      cdf[i] = cdf[i-1] + ((integral>0) ? integral : 0);
+   }
+   if (cdf[nbins]<=0) {
+      cerr << "Function " << f->GetName() << " has no positive integral in its range" << endl;
+      return;
+   }
+   for (Int_t i = 1; i<=nbins; i++)
+      cdf[i] /= cdf[nbins];
+}
+
+//______________________________________________________________________________
+Double_t AliGlauberNucleus::SampleCDF(const std::vector<Double_t> &x, const std::vector<Double_t> &cdf, TRandom *rnd)
+{
+   // Draw a random number from a table of TabulateCDF,
+   // with linear interpolation of the inverse CDF inside a bin
+   Int_t n = cdf.size();
+   Double_t u = rnd->Rndm();
+   Int_t i = TMath::BinarySearch(n, &cdf[0], u);
+   if (i<0) i = 0;
+   if (i>n-2) i = n-2;
+   Double_t width = cdf[i+1]-cdf[i];
+   if (width<=0) return x[i];
+   return x[i] + (x[i+1]-x[i])*(u-cdf[i])/width;
 }
 
 //______________________________________________________________________________
@@ -243,12 +309,14 @@ void AliGlauberNucleus::ThrowNucleons(Double_t xshift)
    Double_t sumy=0;       
    Double_t sumz=0;       
 
+   TRandom *rnd = fRandom ? fRandom : gRandom;
+
    Bool_t hulthen = (TString(GetName())=="dh");
    if (fN==2 && hulthen) { //special treatmeant for Hulten
 
-      Double_t r = fFunction->GetRandom()/2;
-      Double_t phi = gRandom->Rndm() * 2 * TMath::Pi() ;
-      Double_t ctheta = 2*gRandom->Rndm() - 1 ;
+      Double_t r = (fRandom ? SampleCDF(fRTable,fCDFTable,fRandom) : fFunction->GetRandom())/2;
+      Double_t phi = rnd->Rndm() * 2 * TMath::Pi() ;
+      Double_t ctheta = 2*rnd->Rndm() - 1 ;
       Double_t stheta = sqrt(1-ctheta*ctheta);
      
       AliGlauberNucleon *nucleon1=(AliGlauberNucleon*)(fNucleons->UncheckedAt(0));
@@ -270,9 +338,9 @@ void AliGlauberNucleus::ThrowNucleons(Double_t xshift)
       nucleon->Reset();
       while(1) {
          fTrials++;
-         Double_t r = fFunction->GetRandom();
-         Double_t phi = gRandom->Rndm() * 2 * TMath::Pi() ;
-         Double_t ctheta = 2*gRandom->Rndm() - 1 ;
+         Double_t r = fRandom ? SampleCDF(fRTable,fCDFTable,fRandom) : fFunction->GetRandom();
+         Double_t phi = rnd->Rndm() * 2 * TMath::Pi() ;
+         Double_t ctheta = 2*rnd->Rndm() - 1 ;
          Double_t stheta = TMath::Sqrt(1-ctheta*ctheta);
          Double_t x = r * stheta * cos(phi) + xshift;
          Double_t y = r * stheta * sin(phi);      
@@ -16,8 +16,10 @@
 
 //class TNamed;
 #include <TNamed.h>
+#include <vector>
 class TObjArray;
 class TF1;
+class TRandom;
 
 class AliGlauberNucleus : public TNamed {
 private:
@@ -30,6 +32,9 @@ private:
    Int_t      fTrials;     //Store trials needed to complete nucleus
    TF1*       fFunction;   //Probability density function rho(r)
    TObjArray* fNucleons;   //Array of nucleons
+   TRandom*   fRandom;     //!Generator for ThrowNucleons (gRandom and fFunction->GetRandom() if not set)
+   std::vector<Double_t> fRTable;   //!Radii of the tabulated inverse CDF of rho(r)
+   std::vector<Double_t> fCDFTable; //!CDF values of the tabulated inverse CDF of rho(r)
 
    void       Lookup(Option_t* name);
 
@@ -45,6 +50,7 @@ public:
    Double_t   GetR()             const {return fR;}
    Double_t   GetA()             const {return fA;}
    Double_t   GetW()             const {return fW;}
+   Double_t   GetMinDist()       const {return fMinDist;}
    TObjArray *GetNucleons()      const {return fNucleons;}
    Int_t      GetTrials()        const {return fTrials;}
    void       SetN(Int_t in)           {fN=in;}
@@ -52,7 +58,10 @@ public:
    void       SetA(Double_t ia);
    void       SetW(Double_t iw);
    void       SetMinDist(Double_t min) {fMinDist=min;}
+   void       SetRandom(TRandom *rnd);
    void       ThrowNucleons(Double_t xshift=0.);
+   static void     TabulateCDF(const TF1 *f, Int_t nbins, std::vector<Double_t> &x, std::vector<Double_t> &cdf);
+   static Double_t SampleCDF(const std::vector<Double_t> &x, const std::vector<Double_t> &cdf, TRandom *rnd);
 
    ClassDef(AliGlauberNucleus,1)
 };
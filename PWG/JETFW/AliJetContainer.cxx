@@ -285,7 +285,7 @@ AliEmcalJet* AliJetContainer::GetAcceptJet(Int_t i) const
 {
   UInt_t rejectionReason = 0;
   AliEmcalJet *jet = GetJet(i);
-  if(!AcceptJet(jet, rejectionReason)) return 0;
+  if(!AcceptObjectCached(i, rejectionReason)) return 0;
 
   return jet;
 }
@@ -90,6 +90,9 @@ class AliHelperPID : public TNamed
   //set cut on beyesian probability
   void SetBayesCut(Double_t cut){fBayesCut=cut;}
   Double_t GetBayesCut(){return fBayesCut;}
+  //read TPC and TOF nsigma from the per-event table of AliPIDnSigmaCacheTask
+  void SetUseNSigmaCache(Bool_t use=kTRUE){fUseNSigmaCache=use;}
+  Bool_t GetUseNSigmaCache() const {return fUseNSigmaCache;}
   
   //getters of the other data members
   TList * GetOutputList() {return fOutputList;}//get the TList with histos
@@ -131,11 +134,14 @@ class AliHelperPID : public TNamed
   Bool_t fUseExclusiveNSigma;//if true returns the identity only if no double counting
   Double_t fPtTOFPID; //lower pt bound for the TOF pid
   Bool_t fHasTOFPID;
+  Bool_t fUseNSigmaCache;//if true the nsigma are read from AliPIDnSigmaCache (same values, computed once per event)
+  
+  Double_t NumberOfSigmas(Int_t detector, AliVTrack *trk, Int_t specie) const;
   
   AliHelperPID(const AliHelperPID&);
   AliHelperPID& operator=(const AliHelperPID&);
   
-  ClassDef(AliHelperPID, 8);
+  ClassDef(AliHelperPID, 9);
   
 };
 #endif
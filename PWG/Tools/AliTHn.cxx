@@ -28,6 +28,8 @@
 // the derivation from THnSparse is obviously against many OO rules. correct would be a common baseclass of THnSparse and THn.
 //
 // Templated version allows also the use of double as storage container
+//
+// For large containers which are mostly empty, SetBlockStorage switches to blocks of bins which are allocated on first touch
 // 
 // Author: Jan Fiete Grosse-Oetringhaus
 
@@ -37,11 +39,53 @@
 #include "AliLog.h"
 #include "TArrayF.h"
 #include "TArrayD.h"
+#include "TAxis.h"
 #include "THnSparse.h"
 #include "TMath.h"
+#include "TBuffer.h"
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 templateClassImp(AliTHnT)
 
+namespace {
+  // each thread takes the lowest free slot on first use, which is used as shard index in the sharded mode of AliTHnT
+  // the slot of a thread is shared between all AliTHnT objects, so that shards do not need any locking
+  // the slot is released when the thread exits, therefore the slots in use are bounded by the number of concurrent threads
+  std::mutex gAliTHnSlotMutex;
+  std::vector<Bool_t> gAliTHnSlotUsed;
+
+  class AliTHnThreadSlot
+  {
+  public:
+    AliTHnThreadSlot() : fSlot(0)
+    {
+      std::lock_guard<std::mutex> lock(gAliTHnSlotMutex);
+      while (fSlot < (Int_t) gAliTHnSlotUsed.size() && gAliTHnSlotUsed[fSlot])
+        fSlot++;
+      if (fSlot == (Int_t) gAliTHnSlotUsed.size())
+        gAliTHnSlotUsed.push_back(kTRUE);
+      else
+        gAliTHnSlotUsed[fSlot] = kTRUE;
+    }
+    ~AliTHnThreadSlot()
+    {
+      // a thread taking this slot later continues to fill the same shards, the mutex orders its fills after ours
+      std::lock_guard<std::mutex> lock(gAliTHnSlotMutex);
+      gAliTHnSlotUsed[fSlot] = kFALSE;
+    }
+    Int_t fSlot;
+  };
+
+  Int_t GetAliTHnThreadSlot()
+  {
+    static thread_local AliTHnThreadSlot slot;
+    return slot.fSlot;
+  }
+}
+
 template <class TemplateArray, typename TemplateType>
 AliTHnT<TemplateArray, TemplateType>::AliTHnT() : 
   AliTHnBase(),
@@ -50,10 +94,23 @@ AliTHnT<TemplateArray, TemplateType>::AliTHnT() :
   fNSteps(0),
   fValues(0),
   fSumw2(0),
+  fBlockSize(0),
+  fBlockShift(0),
+  fNBlocksUsed(0),
+  fBlockTable(0),
   axisCache(0),
   fNbinsCache(0),
   fLastVars(0),
-  fLastBins(0)
+  fLastBins(0),
+  fAxisMin(0),
+  fAxisMax(0),
+  fAxisEdges(0),
+  fBatchBins(0),
+  fBatchSize(0),
+  fShards(0),
+  fNShards(0),
+  fShardFillState(0),
+  fOwnsAxisCache(kTRUE)
 {
   // Constructor
 }
@@ -66,10 +123,23 @@ AliTHnT<TemplateArray, TemplateType>::AliTHnT(const Char_t* name, const Char_t*
   fNSteps(nSelStep),
   fValues(0),
   fSumw2(0),
+  fBlockSize(0),
+  fBlockShift(0),
+  fNBlocksUsed(0),
+  fBlockTable(0),
   axisCache(0),
   fNbinsCache(0),
   fLastVars(0),
-  fLastBins(0)
+  fLastBins(0),
+  fAxisMin(0),
+  fAxisMax(0),
+  fAxisEdges(0),
+  fBatchBins(0),
+  fBatchSize(0),
+  fShards(0),
+  fNShards(0),
+  fShardFillState(0),
+  fOwnsAxisCache(kTRUE)
 {
   // Constructor
 
@@ -88,10 +158,16 @@ void AliTHnT<TemplateArray, TemplateType>::AliTHnT::Init()
   fValues = new TemplateArray*[fNSteps];
   fSumw2 = new TemplateArray*[fNSteps];
   
+  // the block bookkeeping is allocated also in dense mode, as it is streamed with fNSteps elements
+  fNBlocksUsed = new Int_t[fNSteps];
+  fBlockTable = new TArrayI*[fNSteps];
+  
   for (Int_t i=0; i<fNSteps; i++)
   {
     fValues[i] = 0;
     fSumw2[i] = 0;
+    fNBlocksUsed[i] = 0;
+    fBlockTable[i] = 0;
   }
 } 
 
@@ -103,10 +179,23 @@ AliTHnT<TemplateArray, TemplateType>::AliTHnT(const AliTHnT &c) :
   fNSteps(c.fNSteps),
   fValues(new TemplateArray*[c.fNSteps]),
   fSumw2(new TemplateArray*[c.fNSteps]),
+  fBlockSize(c.fBlockSize),
+  fBlockShift(c.fBlockShift),
+  fNBlocksUsed(new Int_t[c.fNSteps]),
+  fBlockTable(new TArrayI*[c.fNSteps]),
   axisCache(0),
   fNbinsCache(0),
   fLastVars(0),
-  fLastBins(0)
+  fLastBins(0),
+  fAxisMin(0),
+  fAxisMax(0),
+  fAxisEdges(0),
+  fBatchBins(0),
+  fBatchSize(0),
+  fShards(0),
+  fNShards(0),
+  fShardFillState(0),
+  fOwnsAxisCache(kTRUE)
 {
   //
   // AliTHnT copy constructor
@@ -118,8 +207,9 @@ AliTHnT<TemplateArray, TemplateType>::AliTHnT(const AliTHnT &c) :
   for (Int_t i=0; i<fNSteps; i++) {
     if (c.fValues[i]) fValues[i] = new TemplateArray(*(c.fValues[i]));
     if (c.fSumw2[i])  fSumw2[i]  = new TemplateArray(*(c.fSumw2[i]));
+    fNBlocksUsed[i] = c.fNBlocksUsed[i];
+    fBlockTable[i] = (c.fBlockTable[i]) ? new TArrayI(*(c.fBlockTable[i])) : 0;
   }
-
 }
 
 template <class TemplateArray, typename TemplateType>
@@ -129,12 +219,27 @@ AliTHnT<TemplateArray, TemplateType>::~AliTHnT()
   
   DeleteContainers();
   
+  if (fShards)
+  {
+    for (Int_t i=0; i<fNShards; i++)
+      delete fShards[i];
+    delete[] fShards;
+  }
+  
   delete[] fValues;
   delete[] fSumw2;
-  delete[] axisCache;
+  delete[] fNBlocksUsed;
+  delete[] fBlockTable;
+  if (fOwnsAxisCache)
+    delete[] axisCache;
   delete[] fNbinsCache;
   delete[] fLastVars;
   delete[] fLastBins;
+  delete[] fAxisMin;
+  delete[] fAxisMax;
+  delete[] fAxisEdges;
+  delete[] fBatchBins;
+  delete[] fShardFillState;
 }
 
 template <class TemplateArray, typename TemplateType>
@@ -155,6 +260,13 @@ void AliTHnT<TemplateArray, TemplateType>::DeleteContainers()
       delete fSumw2[i];
       fSumw2[i] = 0;
     }
+    
+    if (fBlockTable && fBlockTable[i])
+    {
+      delete fBlockTable[i];
+      fBlockTable[i] = 0;
+      fNBlocksUsed[i] = 0;
+    }
   }
 }
 
@@ -169,31 +281,52 @@ AliTHnT<TemplateArray, TemplateType> &AliTHnT<TemplateArray, TemplateType>::oper
     fNBins=c.fNBins;
     fNVars=c.fNVars;
     if(fNSteps) {
-      for(Int_t i=0; i< fNSteps; ++i) {
-	delete fValues[i];
-	delete fSumw2[i];
-      }
+      DeleteContainers();
       delete [] fValues;
       delete [] fSumw2;
     }
+    delete [] fNBlocksUsed;
+    delete [] fBlockTable;
+    fBlockSize = c.fBlockSize;
+    fBlockShift = c.fBlockShift;
     fNSteps=c.fNSteps;
     if(fNSteps) {
       fValues=new TemplateArray*[fNSteps];
       fSumw2=new TemplateArray*[fNSteps];
+      fNBlocksUsed = new Int_t[fNSteps];
+      fBlockTable = new TArrayI*[fNSteps];
       memset(fValues,0,fNSteps*sizeof(TemplateArray*));
       memset(fSumw2,0,fNSteps*sizeof(TemplateArray*));
 
       for (Int_t i=0; i<fNSteps; i++) {
 	if (c.fValues[i]) fValues[i] = new TemplateArray(*(c.fValues[i]));
 	if (c.fSumw2[i])  fSumw2[i]  = new TemplateArray(*(c.fSumw2[i]));
+	fNBlocksUsed[i] = c.fNBlocksUsed[i];
+	fBlockTable[i] = (c.fBlockTable[i]) ? new TArrayI(*(c.fBlockTable[i])) : 0;
       }
     } else {
       fValues = 0;
       fSumw2 = 0;
+      fNBlocksUsed = 0;
+      fBlockTable = 0;
     }
-    delete [] axisCache;
-    axisCache = new TAxis*[fNVars];
-    memcpy(axisCache, c.axisCache, fNVars*sizeof(TAxis*));
+    // axis caches point to the axes of the source object: reset, they are rebuilt on the next fill
+    if (fOwnsAxisCache)
+      delete [] axisCache;
+    fOwnsAxisCache = kTRUE;
+    delete [] fNbinsCache;
+    delete [] fLastVars;
+    delete [] fLastBins;
+    delete [] fAxisMin;
+    delete [] fAxisMax;
+    delete [] fAxisEdges;
+    axisCache = 0;
+    fNbinsCache = 0;
+    fLastVars = 0;
+    fLastBins = 0;
+    fAxisMin = 0;
+    fAxisMax = 0;
+    fAxisEdges = 0;
   }
   return *this;
 }
@@ -211,6 +344,8 @@ void AliTHnT<TemplateArray, TemplateType>::Copy(TObject& c) const
   target.fNSteps = fNSteps;
   target.fNBins = fNBins;
   target.fNVars = fNVars;
+  target.fBlockSize = fBlockSize;
+  target.fBlockShift = fBlockShift;
   
   target.Init();
 
@@ -225,6 +360,9 @@ void AliTHnT<TemplateArray, TemplateType>::Copy(TObject& c) const
       target.fSumw2[i] = new TemplateArray(*(fSumw2[i]));
     else
       target.fSumw2[i] = 0;
+    
+    target.fNBlocksUsed[i] = fNBlocksUsed[i];
+    target.fBlockTable[i] = (fBlockTable[i]) ? new TArrayI(*(fBlockTable[i])) : 0;
   }
 }
 
@@ -239,6 +377,8 @@ Long64_t AliTHnT<TemplateArray, TemplateType>::Merge(TCollection* list)
   if (!list)
     return 0;
   
+  ReduceShards();
+  
   if (list->IsEmpty())
     return 1;
   
@@ -253,9 +393,18 @@ Long64_t AliTHnT<TemplateArray, TemplateType>::Merge(TCollection* list)
     AliTHnT* entry = dynamic_cast<AliTHnT*> (obj);
     if (entry == 0) 
       continue;
+    
+    entry->ReduceShards();
 
     for (Int_t i=0; i<fNSteps; i++)
     {
+      // block storage involved on either side: merge block-wise
+      if (IsBlockStorage() || entry->IsBlockStorage())
+      {
+        AddStep(i, entry, fSumw2[i] || entry->fSumw2[i]);
+        continue;
+      }
+      
       if (entry->fValues[i])
       {
 	if (!fValues[i])
@@ -282,32 +431,431 @@ Long64_t AliTHnT<TemplateArray, TemplateType>::Merge(TCollection* list)
 }
 
 template <class TemplateArray, typename TemplateType>
-void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep, Double_t weight)
+void AliTHnT<TemplateArray, TemplateType>::InitAxisCache()
 {
-  // fills an entry
+  // fills the axis cache used in Fill and FillBatch
+  
+  axisCache = new TAxis*[fNVars];
+  fNbinsCache = new Int_t[fNVars];
+  fAxisMin = new Double_t[fNVars];
+  fAxisMax = new Double_t[fNVars];
+  fAxisEdges = new const Double_t*[fNVars];
+  for (Int_t i=0; i<fNVars; i++)
+  {
+    axisCache[i] = GetAxis(i, 0);
+    fNbinsCache[i] = axisCache[i]->GetNbins();
+    fAxisMin[i] = axisCache[i]->GetXmin();
+    fAxisMax[i] = axisCache[i]->GetXmax();
+    fAxisEdges[i] = (axisCache[i]->GetXbins()->fN > 0) ? axisCache[i]->GetXbins()->GetArray() : 0;
+  }
+  
+  fLastVars = new Double_t[fNVars];
+  fLastBins = new Int_t[fNVars];
+  
+  // initial values which never match (NaN != NaN)
+  for (Int_t i=0; i<fNVars; i++)
+  {
+    fLastBins[i] = 0;
+    fLastVars[i] = TMath::QuietNaN();
+  }
+}
 
-  // fill axis cache
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::CopyAxisCache(const AliTHnT& parent)
+{
+  // initializes the axis cache of a shard from its parent
+  // the axis pointers and bin edges are borrowed from the parent, the per-fill caches are private
+  
+  fOwnsAxisCache = kFALSE;
+  axisCache = parent.axisCache;
+  fNbinsCache = new Int_t[fNVars];
+  fAxisMin = new Double_t[fNVars];
+  fAxisMax = new Double_t[fNVars];
+  fAxisEdges = new const Double_t*[fNVars];
+  fLastVars = new Double_t[fNVars];
+  fLastBins = new Int_t[fNVars];
+  for (Int_t i=0; i<fNVars; i++)
+  {
+    fNbinsCache[i] = parent.fNbinsCache[i];
+    fAxisMin[i] = parent.fAxisMin[i];
+    fAxisMax[i] = parent.fAxisMax[i];
+    fAxisEdges[i] = parent.fAxisEdges[i];
+    fLastBins[i] = 0;
+    fLastVars[i] = TMath::QuietNaN();
+  }
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::SetNShards(Int_t nShards)
+{
+  // enables the sharded mode with up to <nShards> concurrently filling threads (0 disables it)
+  // has to be called from the main thread before the filling threads are started
+  // the containers of a shard are created at the first fill of a step in the shard (see CreateStepContainers)
+  // in dense mode this needs 2 * <number of bins> additional elements per filled shard and step
+  
+  if (fShards)
+  {
+    ReduceShards();
+    for (Int_t i=0; i<fNShards; i++)
+      delete fShards[i];
+    delete[] fShards;
+    fShards = 0;
+  }
+  
+  fNShards = TMath::Max(nShards, 0);
+  if (fNShards == 0)
+    return;
+  
+  // the axis cache is shared read-only by all shards
   if (!axisCache)
+    InitAxisCache();
+  
+  fShards = new AliTHnT*[fNShards];
+  for (Int_t i=0; i<fNShards; i++)
+  {
+    AliTHnT* shard = new AliTHnT;
+    shard->fNBins = fNBins;
+    shard->fNVars = fNVars;
+    shard->fNSteps = fNSteps;
+    shard->fBlockSize = fBlockSize;
+    shard->fBlockShift = fBlockShift;
+    shard->Init();
+    shard->CopyAxisCache(*this);
+    shard->fShardFillState = new UChar_t[fNSteps];
+    for (Int_t step=0; step<fNSteps; step++)
+      shard->fShardFillState[step] = 0;
+    fShards[i] = shard;
+  }
+}
+
+template <class TemplateArray, typename TemplateType>
+AliTHnT<TemplateArray, TemplateType>* AliTHnT<TemplateArray, TemplateType>::GetShard()
+{
+  // returns the shard of the calling thread
+  // a slot is only used by one thread at a time, therefore no locking is needed
+  
+  Int_t slot = GetAliTHnThreadSlot();
+  if (slot >= fNShards)
+    AliFatal(Form("Thread slot %d exceeds the number of shards (%d): more threads are filling concurrently, increase it with SetNShards", slot, fNShards));
+  
+  return fShards[slot];
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::ResetShard()
+{
+  // empties the filled steps of a shard, keeping its containers for the next fills
+  
+  for (Int_t step=0; step<fNSteps; step++)
+  {
+    if (!fShardFillState[step])
+      continue;
+    fValues[step]->Reset();
+    fSumw2[step]->Reset();
+    if (IsBlockStorage())
+    {
+      fBlockTable[step]->Reset(-1);
+      fNBlocksUsed[step] = 0;
+    }
+    fShardFillState[step] = 0;
+  }
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::ReduceShards(Int_t nThreads)
+{
+  // adds the content of all shards to the data containers of this object and empties the shards
+  // must not be called while other threads are filling
+  // the bin range is split between <nThreads> threads (0: number of cores)
+  
+  if (!fShards)
+    return;
+  
+  Bool_t anyFilled = kFALSE;
+  for (Int_t i=0; i<fNShards && !anyFilled; i++)
+    for (Int_t step=0; step<fNSteps && !anyFilled; step++)
+      anyFilled = (fShards[i]->fShardFillState[step] != 0);
+  if (!anyFilled)
+    return;
+  
+  if (nThreads <= 0)
+    nThreads = TMath::Max((Int_t) std::thread::hardware_concurrency(), 1);
+  // below this size spawning threads does not pay off
+  const Long64_t kMinBinsPerThread = 1 << 16;
+  nThreads = (Int_t) TMath::Max(TMath::Min((Long64_t) nThreads, fNBins / kMinBinsPerThread), (Long64_t) 1);
+  
+  for (Int_t step=0; step<fNSteps; step++)
   {
-    axisCache = new TAxis*[fNVars];
-    fNbinsCache = new Int_t[fNVars];
-    for (Int_t i=0; i<fNVars; i++)
+    if (IsBlockStorage())
+    {
+      // blocks are allocated in the order of touch, adding is done block-wise
+      for (Int_t i=0; i<fNShards; i++)
+        if (fShards[i]->fShardFillState[step])
+          AddStep(step, fShards[i], fSumw2[step] || (fShards[i]->fShardFillState[step] & kShardWeighted));
+      continue;
+    }
+    
+    std::vector<TemplateType*> shardValues;
+    std::vector<TemplateType*> shardSumw2;
+    Bool_t needSumw2 = (fSumw2[step] != 0);
+    for (Int_t i=0; i<fNShards; i++)
     {
-      axisCache[i] = GetAxis(i, 0);
-      fNbinsCache[i] = axisCache[i]->GetNbins();
+      if (!fShards[i]->fShardFillState[step])
+        continue;
+      shardValues.push_back(fShards[i]->fValues[step]->GetArray());
+      shardSumw2.push_back(fShards[i]->fSumw2[step]->GetArray());
+      if (fShards[i]->fShardFillState[step] & kShardWeighted)
+        needSumw2 = kTRUE;
     }
+    if (shardValues.empty())
+      continue;
     
-    fLastVars = new Double_t[fNVars];
-    fLastBins = new Int_t[fNVars];
+    CreateStepContainers(step, needSumw2);
+    TemplateType* values = fValues[step]->GetArray();
+    TemplateType* sumw2 = (fSumw2[step]) ? fSumw2[step]->GetArray() : 0;
     
-    // initial values to prevent checking for 0 below
-    for (Int_t i=0; i<fNVars; i++)
+    auto reduceRange = [&](Long64_t begin, Long64_t end) {
+      for (size_t i=0; i<shardValues.size(); i++)
+      {
+        const TemplateType* source = shardValues[i];
+        for (Long64_t l=begin; l<end; l++)
+          values[l] += source[l];
+        if (sumw2)
+        {
+          const TemplateType* sourceSumw2 = shardSumw2[i];
+          for (Long64_t l=begin; l<end; l++)
+            sumw2[l] += sourceSumw2[l];
+        }
+      }
+    };
+    
+    if (nThreads == 1)
+      reduceRange(0, fNBins);
+    else
     {
-      fLastBins[i] = axisCache[i]->FindBin(var[i]);
-      fLastVars[i] = var[i];
+      std::vector<std::thread> workers;
+      Long64_t chunk = (fNBins + nThreads - 1) / nThreads;
+      for (Int_t t=0; t<nThreads; t++)
+      {
+        Long64_t begin = t * chunk;
+        Long64_t end = TMath::Min(begin + chunk, fNBins);
+        if (begin < end)
+          workers.push_back(std::thread(reduceRange, begin, end));
+      }
+      for (size_t t=0; t<workers.size(); t++)
+        workers[t].join();
+    }
+    
+    AliInfo(Form("Step %d: reduced %d shards", step, (Int_t) shardValues.size()));
+  }
+  
+  for (Int_t i=0; i<fNShards; i++)
+    fShards[i]->ResetShard();
+}
+
+template <class TemplateArray, typename TemplateType>
+AliCFGridSparse* AliTHnT<TemplateArray, TemplateType>::GetGrid(Int_t istep) const
+{
+  // the shards are added before the grid is accessed (the content of the grid itself is set by FillParent)
+  
+  const_cast<AliTHnT*>(this)->ReduceShards();
+  return AliTHnBase::GetGrid(istep);
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::Streamer(TBuffer &R__b)
+{
+  // streams AliTHnT with the generated class buffer
+  // before writing the shards are added; objects from files written before class version 6 do not have the
+  // block storage bookkeeping, it is created after reading
+  
+  if (R__b.IsReading())
+  {
+    R__b.ReadClassBuffer(AliTHnT::Class(), this);
+    if (fNSteps > 0 && !fNBlocksUsed)
+    {
+      fNBlocksUsed = new Int_t[fNSteps];
+      for (Int_t i=0; i<fNSteps; i++)
+        fNBlocksUsed[i] = 0;
+    }
+    if (fNSteps > 0 && !fBlockTable)
+    {
+      fBlockTable = new TArrayI*[fNSteps];
+      for (Int_t i=0; i<fNSteps; i++)
+        fBlockTable[i] = 0;
+    }
+  }
+  else
+  {
+    ReduceShards();
+    R__b.WriteClassBuffer(AliTHnT::Class(), this);
+  }
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::SetBlockStorage(Int_t blockSize)
+{
+  // switches to block storage with blocks of <blockSize> bins (rounded up to the next power of 2), 0 switches to dense storage
+  
+  for (Int_t i=0; i<fNSteps; i++)
+  {
+    if (fValues[i])
+    {
+      AliError("Storage mode can only be changed before the first fill");
+      return;
     }
   }
   
+  if (fShards)
+  {
+    AliError("Storage mode has to be set before the sharded mode");
+    return;
+  }
+  
+  // no container exists yet, the block bookkeeping (allocated in all modes) is empty
+  fBlockSize = 0;
+  fBlockShift = 0;
+  
+  if (blockSize <= 0)
+    return;
+  
+  while ((1 << fBlockShift) < blockSize)
+    fBlockShift++;
+  fBlockSize = 1 << fBlockShift;
+  
+  AliInfo(Form("Using block storage with %d bins per block", fBlockSize));
+}
+
+template <class TemplateArray, typename TemplateType>
+Int_t AliTHnT<TemplateArray, TemplateType>::AllocateBlock(Int_t istep, Long64_t block)
+{
+  // allocates block <block> of step <istep> at the end of the data containers and returns its position
+  // the containers grow by at least 25% to keep the amortized cost per allocation constant
+  
+  Int_t slot = fNBlocksUsed[istep];
+  Long64_t needed = ((Long64_t) slot + 1) << fBlockShift;
+  if (needed > fValues[istep]->GetSize())
+  {
+    Long64_t newSize = TMath::Max(needed, (Long64_t) fValues[istep]->GetSize() + fValues[istep]->GetSize() / 4);
+    newSize = TMath::Min(newSize, ((Long64_t) fBlockTable[istep]->GetSize()) << fBlockShift);
+    // Set keeps the content and initializes the new elements with 0
+    fValues[istep]->Set((Int_t) newSize);
+    if (fSumw2[istep])
+      fSumw2[istep]->Set((Int_t) newSize);
+  }
+  
+  fBlockTable[istep]->GetArray()[block] = slot;
+  fNBlocksUsed[istep]++;
+  return slot;
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::AddStep(Int_t istep, const AliTHnT* source, Bool_t needSumw2)
+{
+  // adds the content of step <istep> of <source> to this object, for any combination of dense and block storage
+  // entries without sumw2 container have been filled with weight 1, for them sumw2 := values
+  // <needSumw2>: whether this object needs a sumw2 container after adding
+  
+  if (!source->fValues[istep])
+    return;
+  
+  CreateStepContainers(istep, needSumw2);
+  
+  const TemplateType* sourceValues = source->fValues[istep]->GetArray();
+  const TemplateType* sourceSumw2 = (source->fSumw2[istep]) ? source->fSumw2[istep]->GetArray() : sourceValues;
+  
+  // number of bins processed together: a block of the source or of this object
+  Long64_t chunk = TMath::Max(source->fBlockSize, 1);
+  if (IsBlockStorage() && (chunk == 1 || fBlockSize < chunk))
+    chunk = fBlockSize;
+  
+  for (Long64_t first = 0; first < fNBins; first += chunk)
+  {
+    Long64_t n = TMath::Min(chunk, fNBins - first);
+    Long64_t sourceIndex = first;
+    if (source->IsBlockStorage())
+    {
+      // source block not allocated
+      Int_t slot = source->fBlockTable[istep]->GetArray()[first >> source->fBlockShift];
+      if (slot < 0)
+        continue;
+      sourceIndex = ((Long64_t) slot << source->fBlockShift) + (first & (source->fBlockSize - 1));
+    }
+    else
+    {
+      // do not allocate blocks for empty source ranges
+      Bool_t empty = kTRUE;
+      for (Long64_t l = 0; l < n && empty; l++)
+        empty = (sourceValues[sourceIndex + l] == 0 && sourceSumw2[sourceIndex + l] == 0);
+      if (empty)
+        continue;
+    }
+    
+    // chunks never span several blocks of this object
+    Long64_t index = GetStorageIndex(istep, first, kTRUE);
+    TemplateType* values = fValues[istep]->GetArray();
+    TemplateType* sumw2 = (fSumw2[istep]) ? fSumw2[istep]->GetArray() : 0;
+    for (Long64_t l = 0; l < n; l++)
+    {
+      values[index + l] += sourceValues[sourceIndex + l];
+      if (sumw2)
+        sumw2[index + l] += sourceSumw2[sourceIndex + l];
+    }
+  }
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::CreateStepContainers(Int_t istep, Bool_t needSumw2)
+{
+  // creates the data containers for step <istep> if not yet existing
+  // sumw2 is always kept in shards, kShardWeighted tells whether it is needed in the reduced object
+  
+  if (fShardFillState)
+    needSumw2 = kTRUE;
+  
+  if (!fValues[istep])
+  {
+    if (IsBlockStorage())
+    {
+      // blocks are added on first touch
+      fValues[istep] = new TemplateArray(0);
+      fBlockTable[istep] = new TArrayI((Int_t) ((fNBins + fBlockSize - 1) >> fBlockShift));
+      fBlockTable[istep]->Reset(-1);
+      fNBlocksUsed[istep] = 0;
+    }
+    else
+      fValues[istep] = new TemplateArray(fNBins);
+    if (!fShardFillState)
+      AliInfo(Form("Created values container for step %d", istep));
+  }
+
+  if (needSumw2)
+  {
+    // initialize with already filled entries (which have been filled with weight == 1), in this case fSumw2 := fValues
+    if (!fSumw2[istep])
+    {
+      fSumw2[istep] = new TemplateArray(*fValues[istep]);
+      if (!fShardFillState)
+        AliInfo(Form("Created sumw2 container for step %d", istep));
+    }
+  }
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep, Double_t weight)
+{
+  // fills an entry
+
+  if (fNShards > 0)
+  {
+    GetShard()->Fill(var, istep, weight);
+    return;
+  }
+  
+  // fill axis cache
+  if (!axisCache)
+    InitAxisCache();
+  
   // calculate global bin index
   Long64_t bin = 0;
   for (Int_t i=0; i<fNVars; i++)
@@ -319,7 +867,7 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
       tmpBin = fLastBins[i];
     else
     {
-      tmpBin = axisCache[i]->FindBin(var[i]);
+      tmpBin = FindBinCached(i, var[i]);
       fLastBins[i] = tmpBin;
       fLastVars[i] = var[i];
     }
@@ -334,21 +882,10 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
 //     Printf("%lld", bin);
   }
 
-  if (!fValues[istep])
-  {
-    fValues[istep] = new TemplateArray(fNBins);
-    AliInfo(Form("Created values container for step %d", istep));
-  }
-
-  if (weight != 1)
-  {
-    // initialize with already filled entries (which have been filled with weight == 1), in this case fSumw2 := fValues
-    if (!fSumw2[istep])
-    {
-      fSumw2[istep] = new TemplateArray(*fValues[istep]);
-      AliInfo(Form("Created sumw2 container for step %d", istep));
-    }
-  }
+  CreateStepContainers(istep, weight != 1);
+  bin = GetStorageIndex(istep, bin, kTRUE);
+  if (fShardFillState)
+    fShardFillState[istep] |= (weight != 1) ? (kShardFilled | kShardWeighted) : kShardFilled;
 
   fValues[istep]->GetArray()[bin] += weight;
   if (fSumw2[istep])
@@ -360,6 +897,107 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
 //   AliCFContainer::Fill(var, istep, weight);
 }
 
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::FillBatch(Int_t n, const Double_t* const* vars, Int_t istep, const Double_t* weights)
+{
+  // fills <n> entries at once
+  // vars[ivar] points to an array of the values of variable ivar for all entries (SoA layout)
+  // weights == 0 means weight 1 for all entries
+  //
+  // the global bin index is computed variable by variable for all entries, then the contents are added
+  // result is identical to calling Fill for each entry
+
+  if (n <= 0)
+    return;
+  
+  if (fNShards > 0)
+  {
+    GetShard()->FillBatch(n, vars, istep, weights);
+    return;
+  }
+  
+  if (!axisCache)
+    InitAxisCache();
+  
+  if (fBatchSize < n)
+  {
+    delete[] fBatchBins;
+    fBatchBins = new Long64_t[n];
+    fBatchSize = n;
+  }
+  
+  // entries outside the axis ranges are flagged with -1
+  for (Int_t j=0; j<n; j++)
+    fBatchBins[j] = 0;
+  
+  for (Int_t i=0; i<fNVars; i++)
+  {
+    const Double_t* var = vars[i];
+    const Long64_t nBins = fNbinsCache[i];
+    if (!fAxisEdges[i])
+    {
+      // uniform axis: direct index calculation, loop without calls
+      const Double_t xMin = fAxisMin[i];
+      const Double_t xMax = fAxisMax[i];
+      const Double_t range = xMax - xMin;
+      for (Int_t j=0; j<n; j++)
+      {
+        // same expression as TAxis::FindFixBin (bins start from 0 here)
+        Long64_t tmpBin = (var[j] >= xMin && var[j] < xMax) ? Long64_t(nBins * (var[j] - xMin) / range) : -1;
+        fBatchBins[j] = (fBatchBins[j] < 0 || tmpBin < 0 || tmpBin >= nBins) ? -1 : fBatchBins[j] * nBins + tmpBin;
+      }
+    }
+    else
+    {
+      for (Int_t j=0; j<n; j++)
+      {
+        Long64_t tmpBin = FindBinCached(i, var[j]);
+        fBatchBins[j] = (fBatchBins[j] < 0 || tmpBin < 1 || tmpBin > nBins) ? -1 : fBatchBins[j] * nBins + tmpBin - 1;
+      }
+    }
+  }
+  
+  // containers are only created for entries inside the axis ranges (as in Fill)
+  Bool_t anyInRange = kFALSE;
+  Bool_t needSumw2 = kFALSE;
+  for (Int_t j=0; j<n; j++)
+  {
+    if (fBatchBins[j] < 0)
+      continue;
+    anyInRange = kTRUE;
+    if (weights && weights[j] != 1)
+    {
+      needSumw2 = kTRUE;
+      break;
+    }
+  }
+  if (!anyInRange)
+    return;
+  
+  CreateStepContainers(istep, needSumw2);
+  if (fShardFillState)
+    fShardFillState[istep] |= (needSumw2) ? (kShardFilled | kShardWeighted) : kShardFilled;
+  
+  // block storage: translate to storage indices first, as allocating blocks can move the data containers
+  if (IsBlockStorage())
+    for (Int_t j=0; j<n; j++)
+      if (fBatchBins[j] >= 0)
+        fBatchBins[j] = GetStorageIndex(istep, fBatchBins[j], kTRUE);
+  
+  TemplateType* values = fValues[istep]->GetArray();
+  TemplateType* sumw2 = (fSumw2[istep]) ? fSumw2[istep]->GetArray() : 0;
+  
+  for (Int_t j=0; j<n; j++)
+  {
+    if (fBatchBins[j] < 0)
+      continue;
+    Double_t weight = (weights) ? weights[j] : 1.;
+    values[fBatchBins[j]] += weight;
+    if (sumw2)
+      sumw2[fBatchBins[j]] += weight * weight;
+  }
+}
+
 template <class TemplateArray, typename TemplateType>
 Long64_t AliTHnT<TemplateArray, TemplateType>::GetGlobalBinIndex(const Int_t* binIdx)
 {
@@ -413,10 +1051,13 @@ void AliTHnT<TemplateArray, TemplateType>::FillContainer(AliCFContainer* cont)
       Long64_t globalBin = GetGlobalBinIndex(binIdx);
 //       Printf(" --> %lld", globalBin);
       
-      if (source[globalBin] != 0)
+      // -1: block not allocated in block storage mode
+      Long64_t index = GetStorageIndex(i, globalBin, kFALSE);
+      
+      if (index >= 0 && source[index] != 0)
       {
-	target->SetBinContent(binIdx, source[globalBin]);
-	target->SetBinError(binIdx, TMath::Sqrt(sourceSumw2[globalBin]));
+	target->SetBinContent(binIdx, source[index]);
+	target->SetBinError(binIdx, TMath::Sqrt(sourceSumw2[index]));
 	
 	count++;
       }
@@ -448,6 +1089,7 @@ void AliTHnT<TemplateArray, TemplateType>::FillParent()
 {
   // fills the information stored in the buffer in this class into the baseclass containers
   
+  ReduceShards();
   FillContainer(this);
 }
 
@@ -459,6 +1101,8 @@ void AliTHnT<TemplateArray, TemplateType>::ReduceAxis()
   
   Int_t axis = fNVars-1;
   
+  ReduceShards();
+  
   for (Int_t i=0; i<fNSteps; i++)
   {
     if (!fValues[i])
@@ -489,22 +1133,31 @@ void AliTHnT<TemplateArray, TemplateType>::ReduceAxis()
       for (Int_t j=1; j<=nBins[axis]; j++)
       {
 	binIdx[axis] = j;
-	Long64_t globalBin = GetGlobalBinIndex(binIdx);
-	sumValues += source[globalBin];
-	source[globalBin] = 0;
+	Long64_t index = GetStorageIndex(i, GetGlobalBinIndex(binIdx), kFALSE);
+	if (index < 0)
+	  continue;
+	sumValues += source[index];
+	source[index] = 0;
 
 	if (sourceSumw2)
 	{
-	  sumSumw2 += sourceSumw2[globalBin];
-	  sourceSumw2[globalBin] = 0;
+	  sumSumw2 += sourceSumw2[index];
+	  sourceSumw2[index] = 0;
 	}
       }
       binIdx[axis] = 1;
 	
-      Long64_t globalBin = GetGlobalBinIndex(binIdx);
-      source[globalBin] = sumValues;
-      if (sourceSumw2)
-	sourceSumw2[globalBin] = sumSumw2;
+      // in block storage mode blocks are only allocated for non-empty results (which can move the data containers)
+      Long64_t index = GetStorageIndex(i, GetGlobalBinIndex(binIdx), sumValues != 0 || sumSumw2 != 0);
+      if (index >= 0)
+      {
+	source = fValues[i]->GetArray();
+	if (sourceSumw2)
+	  sourceSumw2 = fSumw2[i]->GetArray();
+	source[index] = sumValues;
+	if (sourceSumw2)
+	  sourceSumw2[index] = sumSumw2;
+      }
 
       count++;
 
@@ -12,12 +12,15 @@
 
 #include "TObject.h"
 #include "TString.h"
+#include "TArrayI.h"
 #include "AliCFContainer.h"
 
 class TArray;
 class TArrayF;
 class TArrayD;
+class TArrayI;
 class TCollection;
+class AliCFGridSparse;
 
 class AliTHnBase : public AliCFContainer
 {
@@ -26,6 +29,18 @@ public:
   AliTHnBase(const Char_t* name, const Char_t* title,const Int_t nSelStep, const Int_t nVarIn, const Int_t* nBinIn) : AliCFContainer(name, title, nSelStep, nVarIn, nBinIn) { }
   
   virtual void Fill(const Double_t *var, Int_t istep, Double_t weight=1.) = 0;
+  virtual void FillBatch(Int_t n, const Double_t* const* vars, Int_t istep, const Double_t* weights=0)
+  {
+    // fills n entries given in SoA layout: vars[ivar][ientry]; weights == 0 means weight 1 for all entries
+    Double_t* var = new Double_t[GetNVar()];
+    for (Int_t i=0; i<n; i++)
+    {
+      for (Int_t j=0; j<GetNVar(); j++)
+        var[j] = vars[j][i];
+      Fill(var, istep, (weights) ? weights[i] : 1.);
+    }
+    delete[] var;
+  }
   virtual void FillParent() = 0;
   virtual void FillContainer(AliCFContainer* cont) = 0;
 
@@ -48,11 +63,15 @@ class AliTHnT : public AliTHnBase
   virtual ~AliTHnT();
   
   virtual void Fill(const Double_t *var, Int_t istep, Double_t weight=1.) ;
+  virtual void FillBatch(Int_t n, const Double_t* const* vars, Int_t istep, const Double_t* weights=0);
   virtual void FillParent();
   virtual void FillContainer(AliCFContainer* cont);
   
-  virtual TArray* GetValues(Int_t step) { return fValues[step]; }
-  virtual TArray* GetSumw2(Int_t step)  { return fSumw2[step]; }
+  // in block storage mode the arrays contain the allocated blocks in the order of allocation (see GetBlockTable)
+  // in sharded mode the shards are added first
+  virtual TArray* GetValues(Int_t step) { ReduceShards(); return fValues[step]; }
+  virtual TArray* GetSumw2(Int_t step)  { ReduceShards(); return fSumw2[step]; }
+  virtual AliCFGridSparse* GetGrid(Int_t istep) const;
   
   virtual void DeleteContainers();
   virtual void ReduceAxis();
@@ -63,22 +82,101 @@ class AliTHnT : public AliTHnBase
 
   virtual Long64_t Merge(TCollection* list);
   
+  // sharded mode for filling from up to <nShards> concurrent threads: each thread fills a private shard
+  // the shards are allocated in SetNShards, which has to be called from the main thread; the containers of a step
+  // (values and sumw2) are allocated by the filling thread at the first fill of the step in its shard
+  // ReduceShards adds the shards to the data containers of this object; it is called when the object is streamed,
+  // merged or its content is accessed (FillParent, GetValues, GetSumw2, GetGrid), never while threads are filling
+  void SetNShards(Int_t nShards);
+  Int_t GetNShards() const { return fNShards; }
+  void ReduceShards(Int_t nThreads = 0);
+  
+  // block storage mode: the bins of a step are stored in blocks of <blockSize> bins (rounded up to a power of 2)
+  // which are allocated on first touch, the memory then scales with the occupied phase space
+  // has to be called before the first fill
+  void SetBlockStorage(Int_t blockSize);
+  Bool_t IsBlockStorage() const { return fBlockSize > 0; }
+  Int_t GetBlockSize() const { return fBlockSize; }
+  TArrayI* GetBlockTable(Int_t step) { return (fBlockTable) ? fBlockTable[step] : 0; }
+  
 protected:
+  enum { kShardFilled = 1, kShardWeighted = 2 };
+  
   void Init();
+  void InitAxisCache();
+  void CopyAxisCache(const AliTHnT& parent);
+  AliTHnT* GetShard();
   Long64_t GetGlobalBinIndex(const Int_t* binIdx);
+  void CreateStepContainers(Int_t istep, Bool_t needSumw2);
+  Int_t AllocateBlock(Int_t istep, Long64_t block);
+  void AddStep(Int_t istep, const AliTHnT* source, Bool_t needSumw2);
+  void ResetShard();
+  
+  // index of global bin <bin> in the data containers of step <istep>
+  // dense storage: the bin itself; block storage: -1 if the block is not allocated and <create> is false
+  inline Long64_t GetStorageIndex(Int_t istep, Long64_t bin, Bool_t create)
+  {
+    if (fBlockSize <= 0)
+      return bin;
+    Long64_t block = bin >> fBlockShift;
+    Int_t slot = fBlockTable[istep]->GetArray()[block];
+    if (slot < 0)
+    {
+      if (!create)
+        return -1;
+      slot = AllocateBlock(istep, block);
+    }
+    return ((Long64_t) slot << fBlockShift) + (bin & (fBlockSize - 1));
+  }
+  
+  // same result as TAxis::FindFixBin, but without virtual call
+  // uniform axes: direct index calculation; variable axes: branch-free binary search on the bin edges
+  inline Int_t FindBinCached(Int_t ivar, Double_t x) const
+  {
+    if (x < fAxisMin[ivar])
+      return 0;
+    if (!(x < fAxisMax[ivar]))
+      return fNbinsCache[ivar] + 1;
+    const Double_t* edges = fAxisEdges[ivar];
+    if (!edges)
+      return 1 + Int_t(fNbinsCache[ivar] * (x - fAxisMin[ivar]) / (fAxisMax[ivar] - fAxisMin[ivar]));
+    // largest edge index with edges[index] <= x
+    const Double_t* base = edges;
+    Int_t len = fNbinsCache[ivar] + 1;
+    while (len > 1)
+    {
+      Int_t half = len / 2;
+      base = (base[half] <= x) ? base + half : base;
+      len -= half;
+    }
+    return 1 + Int_t(base - edges);
+  }
   
   Long64_t fNBins;   // number of total bins
   Int_t    fNVars;   // number of variables
   Int_t    fNSteps;  // number of selection steps
   TemplateArray **fValues;  //[fNSteps] data container
   TemplateArray **fSumw2;   //[fNSteps] data container
+  Int_t    fBlockSize;   // number of bins per block in block storage mode (0: dense storage)
+  Int_t    fBlockShift;  // log2(fBlockSize)
+  Int_t*   fNBlocksUsed; //[fNSteps] number of allocated blocks per step (block storage mode, allocated in all modes)
+  TArrayI** fBlockTable; //[fNSteps] page table per step: block -> position in the data containers, -1 if not allocated (block storage mode, allocated in all modes)
   
   TAxis** axisCache; //! cache axis pointers (about 50% of the time in Fill is spent in GetAxis otherwise)
   Int_t* fNbinsCache; //! cache Nbins per axis
   Double_t* fLastVars; //! caching of last used bins (in many loops some vars are the same for a while)
   Int_t* fLastBins; //! caching of last used bins (in many loops some vars are the same for a while)
+  Double_t* fAxisMin; //! cache of lower axis limits
+  Double_t* fAxisMax; //! cache of upper axis limits
+  const Double_t** fAxisEdges; //! cache of bin edges for variable size axes (0 for uniform axes)
+  Long64_t* fBatchBins; //! buffer for global bin indices in FillBatch
+  Int_t fBatchSize; //! size of fBatchBins
+  AliTHnT** fShards; //! per-thread shards in sharded mode (indexed by thread slot)
+  Int_t fNShards; //! number of shards (0: sharded mode off)
+  UChar_t* fShardFillState; //! shards only: per step kShardFilled / kShardWeighted if filled (with weights != 1)
+  Bool_t fOwnsAxisCache; //! false for shards, where axisCache points to the axes of the parent
   
-  ClassDef(AliTHnT, 5) // THn like container
+  ClassDef(AliTHnT, 6) // THn like container
 };
 
 typedef AliTHnT<TArrayF, Float_t> AliTHn;
@@ -17,8 +17,8 @@
 #pragma link C++ typedef AliTHn;
 #pragma link C++ typedef AliTHnD;
 #pragma link C++ class AliTHnBase+;
-#pragma link C++ class AliTHnT<TArrayF, Float_t>+;
-#pragma link C++ class AliTHnT<TArrayD, Double_t>+;
+#pragma link C++ class AliTHnT<TArrayF, Float_t>-;
+#pragma link C++ class AliTHnT<TArrayD, Double_t>-;
 #pragma link C++ class THistManager+;
 #pragma link C++ class AliJSONReader+;
 #pragma link C++ class AliJSONData+;
@@ -46,4 +46,7 @@
 #pragma link C++ function TestTHistManager::TestRunBuildGrouped();
 #pragma link C++ function TestTHistManager::TestRunFillSimple();
 #pragma link C++ function TestTHistManager::TestRunFillGrouped();
+#pragma link C++ function TestTHistManager::TestRunFillHandle();
+#pragma link C++ function TestTHistManager::TestRunFillBinWidth();
+#pragma link C++ function TestTHistManager::TestRunBenchmarkFill(int);
 #endif
@@ -21,6 +21,7 @@
 #include <vector>
 #include <TArrayD.h>
 #include <TAxis.h>
+#include <TError.h>
 #include <TH1.h>
 #include <TH2.h>
 #include <TH3.h>
@@ -30,6 +31,9 @@
 #include <TObjArray.h>
 #include <TObjString.h>
 #include <TProfile.h>
+#include <TProfile2D.h>
+#include <TProfile3D.h>
+#include <TStopwatch.h>
 #include <TString.h>
 
 #include "TBinning.h"
@@ -42,14 +46,18 @@ ClassImp(THistManager)
 THistManager::THistManager():
 		TNamed(),
 		fHistos(NULL),
-		fIsOwner(true)
+		fIsOwner(true),
+		fHandleHistos(),
+		fHandleFlags()
 {
 }
 
 THistManager::THistManager(const char *name):
 		TNamed(name, Form("Histogram container %s", name)),
 		fHistos(NULL),
-		fIsOwner(true)
+		fIsOwner(true),
+		fHandleHistos(),
+		fHandleFlags()
 {
 	fHistos = new THashList();
 	fHistos->SetName(Form("histos%s", name));
@@ -420,6 +428,11 @@ void THistManager::FillTH1(const char *name, double x, double weight, Option_t *
 		Fatal("THistManager::FillTH1", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
 		return;
 	}
+	UInt_t widthflags(0);
+	if(BinWidthOption(opt, 1, false, widthflags)){
+	  hist->Fill(x, weight * BinWidthFactor(widthflags, hist, &x));
+	  return;
+	}
 	TString optionstring(opt);
 	if(optionstring.Contains("w")){
 	  // use bin width as weight
@@ -442,6 +455,12 @@ void THistManager::FillTH1(const char *name, const char *label, double weight, O
   if(!hist){
     Fatal("THistManager::FillTH1", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
     return;
+  }
+  UInt_t widthflags(0);
+  if(BinWidthOption(opt, 1, false, widthflags)){
+    Double_t x = hist->GetXaxis()->GetBinCenter(hist->GetXaxis()->FindBin(label));
+    hist->Fill(label, weight * BinWidthFactor(widthflags, hist, &x));
+    return;
   }
 	TString optionstring(opt);
 	if(optionstring.Contains("w")){
@@ -467,6 +486,12 @@ void THistManager::FillTH2(const char *name, double x, double y, double weight,
 		Fatal("THistManager::FillTH2", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
 		return;
 	}
+	UInt_t widthflags(0);
+	if(BinWidthOption(opt, 2, false, widthflags)){
+	  double point[2] = {x, y};
+	  hist->Fill(x, y, weight * BinWidthFactor(widthflags, hist, point));
+	  return;
+	}
 	TString optstring(opt);
 	Double_t myweight = optstring.Contains("w") ? 1. : weight;
 	if(optstring.Contains("wx")){
@@ -492,6 +517,11 @@ void THistManager::FillTH2(const char *name, double *point, double weight, Optio
 		Fatal("THistManager::FillTH2", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
 		return;
 	}
+	UInt_t widthflags(0);
+	if(BinWidthOption(opt, 2, false, widthflags)){
+	  hist->Fill(point[0], point[1], weight * BinWidthFactor(widthflags, hist, point));
+	  return;
+	}
 	TString optstring(opt);
 	Double_t myweight = optstring.Contains("w") ? 1. : weight;
 	if(optstring.Contains("wx")){
@@ -517,6 +547,13 @@ void THistManager::FillTH2(const char *name, const char *labelX, const char *lab
     Fatal("THistManager::FillTH2", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
     return;
   }
+  UInt_t widthflags(0);
+  if(BinWidthOption(opt, 2, false, widthflags)){
+    double point[2] = {hist->GetXaxis()->GetBinCenter(hist->GetXaxis()->FindBin(labelX)),
+                       hist->GetYaxis()->GetBinCenter(hist->GetYaxis()->FindBin(labelY))};
+    hist->Fill(labelX, labelY, weight * BinWidthFactor(widthflags, hist, point));
+    return;
+  }
   TString optstring(opt);
   Double_t myweight = optstring.Contains("w") ? 1. : weight;
   if(optstring.Contains("wx")){
@@ -542,6 +579,12 @@ void THistManager::FillTH3(const char* name, double x, double y, double z, doubl
 		Fatal("THistManager::FillTH3", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
 		return;
 	}
+	UInt_t widthflags(0);
+	if(BinWidthOption(opt, 3, false, widthflags)){
+	  double point[3] = {x, y, z};
+	  hist->Fill(x, y, z, weight * BinWidthFactor(widthflags, hist, point));
+	  return;
+	}
 	TString optstring(opt);
 	Double_t myweight = optstring.Contains("w") ? 1. : weight;
 	if(optstring.Contains("wx")){
@@ -571,6 +614,11 @@ void THistManager::FillTH3(const char* name, const double* point, double weight,
 		Fatal("THistManager::FillTH3", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
 		return;
 	}
+	UInt_t widthflags(0);
+	if(BinWidthOption(opt, 3, false, widthflags)){
+	  hist->Fill(point[0], point[1], point[2], weight * BinWidthFactor(widthflags, hist, point));
+	  return;
+	}
 	TString optstring(opt);
 	Double_t myweight = optstring.Contains("w") ? 1. : weight;
 	if(optstring.Contains("wx")){
@@ -600,6 +648,11 @@ void THistManager::FillTHnSparse(const char *name, const double *x, double weigh
 		Fatal("THistManager::FillTHnSparse", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
 		return;
 	}
+	UInt_t widthflags(0);
+	if(BinWidthOption(opt, hist->GetNdimensions(), true, widthflags)){
+	  hist->Fill(x, weight * BinWidthFactor(widthflags, hist, x));
+	  return;
+	}
 	TString optstring(opt);
 	Double_t myweight = optstring.Contains("w") ? 1. : weight;
 	for(Int_t iaxis = 0; iaxis < hist->GetNdimensions(); iaxis++){
@@ -625,6 +678,176 @@ void THistManager::FillProfile(const char* name, double x, double y, double weig
   hist->Fill(x, y, weight);
 }
 
+Int_t THistManager::GetHistogramHandle(const char *name, Option_t *opt){
+  TString dirname(basename(name)), hname(histname(name));
+  THashList *parent(FindGroup(dirname));
+  if(!parent){
+    Fatal("THistManager::GetHistogramHandle", "Parent group %s does not exist", dirname.Data());
+    return -1;
+  }
+  TObject *hist = parent->FindObject(hname);
+  if(!hist){
+    Fatal("THistManager::GetHistogramHandle", "Histogram %s not found in parent group %s", hname.Data(), dirname.Data());
+    return -1;
+  }
+
+  // Order matters: profiles inherit from TH1/TH2/TH3, TH3 from TH1
+  UInt_t flags(0), widthflags(0);
+  if(dynamic_cast<TProfile3D *>(hist)) {
+    Fatal("THistManager::GetHistogramHandle", "Histogram %s: TProfile3D not supported", name);
+    return -1;
+  }
+  else if(dynamic_cast<TProfile2D *>(hist)) flags = kHandleTProfile2D;
+  else if(dynamic_cast<TProfile *>(hist)) flags = kHandleTProfile;
+  else if(dynamic_cast<TH3 *>(hist)) {
+    BinWidthOption(opt, 3, false, widthflags);
+    flags = kHandleTH3;
+  }
+  else if(dynamic_cast<TH2 *>(hist)) {
+    BinWidthOption(opt, 2, false, widthflags);
+    flags = kHandleTH2;
+  }
+  else if(dynamic_cast<TH1 *>(hist)) {
+    BinWidthOption(opt, 1, false, widthflags);
+    flags = kHandleTH1;
+  }
+  else if(THnSparse *hsparse = dynamic_cast<THnSparse *>(hist)) {
+    BinWidthOption(opt, hsparse->GetNdimensions(), true, widthflags);
+    flags = kHandleTHnSparse;
+  }
+  else {
+    Fatal("THistManager::GetHistogramHandle", "Object %s is not of a supported histogram type", name);
+    return -1;
+  }
+  flags |= widthflags << kHandleWidthShift;
+
+  // Re-use handle if the same histogram was already resolved with the same options
+  for(std::vector<TObject *>::size_type ihandle = 0; ihandle < fHandleHistos.size(); ihandle++){
+    if(fHandleHistos[ihandle] == hist && fHandleFlags[ihandle] == flags) return static_cast<Int_t>(ihandle);
+  }
+  fHandleHistos.push_back(hist);
+  fHandleFlags.push_back(flags);
+  return static_cast<Int_t>(fHandleHistos.size() - 1);
+}
+
+void THistManager::FillTH1(Int_t handle, double x, double weight){
+  CheckHandle(handle, kHandleTH1, "THistManager::FillTH1");
+  TH1 *hist = static_cast<TH1 *>(fHandleHistos[handle]);
+  UInt_t widthflags = fHandleFlags[handle] >> kHandleWidthShift;
+  if(widthflags) weight *= BinWidthFactor(widthflags, hist, &x);
+  hist->Fill(x, weight);
+}
+
+void THistManager::FillTH2(Int_t handle, double x, double y, double weight){
+  CheckHandle(handle, kHandleTH2, "THistManager::FillTH2");
+  TH2 *hist = static_cast<TH2 *>(fHandleHistos[handle]);
+  UInt_t widthflags = fHandleFlags[handle] >> kHandleWidthShift;
+  if(widthflags){
+    double point[2] = {x, y};
+    weight *= BinWidthFactor(widthflags, hist, point);
+  }
+  hist->Fill(x, y, weight);
+}
+
+void THistManager::FillTH3(Int_t handle, double x, double y, double z, double weight){
+  CheckHandle(handle, kHandleTH3, "THistManager::FillTH3");
+  TH3 *hist = static_cast<TH3 *>(fHandleHistos[handle]);
+  UInt_t widthflags = fHandleFlags[handle] >> kHandleWidthShift;
+  if(widthflags){
+    double point[3] = {x, y, z};
+    weight *= BinWidthFactor(widthflags, hist, point);
+  }
+  hist->Fill(x, y, z, weight);
+}
+
+void THistManager::FillTHnSparse(Int_t handle, const double *x, double weight){
+  CheckHandle(handle, kHandleTHnSparse, "THistManager::FillTHnSparse");
+  THnSparse *hist = static_cast<THnSparse *>(fHandleHistos[handle]);
+  UInt_t widthflags = fHandleFlags[handle] >> kHandleWidthShift;
+  if(widthflags) weight *= BinWidthFactor(widthflags, hist, x);
+  hist->Fill(x, weight);
+}
+
+void THistManager::FillProfile(Int_t handle, double x, double y, double weight){
+  CheckHandle(handle, kHandleTProfile, "THistManager::FillProfile");
+  static_cast<TProfile *>(fHandleHistos[handle])->Fill(x, y, weight);
+}
+
+void THistManager::FillProfile2D(Int_t handle, double x, double y, double z, double weight){
+  CheckHandle(handle, kHandleTProfile2D, "THistManager::FillProfile2D");
+  static_cast<TProfile2D *>(fHandleHistos[handle])->Fill(x, y, z, weight);
+}
+
+void THistManager::CheckHandle(Int_t handle, HandleType_t type, const char *method) const {
+  if(handle < 0 || static_cast<std::vector<UInt_t>::size_type>(handle) >= fHandleFlags.size()){
+    Fatal(method, "Invalid histogram handle %d", handle);
+    return;
+  }
+  if(static_cast<Int_t>(fHandleFlags[handle] & kHandleTypeMask) != type)
+    Fatal(method, "Histogram %s connected to handle %d is of different type", fHandleHistos[handle]->GetName(), handle);
+}
+
+bool THistManager::BinWidthOption(Option_t *opt, Int_t ndim, bool sparse, UInt_t &widthflags){
+  // tokens are compared exactly, so that i.e. binwidth1 does not match binwidth10
+  widthflags = 0;
+  TString optstring(opt);
+  if(!optstring.Contains("binwidth")) return false;
+  bool found(false);
+  TObjArray *tokens = optstring.Tokenize(" ,;");
+  TIter tokenIter(tokens);
+  TObjString *token(NULL);
+  while((token = static_cast<TObjString *>(tokenIter()))){
+    const TString &tokstring = token->String();
+    if(!tokstring.BeginsWith("binwidth")) continue;
+    found = true;
+    TString axisname = tokstring(8, tokstring.Length() - 8);
+    if(!axisname.Length()){
+      // all axes
+      for(Int_t iaxis = 0; iaxis < ndim && iaxis < kMaxWidthAxes; iaxis++) widthflags |= 1 << iaxis;
+      continue;
+    }
+    Int_t iaxis(-1);
+    if(sparse){
+      if(axisname.IsDigit()) iaxis = axisname.Atoi();
+    } else {
+      if(axisname == "x") iaxis = 0;
+      else if(axisname == "y") iaxis = 1;
+      else if(axisname == "z") iaxis = 2;
+    }
+    if(iaxis < 0 || iaxis >= ndim || iaxis >= kMaxWidthAxes){
+      delete tokens;
+      ::Fatal("THistManager::BinWidthOption", "Invalid bin width option %s for a %d-dimensional histogram", tokstring.Data(), ndim);
+      return false;
+    }
+    widthflags |= 1 << iaxis;
+  }
+  delete tokens;
+  return found;
+}
+
+Double_t THistManager::BinWidthFactor(UInt_t widthflags, const TH1 *hist, const double *point){
+  const TAxis *axes[3] = {hist->GetXaxis(), hist->GetYaxis(), hist->GetZaxis()};
+  Double_t weight(1.);
+  for(Int_t iaxis = 0; iaxis < 3 && widthflags; iaxis++, widthflags >>= 1){
+    if(widthflags & 1) weight *= InverseBinWidth(axes[iaxis], point[iaxis]);
+  }
+  return weight;
+}
+
+Double_t THistManager::BinWidthFactor(UInt_t widthflags, const THnBase *hist, const double *point){
+  Double_t weight(1.);
+  for(Int_t iaxis = 0; iaxis < hist->GetNdimensions() && widthflags; iaxis++, widthflags >>= 1){
+    if(widthflags & 1) weight *= InverseBinWidth(hist->GetAxis(iaxis), point[iaxis]);
+  }
+  return weight;
+}
+
+Double_t THistManager::InverseBinWidth(const TAxis *axis, Double_t x){
+  Int_t bin = axis->FindFixBin(x);
+  if(bin < 1 || bin > axis->GetNbins()) return 1.;
+  return 1./axis->GetBinWidth(bin);
+}
+
 TObject *THistManager::FindObject(const char *name) const {
 	TString dirname(basename(name)), hname(histname(name));
 	THashList *parent(FindGroup(dirname));
@@ -1030,6 +1253,228 @@ namespace TestTHistManager {
     return success ? 0 : 1;
   }
 
+  int THistManagerTestSuite::TestFillHandleHistograms(){
+    THistManager testmgr("testmgr");
+
+    testmgr.CreateTH1("Group1/Test1", "Test fill 1D histogram via handle", 1, 0., 1.);
+    testmgr.CreateTH2("Group1/Test2", "Test fill 2D histogram via handle", 1, 0., 1., 1, 0., 1.);
+    testmgr.CreateTH3("Group2/Test3", "Test fill 3D histogram via handle", 1, 0., 1., 1, 0., 1., 1, 0., 1.);
+    int nbins[4] = {1,1,1,1}; double min[4] = {0.,0.,0.,0.}, max[4] = {1.,1.,1.,1.};
+    testmgr.CreateTHnSparse("Group2/TestN", "Test fill THnSparse via handle", 4, nbins, min, max);
+    testmgr.CreateTProfile("Group3/Subgroup1/TestProfile", "Test fill Profile histogram via handle", 1, 0., 1.);
+
+    int h1 = testmgr.GetHistogramHandle("Group1/Test1"),
+        h2 = testmgr.GetHistogramHandle("Group1/Test2"),
+        h3 = testmgr.GetHistogramHandle("Group2/Test3"),
+        hN = testmgr.GetHistogramHandle("Group2/TestN"),
+        hP = testmgr.GetHistogramHandle("Group3/Subgroup1/TestProfile");
+
+    bool success(true);
+    if(testmgr.GetHistogramHandle("Group1/Test1") != h1){
+      std::cout << "Group1/Test1: Handle not re-used for the same histogram" << std::endl;
+      success = false;
+    }
+
+    double point[4] = {0.5, 0.5, 0.5, 0.5};
+    for(int i = 0; i < 100; i++){
+      testmgr.FillTH1(h1, 0.5);
+      testmgr.FillTH2(h2, 0.5, 0.5);
+      testmgr.FillTH3(h3, 0.5, 0.5, 0.5);
+      testmgr.FillTHnSparse(hN, point);
+      testmgr.FillProfile(hP, 0.5, 1.);
+    }
+
+    // Evaluate test
+    TH1 *test1 = dynamic_cast<TH1 *>(testmgr.FindObject("Group1/Test1"));
+    if(!test1 || TMath::Abs(test1->GetBinContent(1) - 100) > DBL_EPSILON){
+      std::cout << "Group1/Test1: Not found or value mismatch, expected 100" << std::endl;
+      success = false;
+    }
+    TH2 *test2 = dynamic_cast<TH2 *>(testmgr.FindObject("Group1/Test2"));
+    if(!test2 || TMath::Abs(test2->GetBinContent(1,1) - 100) > DBL_EPSILON){
+      std::cout << "Group1/Test2: Not found or value mismatch, expected 100" << std::endl;
+      success = false;
+    }
+    TH3 *test3 = dynamic_cast<TH3 *>(testmgr.FindObject("Group2/Test3"));
+    if(!test3 || TMath::Abs(test3->GetBinContent(1,1,1) - 100) > DBL_EPSILON){
+      std::cout << "Group2/Test3: Not found or value mismatch, expected 100" << std::endl;
+      success = false;
+    }
+    THnSparse *testN = dynamic_cast<THnSparse *>(testmgr.FindObject("Group2/TestN"));
+    int index[4] = {1,1,1,1};
+    if(!testN || TMath::Abs(testN->GetBinContent(index) - 100) > DBL_EPSILON){
+      std::cout << "Group2/TestN: Not found or value mismatch, expected 100" << std::endl;
+      success = false;
+    }
+    TProfile *testProfile = dynamic_cast<TProfile *>(testmgr.FindObject("Group3/Subgroup1/TestProfile"));
+    if(!testProfile || TMath::Abs(testProfile->GetBinContent(1) - 1) > DBL_EPSILON){
+      std::cout << "Group3/Subgroup1/TestProfile: Not found or value mismatch, expected 1" << std::endl;
+      success = false;
+    }
+    return success ? 0 : 1;
+  }
+
+  int THistManagerTestSuite::TestFillBinWidthHistograms(){
+    THistManager testmgr("testmgr");
+
+    // variable binning, the last bin is filled as well
+    double xbins[4] = {0., 1., 3., 7.};
+    int nbins[2] = {3, 3};
+    double min[2] = {0., 0.}, max[2] = {7., 7.};
+    const char *methods[2] = {"Name", "Handle"};
+    for(int imethod = 0; imethod < 2; imethod++){
+      testmgr.CreateTH1(Form("%s/Test1", methods[imethod]), "Test bin width correction 1D", 3, xbins);
+      testmgr.CreateTH2(Form("%s/Test2", methods[imethod]), "Test bin width correction 2D", 3, xbins, 3, xbins);
+      testmgr.CreateTHnSparse(Form("%s/TestN", methods[imethod]), "Test bin width correction nD", 2, nbins, min, max);
+    }
+    testmgr.CreateTH1("Name/Test1W", "Test bin width correction with weight", 3, xbins);
+    testmgr.CreateTH1("Handle/Test1W", "Test bin width correction with weight", 3, xbins);
+    testmgr.CreateTH1("Name/Test1Legacy", "Test legacy bin width correction", 3, xbins);
+    // 11 axes, bin width 2: binwidth10 must not select axis 1
+    int nbins11[11];
+    double dmin11[11], dmax11[11], point11[11];
+    for(int iaxis = 0; iaxis < 11; iaxis++){
+      nbins11[iaxis] = 2;
+      dmin11[iaxis] = 0.;
+      dmax11[iaxis] = 4.;
+      point11[iaxis] = 1.;
+    }
+    testmgr.CreateTHnSparse("Name/TestN11", "Test exact bin width options", 11, nbins11, dmin11, dmax11);
+    TProfile2D *profile = new TProfile2D("TestProfile2D", "Test fill TProfile2D via handle", 1, 0., 1., 1, 0., 1.);
+    testmgr.SetObject(profile);
+
+    int h1 = testmgr.GetHistogramHandle("Handle/Test1", "binwidth"),
+        h1w = testmgr.GetHistogramHandle("Handle/Test1W", "binwidthx"),
+        h2 = testmgr.GetHistogramHandle("Handle/Test2", "binwidthx binwidthy"),
+        hN = testmgr.GetHistogramHandle("Handle/TestN", "binwidth1"),
+        hP = testmgr.GetHistogramHandle("TestProfile2D");
+
+    double values[4] = {0.5, 2., 5., 6.9};
+    for(int ix = 0; ix < 4; ix++){
+      for(int iy = 0; iy < 4; iy++){
+        double point[2] = {values[ix], values[iy]};
+        testmgr.FillTH1("Name/Test1", point[0], 1., "binwidth");
+        testmgr.FillTH1("Name/Test1W", point[0], 2., "binwidthx");
+        testmgr.FillTH1("Name/Test1Legacy", point[0], 1., "w");
+        testmgr.FillTH2("Name/Test2", point[0], point[1], 1., "binwidthx,binwidthy");
+        testmgr.FillTHnSparse("Name/TestN", point, 1., "binwidth1");
+        testmgr.FillTH1(h1, point[0]);
+        testmgr.FillTH1(h1w, point[0], 2.);
+        testmgr.FillTH2(h2, point[0], point[1]);
+        testmgr.FillTHnSparse(hN, point);
+        testmgr.FillProfile2D(hP, 0.5, 0.5, values[ix]);
+      }
+    }
+    testmgr.FillTHnSparse("Name/TestN11", point11, 1., "binwidth10");
+
+    // Evaluate test
+    bool success(true);
+    const char *histnames[3] = {"Test1", "Test1W", "Test2"};
+    for(int ihist = 0; ihist < 3; ihist++){
+      TH1 *byname = dynamic_cast<TH1 *>(testmgr.FindObject(Form("Name/%s", histnames[ihist]))),
+          *byhandle = dynamic_cast<TH1 *>(testmgr.FindObject(Form("Handle/%s", histnames[ihist])));
+      for(int ibin = 0; ibin < byname->GetNcells(); ibin++){
+        if(TMath::Abs(byname->GetBinContent(ibin) - byhandle->GetBinContent(ibin)) > DBL_EPSILON){
+          std::cout << histnames[ihist] << ": Content in bin " << ibin << " differs between name and handle fill" << std::endl;
+          success = false;
+        }
+      }
+    }
+    // 8 entries in the last bin (width 4)
+    TH1 *test1 = dynamic_cast<TH1 *>(testmgr.FindObject("Name/Test1"));
+    if(TMath::Abs(test1->GetBinContent(3) - 8./4.) > DBL_EPSILON){
+      std::cout << "Name/Test1: Last bin not corrected for the bin width, expected 2" << std::endl;
+      success = false;
+    }
+    // the weight is multiplied by the inverse bin width
+    TH1 *test1w = dynamic_cast<TH1 *>(testmgr.FindObject("Name/Test1W"));
+    if(TMath::Abs(test1w->GetBinContent(2) - 2. * 4./2.) > DBL_EPSILON){
+      std::cout << "Name/Test1W: Weight not multiplied by the inverse bin width, expected 4" << std::endl;
+      success = false;
+    }
+    // legacy option: weight replaced by the inverse bin width, last bin not corrected
+    TH1 *test1legacy = dynamic_cast<TH1 *>(testmgr.FindObject("Name/Test1Legacy"));
+    double legacyexpected[3] = {4., 2., 8.};
+    for(int ibin = 1; ibin <= 3; ibin++){
+      if(TMath::Abs(test1legacy->GetBinContent(ibin) - legacyexpected[ibin-1]) > DBL_EPSILON){
+        std::cout << "Name/Test1Legacy: Content in bin " << ibin << " differs from the legacy option, expected " << legacyexpected[ibin-1] << std::endl;
+        success = false;
+      }
+    }
+    THnSparse *testN11 = dynamic_cast<THnSparse *>(testmgr.FindObject("Name/TestN11"));
+    if(TMath::Abs(testN11->GetSumw() - 0.5) > DBL_EPSILON){
+      std::cout << "Name/TestN11: binwidth10 does not correct axis 10 only, expected 0.5" << std::endl;
+      success = false;
+    }
+    THnSparse *testNname = dynamic_cast<THnSparse *>(testmgr.FindObject("Name/TestN")),
+              *testNhandle = dynamic_cast<THnSparse *>(testmgr.FindObject("Handle/TestN"));
+    for(int ix = 1; ix <= 3; ix++){
+      for(int iy = 1; iy <= 3; iy++){
+        int index[2] = {ix, iy};
+        if(TMath::Abs(testNname->GetBinContent(index) - testNhandle->GetBinContent(index)) > DBL_EPSILON){
+          std::cout << "TestN: Content in bin (" << ix << "," << iy << ") differs between name and handle fill" << std::endl;
+          success = false;
+        }
+      }
+    }
+    if(TMath::Abs(profile->GetBinContent(1, 1) - (0.5 + 2. + 5. + 6.9) / 4.) > 1e-12){
+      std::cout << "TestProfile2D: Value mismatch, expected " << (0.5 + 2. + 5. + 6.9) / 4. << std::endl;
+      success = false;
+    }
+    return success ? 0 : 1;
+  }
+
+  int THistManagerTestSuite::BenchmarkFill(int nfill){
+    // Structure as in AliAnalysisTaskEmcalJetSample: one group per container,
+    // 4 centrality classes per histogram type
+    const int kNcent = 4;
+    const char *groups[3] = {"tracks", "caloClusters", "Jet_AKTChargedR040_tracks_pT0150_pt_scheme"};
+    const char *histtypes[3] = {"histPt", "histPhi", "histEta"};
+    THistManager testmgr("benchmgr");
+    std::vector<std::string> names;
+    for(int igroup = 0; igroup < 3; igroup++){
+      for(int itype = 0; itype < 3; itype++){
+        for(int icent = 0; icent < kNcent; icent++){
+          TString histname = TString::Format("%s/%s_%d", groups[igroup], histtypes[itype], icent);
+          testmgr.CreateTH1(histname, histname, 100, 0., 100.);
+          names.push_back(histname.Data());
+        }
+      }
+    }
+    std::vector<int> handles;
+    for(std::vector<std::string>::const_iterator nameiter = names.begin(); nameiter != names.end(); ++nameiter)
+      handles.push_back(testmgr.GetHistogramHandle(nameiter->c_str()));
+
+    TStopwatch timer;
+    timer.Start();
+    for(int ifill = 0; ifill < nfill; ifill++){
+      // Name built per fill, as done in typical tasks
+      TString histname = TString::Format("%s/%s_%d", groups[ifill % 3], histtypes[(ifill / 3) % 3], ifill % kNcent);
+      testmgr.FillTH1(histname, static_cast<double>(ifill % 100));
+    }
+    timer.Stop();
+    double timename = timer.RealTime();
+
+    timer.Start();
+    for(int ifill = 0; ifill < nfill; ifill++){
+      TString histname = TString::Format("%s/%s_%d", groups[ifill % 3], histtypes[(ifill / 3) % 3], ifill % kNcent);
+    }
+    timer.Stop();
+    double timeformat = timer.RealTime();
+
+    timer.Start();
+    for(int ifill = 0; ifill < nfill; ifill++){
+      testmgr.FillTH1(handles[ifill % handles.size()], static_cast<double>(ifill % 100));
+    }
+    timer.Stop();
+    double timehandle = timer.RealTime();
+
+    std::cout << "Time per fill (by name, incl. name formatting): " << timename / nfill * 1e9 << " ns" << std::endl;
+    std::cout << "Time per fill (by name, excl. name formatting): " << (timename - timeformat) / nfill * 1e9 << " ns" << std::endl;
+    std::cout << "Time per fill (by handle):                      " << timehandle / nfill * 1e9 << " ns" << std::endl;
+    return 0;
+  }
+
   int TestRunAll(){
     int testresult(0);
     THistManagerTestSuite testsuite;
@@ -1050,6 +1495,14 @@ namespace TestTHistManager {
     testresult += testsuite.TestFillGroupedHistograms();
     std::cout << "Result after test: " << testresult << std::endl;
 
+    std::cout << "Running test: Fill Handle" << std::endl;
+    testresult += testsuite.TestFillHandleHistograms();
+    std::cout << "Result after test: " << testresult << std::endl;
+
+    std::cout << "Running test: Fill Bin Width" << std::endl;
+    testresult += testsuite.TestFillBinWidthHistograms();
+    std::cout << "Result after test: " << testresult << std::endl;
+
     return testresult;
   }
 
@@ -1072,4 +1525,19 @@ namespace TestTHistManager {
     THistManagerTestSuite testsuite;
     return testsuite.TestFillGroupedHistograms();
   }
+
+  int TestRunFillHandle(){
+    THistManagerTestSuite testsuite;
+    return testsuite.TestFillHandleHistograms();
+  }
+
+  int TestRunFillBinWidth(){
+    THistManagerTestSuite testsuite;
+    return testsuite.TestFillBinWidthHistograms();
+  }
+
+  int TestRunBenchmarkFill(int nfill){
+    THistManagerTestSuite testsuite;
+    return testsuite.BenchmarkFill(nfill);
+  }
 }
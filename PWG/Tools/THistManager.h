@@ -7,6 +7,7 @@
 #include <TIterator.h>
 #include <TNamed.h>
 #include <iterator>
+#include <vector>
 
 class TArrayD;
 class TAxis;
@@ -15,6 +16,7 @@ class TList;
 class TH1;
 class TH2;
 class TH3;
+class THnBase;
 class THnSparse;
 class TProfile;
 
@@ -94,7 +96,38 @@ class TProfile;
  * manager when filling the histogram. For this purpose the Fill methods provide
  * an argument for options. Automatic correction for the bin width is done when
  * specifying the argument *W*, followed by the direction. Adding multiple directions
- * the weight is calculated for all directions at the same time.
+ * the weight is calculated for all directions at the same time. If a bin width
+ * correction is requested the weight of the entry is replaced by the inverse bin
+ * width (for backward compatibility; the last bin is not corrected).
+ *
+ * In addition the options *binwidth* (all axes), *binwidthx*, *binwidthy*,
+ * *binwidthz* (TH1/TH2/TH3) and *binwidth0*, *binwidth1*, ... (THnSparse) are
+ * supported, separated by space, comma or semicolon. With these options the weight
+ * of the entry is multiplied by the product of the inverse bin widths of the
+ * selected axes, including the last bin (underflow and overflow are not corrected).
+ * Tokens are matched exactly, i.e. binwidth1 does not select axis 10.
+ *
+ * # Fast filling via histogram handles
+ *
+ * Filling by name requires splitting the name into group and histogram name,
+ * a lookup of the group and the histogram in the hash lists and the parsing
+ * of the option string for each call. For histograms filled in tight loops
+ * (i.e. per track or per cluster) the histogram can be resolved once, typically
+ * in UserCreateOutputObjects, into an integer handle using GetHistogramHandle.
+ * The Fill methods taking a handle access the histogram directly without any
+ * string operation or hash lookup. The bin width correction is specified
+ * when the handle is resolved, using the *binwidth* options of the name-based
+ * Fill functions:
+ *
+ * ~~~{.cxx}
+ * // in UserCreateOutputObjects
+ * fHandlePt = mgr.GetHistogramHandle("tracks/hPt", "binwidthx");
+ * // in the event loop
+ * mgr.FillTH1(fHandlePt, pt);
+ * ~~~
+ *
+ * Handles are transient: they are only valid for the histogram manager
+ * instance which created them and are not streamed.
  */
 class THistManager : public TNamed {
 public:
@@ -634,6 +667,76 @@ public:
 	 */
   void FillProfile(const char *name, double x, double y, double weight = 1.);
 
+  /**
+   * @brief Resolve a histogram into a handle for fast filling.
+   *
+   * The histogram name also contains the parent group(s)
+   * according to the common group notation. Supported options
+   * are the bin width correction options binwidth, binwidthx,
+   * binwidthy, binwidthz (TH1/TH2/TH3) and binwidth0, binwidth1, ...
+   * (THnSparse), with the same meaning as for the name-based Fill
+   * functions. Options are ignored for profiles. TProfile2D histograms are filled via
+   * FillProfile2D, TProfile3D is not supported.
+   * @param[in] name Name of the histogram
+   * @param[in] opt Optional filling arguments applied for each fill via the handle
+   * @return Handle of the histogram to be used in the Fill functions
+   */
+  Int_t GetHistogramHandle(const char *name, Option_t *opt = "");
+
+  /**
+   * @brief Fill a 1D histogram via its handle
+   * @param[in] handle Handle obtained from GetHistogramHandle
+   * @param[in] x x-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void FillTH1(Int_t handle, double x, double weight = 1.);
+
+  /**
+   * @brief Fill a 2D histogram via its handle
+   * @param[in] handle Handle obtained from GetHistogramHandle
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void FillTH2(Int_t handle, double x, double y, double weight = 1.);
+
+  /**
+   * @brief Fill a 3D histogram via its handle
+   * @param[in] handle Handle obtained from GetHistogramHandle
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] z z-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void FillTH3(Int_t handle, double x, double y, double z, double weight = 1.);
+
+  /**
+   * @brief Fill a nD histogram via its handle
+   * @param[in] handle Handle obtained from GetHistogramHandle
+   * @param[in] x coordinates of the data
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void FillTHnSparse(Int_t handle, const double *x, double weight = 1.);
+
+  /**
+   * @brief Fill a profile histogram via its handle
+   * @param[in] handle Handle obtained from GetHistogramHandle
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void FillProfile(Int_t handle, double x, double y, double weight = 1.);
+
+  /**
+   * @brief Fill a 2D profile histogram via its handle
+   * @param[in] handle Handle obtained from GetHistogramHandle
+   * @param[in] x x-coordinate
+   * @param[in] y y-coordinate
+   * @param[in] z z-coordinate (profiled value)
+   * @param[in] weight optional weight of the entry (default 1)
+   */
+  void FillProfile2D(Int_t handle, double x, double y, double z, double weight = 1.);
+
   /**
    * @brief Create forward iterator starting at the beginning of the
    * container
@@ -695,6 +798,78 @@ private:
 	THistManager(const THistManager &);
 	THistManager &operator=(const THistManager &);
 
+	/**
+	 * @enum HandleType_t
+	 * @brief Histogram type connected to a handle
+	 *
+	 * The type is stored in the lowest bits of the handle
+	 * flags, the bin width correction per axis in the bits
+	 * above kHandleWidthShift.
+	 */
+	enum HandleType_t {
+	  kHandleTH1 = 0,          ///< 1D histogram (not TProfile)
+	  kHandleTH2 = 1,          ///< 2D histogram
+	  kHandleTH3 = 2,          ///< 3D histogram
+	  kHandleTHnSparse = 3,    ///< THnSparse
+	  kHandleTProfile = 4,     ///< TProfile
+	  kHandleTProfile2D = 5,   ///< TProfile2D
+	  kHandleTypeMask = 0x7,   ///< Mask for the histogram type
+	  kHandleWidthShift = 3,   ///< First bit used for the bin width correction
+	  kMaxWidthAxes = 29       ///< Maximum number of axes which can be corrected for the bin width
+	};
+
+	/**
+	 * @brief Check whether handle is valid and of the expected type
+	 *
+	 * Fatal if the handle does not exist or points to a
+	 * histogram of a different type.
+	 * @param[in] handle Handle to check
+	 * @param[in] type Expected histogram type
+	 * @param[in] method Name of the calling method (for the error message)
+	 */
+	void CheckHandle(Int_t handle, HandleType_t type, const char *method) const;
+
+	/**
+	 * @brief Decode the explicit bin width correction options
+	 *
+	 * Shared by the name-based Fill functions and GetHistogramHandle.
+	 * Only exact binwidth tokens are considered, the legacy w options
+	 * of the name-based Fill functions are handled there. Fatal for
+	 * tokens selecting an axis the histogram does not have.
+	 * @param[in] opt Option string (binwidth, binwidthx, binwidthy, binwidthz, or binwidth0, binwidth1, ... for THnSparse)
+	 * @param[in] ndim Number of dimensions of the histogram
+	 * @param[in] sparse If true the THnSparse notation is used
+	 * @param[out] widthflags Bit mask of the axes to be corrected for the bin width
+	 * @return True if the option string contains a binwidth token
+	 */
+	static bool BinWidthOption(Option_t *opt, Int_t ndim, bool sparse, UInt_t &widthflags);
+
+	/**
+	 * @brief Factor multiplying the entry weight for the bin width correction
+	 * @param[in] widthflags Bit mask of the axes to be corrected
+	 * @param[in] hist Histogram to be filled
+	 * @param[in] point Coordinates of the entry
+	 * @return Product of the inverse bin widths of the selected axes
+	 */
+	static Double_t BinWidthFactor(UInt_t widthflags, const TH1 *hist, const double *point);
+
+	/**
+	 * @brief Factor multiplying the entry weight for the bin width correction
+	 * @param[in] widthflags Bit mask of the axes to be corrected
+	 * @param[in] hist Histogram to be filled
+	 * @param[in] point Coordinates of the entry
+	 * @return Product of the inverse bin widths of the selected axes
+	 */
+	static Double_t BinWidthFactor(UInt_t widthflags, const THnBase *hist, const double *point);
+
+	/**
+	 * @brief Calculate the inverse bin width for the bin of x
+	 * @param[in] axis Axis of the histogram
+	 * @param[in] x Value on the axis
+	 * @return Inverse bin width (1 for underflow and overflow bins)
+	 */
+	static Double_t InverseBinWidth(const TAxis *axis, Double_t x);
+
 
 	/**
 	 * @brief Find histogram group.
@@ -721,6 +896,8 @@ private:
 
 	THashList *fHistos;                   ///< List of histograms
 	bool fIsOwner;                        ///< Set the ownership
+	std::vector<TObject *> fHandleHistos; //!<! Histograms resolved via GetHistogramHandle
+	std::vector<UInt_t> fHandleFlags;     //!<! Type and bin width options for each handle
 
   /// \cond CLASSIMP
 	ClassDef(THistManager, 1);  // Container for histograms
@@ -845,6 +1022,52 @@ public:
    * @return 0 if test is passed, 1 if it failed
    */
   int TestFillGroupedHistograms();
+
+  /**
+   * Purpose of the test: Check whether histograms filled via handles
+   * obtain the same content as histograms filled via their name
+   * Relies on: TestFillSimpleHistograms, TestFillGroupedHistograms
+   *
+   * Creating histograms of all types in a group and in a subgroup and
+   * filling each of them 100 times via their handle.
+   *
+   * Test passed:
+   * - All histograms need to have in its 1 bin the bin content 100 (1 for the profile)
+   * - Requesting the same histogram twice returns the same handle
+   * @return 0 if test is passed, 1 if it failed
+   */
+  int TestFillHandleHistograms();
+
+  /**
+   * Purpose of the test: Check that the bin width correction gives the same
+   * result for the name-based and the handle-based Fill functions
+   * Relies on: TestFillHandleHistograms
+   *
+   * Filling TH1, TH2 and THnSparse with variable binning, including the
+   * last bin, with the binwidth options via name and via handle, a TH1
+   * with the legacy w option, an 11-dimensional THnSparse with the option
+   * binwidth10 and a TProfile2D via handle.
+   *
+   * Test passed:
+   * - Histograms filled via name and via handle have the same content in all bins
+   * - The last bin is corrected for the bin width
+   * - The weight is multiplied by the inverse bin width
+   * - The legacy w option gives the same content as before
+   * - binwidth10 only corrects axis 10
+   * - The TProfile2D contains the mean of the profiled values
+   * @return 0 if test is passed, 1 if it failed
+   */
+  int TestFillBinWidthHistograms();
+
+  /**
+   * Benchmark comparing the per-fill cost of the name-based and the handle-based
+   * Fill functions. The histogram structure mimics a typical EMCAL jet task (groups
+   * per container with centrality dependent histograms, see AliAnalysisTaskEmcalJetSample).
+   * The time per fill is printed to stdout.
+   * @param[in] nfill Number of fills per histogram
+   * @return 0 (benchmark does not define a failure condition)
+   */
+  int BenchmarkFill(int nfill);
 };
 
 /**
@@ -882,5 +1105,27 @@ int TestRunFillSimple();
  */
 int TestRunFillGrouped();
 
+/**
+ * Run the test for filling histograms via handles. See @ref THistManagerTestSuite
+ * for details.
+ * @return 0 if test is passed, 1 if failed
+ */
+int TestRunFillHandle();
+
+/**
+ * Run the test for the bin width correction via name and via handle.
+ * See @ref THistManagerTestSuite for details.
+ * @return 0 if test is passed, 1 if failed
+ */
+int TestRunFillBinWidth();
+
+/**
+ * Run the fill benchmark. See @ref THistManagerTestSuite
+ * for details.
+ * @param[in] nfill Number of fills per histogram
+ * @return always 0
+ */
+int TestRunBenchmarkFill(int nfill = 1000000);
+
 }
 #endif
@@ -25,6 +25,7 @@
 #include "AliUEHistograms.h"
 
 #include "AliCFContainer.h"
+#include "AliTHn.h"
 #include "AliBasicParticle.h"
 #include "AliVParticle.h"
 #include "AliAODTrack.h"
@@ -77,7 +78,11 @@ AliUEHistograms::AliUEHistograms(const char* name, const char* histograms, const
   fTwoTrackCutMinRadius(0.8),
   fCheckEventNumberInCorrelation(kFALSE),
   fRunNumber(0),
-  fMergeCount(1)
+  fMergeCount(1),
+  fBendingScan(),
+  fTriggerBendingScan(),
+  fBendingScanDone(),
+  fTriggerBendingScanDone()
 {
   // Constructor
   //
@@ -248,7 +253,11 @@ AliUEHistograms::AliUEHistograms(const AliUEHistograms &c) :
   fTwoTrackCutMinRadius(0.8),
   fCheckEventNumberInCorrelation(kFALSE),
   fRunNumber(0),
-  fMergeCount(1)
+  fMergeCount(1),
+  fBendingScan(),
+  fTriggerBendingScan(),
+  fBendingScanDone(),
+  fTriggerBendingScanDone()
 {
   //
   // AliUEHistograms copy constructor
@@ -566,11 +575,22 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
     TH1::AddDirectory(oldStatus);
   }
 
-  // Eta() is extremely time consuming, therefore cache it for the inner loop here:
+  // Pt(), Eta(), Phi() and Charge() are virtual calls (and Eta() is extremely time consuming), therefore the
+  // particle properties are packed once into contiguous arrays which are used in the pair loops below
   TObjArray* input = (mixed) ? mixed : particles;
-  TArrayF eta(input->GetEntriesFast());
-  for (Int_t i=0; i<input->GetEntriesFast(); i++)
-    eta[i] = ((AliVParticle*) input->UncheckedAt(i))->Eta();
+  const Int_t nInput = input->GetEntriesFast();
+  TArrayF eta(nInput);
+  TArrayD pt(nInput);
+  TArrayD phi(nInput);
+  TArrayI charge(nInput);
+  for (Int_t i=0; i<nInput; i++)
+  {
+    AliVParticle* particle = (AliVParticle*) input->UncheckedAt(i);
+    eta[i] = particle->Eta();
+    pt[i] = particle->Pt();
+    phi[i] = particle->Phi();
+    charge[i] = particle->Charge();
+  }
   
   // if particles is not set, just fill event statistics
   if (particles)
@@ -579,18 +599,42 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
     if (mixed)
       jMax = mixed->GetEntriesFast();
     
+    // trigger particles (same arrays as associated particles if not mixing)
+    const Int_t nTriggers = particles->GetEntriesFast();
+    TArrayF triggerEtaArray;
+    TArrayD triggerPtArray;
+    TArrayD triggerPhiArray;
+    TArrayI triggerChargeArray;
+    if (mixed)
+    {
+      triggerEtaArray.Set(nTriggers);
+      triggerPtArray.Set(nTriggers);
+      triggerPhiArray.Set(nTriggers);
+      triggerChargeArray.Set(nTriggers);
+      for (Int_t i=0; i<nTriggers; i++)
+      {
+        AliVParticle* triggerParticle = (AliVParticle*) particles->UncheckedAt(i);
+        triggerEtaArray[i] = triggerParticle->Eta();
+        triggerPtArray[i] = triggerParticle->Pt();
+        triggerPhiArray[i] = triggerParticle->Phi();
+        triggerChargeArray[i] = triggerParticle->Charge();
+      }
+    }
+    const Float_t* trigEta = (mixed) ? triggerEtaArray.GetArray() : eta.GetArray();
+    const Double_t* trigPt = (mixed) ? triggerPtArray.GetArray() : pt.GetArray();
+    const Double_t* trigPhi = (mixed) ? triggerPhiArray.GetArray() : phi.GetArray();
+    const Int_t* trigCharge = (mixed) ? triggerChargeArray.GetArray() : charge.GetArray();
+    
     TH1* triggerWeighting = 0;
     if (fWeightPerEvent)
     {
       TAxis* axis = fNumberDensityPhi->GetTrackHist(AliUEHist::kToward)->GetGrid(0)->GetGrid()->GetAxis(2);
       triggerWeighting = new TH1F("triggerWeighting", "", axis->GetNbins(), axis->GetXbins()->GetArray());
     
-      for (Int_t i=0; i<particles->GetEntriesFast(); i++)
+      for (Int_t i=0; i<nTriggers; i++)
       {
-	AliVParticle* triggerParticle = (AliVParticle*) particles->UncheckedAt(i);
-	
 	// some optimization
-	Float_t triggerEta = triggerParticle->Eta();
+	Float_t triggerEta = trigEta[i];
 
 	if (fTriggerRestrictEta > 0 && TMath::Abs(triggerEta) > fTriggerRestrictEta)
 	  continue;
@@ -602,10 +646,10 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	}
 	
 	if (fTriggerSelectCharge != 0)
-	  if (triggerParticle->Charge() * fTriggerSelectCharge < 0)
+	  if (trigCharge[i] * fTriggerSelectCharge < 0)
 	    continue;
 	
-	triggerWeighting->Fill(triggerParticle->Pt());
+	triggerWeighting->Fill(trigPt[i]);
       }
     }
     
@@ -627,26 +671,32 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	default: AliFatal(Form("Invalid setting %d", fRejectResonanceDaughters));
       }
 
-      for (Int_t i=0; i<particles->GetEntriesFast(); i++)
+      for (Int_t i=0; i<nTriggers; i++)
 	particles->UncheckedAt(i)->ResetBit(kResonanceDaughterFlag);
       if (mixed)
 	for (Int_t i=0; i<jMax; i++)
 	  mixed->UncheckedAt(i)->ResetBit(kResonanceDaughterFlag);
       
-      for (Int_t i=0; i<particles->GetEntriesFast(); i++)
+      // tan(theta) is a per-particle quantity of the cheap invariant mass
+      TArrayF tanTheta(jMax);
+      for (Int_t j=0; j<jMax; j++)
+	tanTheta[j] = GetTanThetaCheap(eta[j]);
+      
+      for (Int_t i=0; i<nTriggers; i++)
       {
 	AliVParticle* triggerParticle = (AliVParticle*) particles->UncheckedAt(i);
+	Float_t triggerTanTheta = GetTanThetaCheap(trigEta[i]);
 	
 	for (Int_t j=0; j<jMax; j++)
 	{
 	  if (!mixed && i == j)
 	    continue;
 	
-	  AliVParticle* particle = 0;
-	  if (!mixed)
-	    particle = (AliVParticle*) particles->UncheckedAt(j);
-	  else
-	    particle = (AliVParticle*) mixed->UncheckedAt(j);
+	  // unlike-sign pairs only (cheap check on the packed arrays first)
+	  if (trigCharge[i] * charge[j] > 0)
+	    continue;
+      
+	  AliVParticle* particle = (AliVParticle*) input->UncheckedAt(j);
 	  
 	  // check if both particles point to the same element (does not occur for mixed events, but if subsets are mixed within the same event)
 	  if (fCheckEventNumberInCorrelation)
@@ -665,14 +715,11 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	  else if (mixed && triggerParticle->IsEqual(particle))
 	    continue;
 	  
-	  if (triggerParticle->Charge() * particle->Charge() > 0)
-	    continue;
-      
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerParticle->Eta(), triggerParticle->Phi(), particle->Pt(), particle->Eta(), particle->Phi(), massDaughter1, massDaughter2);
+	  Float_t mass = GetInvMassSquaredCheapTanTheta(trigPt[i], triggerTanTheta, trigPhi[i], pt[j], tanTheta[j], phi[j], massDaughter1, massDaughter2);
 	      
 	  if (TMath::Abs(mass - resonanceMass*resonanceMass) < interval*5)
 	  {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerParticle->Eta(), triggerParticle->Phi(), particle->Pt(), particle->Eta(), particle->Phi(), massDaughter1, massDaughter2);
+	    mass = GetInvMassSquared(trigPt[i], trigEta[i], trigPhi[i], pt[j], eta[j], phi[j], massDaughter1, massDaughter2);
 
 	    if (mass > (resonanceMass-interval)*(resonanceMass-interval) && mass < (resonanceMass+interval)*(resonanceMass+interval))
 	    {
@@ -686,12 +733,105 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
       }
     }
     
-    for (Int_t i=0; i<particles->GetEntriesFast(); i++)
+    // per-particle quantities for the pair cuts
+    TArrayF tanTheta;
+    TArrayF triggerTanThetaArray;
+    const Float_t* trigTanTheta = 0;
+    if (fCutConversionsV > 0 || fCutResonancesV > 0)
+    {
+      tanTheta.Set(jMax);
+      for (Int_t j=0; j<jMax; j++)
+	tanTheta[j] = GetTanThetaCheap(eta[j]);
+      trigTanTheta = tanTheta.GetArray();
+      if (mixed)
+      {
+	triggerTanThetaArray.Set(nTriggers);
+	for (Int_t i=0; i<nTriggers; i++)
+	  triggerTanThetaArray[i] = GetTanThetaCheap(trigEta[i]);
+	trigTanTheta = triggerTanThetaArray.GetArray();
+      }
+    }
+    
+    // two-track cut: the bending terms of dphistar only depend on the particle and the radius
+    // they are computed at the two boundary radii for all particles, and lazily on the full radius scan for particles in close pairs
+    TArrayF radii;
+    TArrayD bendingMin, bendingMax, triggerBendingMin, triggerBendingMax;
+    // the radius scan buffers are members which only grow, so that they are not reallocated and zeroed in every call
+    // their content does not need to be reset, the done flags guard it
+    TArrayD& bendingScan = fBendingScan;
+    TArrayD& triggerBendingScan = fTriggerBendingScan;
+    TArrayC& bendingScanDone = fBendingScanDone;
+    TArrayC& triggerBendingScanDone = fTriggerBendingScanDone;
+    const Double_t* trigBendingMin = 0;
+    const Double_t* trigBendingMax = 0;
+    Double_t* trigBendingScan = 0;
+    Char_t* trigBendingScanDone = 0;
+    if (twoTrackEfficiencyCut)
+    {
+      Int_t nRadii = 0;
+      for (Double_t rad=fTwoTrackCutMinRadius; rad<2.51; rad+=0.01) 
+	nRadii++;
+      radii.Set(nRadii);
+      nRadii = 0;
+      for (Double_t rad=fTwoTrackCutMinRadius; rad<2.51; rad+=0.01) 
+	radii[nRadii++] = rad;
+      
+      bendingMin.Set(jMax);
+      bendingMax.Set(jMax);
+      if (bendingScan.GetSize() < jMax * nRadii)
+	bendingScan.Set(jMax * nRadii);
+      if (bendingScanDone.GetSize() < jMax)
+	bendingScanDone.Set(jMax);
+      bendingScanDone.Reset();
+      for (Int_t j=0; j<jMax; j++)
+      {
+	bendingMin[j] = GetDPhiStarBending(pt[j], fTwoTrackCutMinRadius);
+	bendingMax[j] = GetDPhiStarBending(pt[j], 2.5);
+      }
+      trigBendingMin = bendingMin.GetArray();
+      trigBendingMax = bendingMax.GetArray();
+      trigBendingScan = bendingScan.GetArray();
+      trigBendingScanDone = bendingScanDone.GetArray();
+      if (mixed)
+      {
+	triggerBendingMin.Set(nTriggers);
+	triggerBendingMax.Set(nTriggers);
+	if (triggerBendingScan.GetSize() < nTriggers * nRadii)
+	  triggerBendingScan.Set(nTriggers * nRadii);
+	if (triggerBendingScanDone.GetSize() < nTriggers)
+	  triggerBendingScanDone.Set(nTriggers);
+	triggerBendingScanDone.Reset();
+	for (Int_t i=0; i<nTriggers; i++)
+	{
+	  triggerBendingMin[i] = GetDPhiStarBending(trigPt[i], fTwoTrackCutMinRadius);
+	  triggerBendingMax[i] = GetDPhiStarBending(trigPt[i], 2.5);
+	}
+	trigBendingMin = triggerBendingMin.GetArray();
+	trigBendingMax = triggerBendingMax.GetArray();
+	trigBendingScan = triggerBendingScan.GetArray();
+	trigBendingScanDone = triggerBendingScanDone.GetArray();
+      }
+    }
+    
+    // pair quantities computed for all associated particles of a trigger particle at once (loops without calls)
+    TArrayF deltaEta(jMax);
+    TArrayD deltaPhi(jMax);
+    
+    // accepted pairs of a trigger particle are collected and filled at once (in SoA layout)
+    const Int_t kNVars = 6;
+    AliTHnBase* trackHistTHn = dynamic_cast<AliTHnBase*> (fNumberDensityPhi->GetTrackHist(AliUEHist::kToward));
+    TArrayD batchVarsArray(kNVars * jMax);
+    TArrayD batchWeights(jMax);
+    Double_t* batchVars[kNVars];
+    for (Int_t k=0; k<kNVars; k++)
+      batchVars[k] = batchVarsArray.GetArray() + k * jMax;
+    
+    for (Int_t i=0; i<nTriggers; i++)
     {
       AliVParticle* triggerParticle = (AliVParticle*) particles->UncheckedAt(i);
       
       // some optimization
-      Float_t triggerEta = triggerParticle->Eta();
+      Float_t triggerEta = trigEta[i];
       
       if (fTriggerRestrictEta > 0 && TMath::Abs(triggerEta) > fTriggerRestrictEta)
 	continue;
@@ -703,7 +843,7 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
       }
       
       if (fTriggerSelectCharge != 0)
-	if (triggerParticle->Charge() * fTriggerSelectCharge < 0)
+	if (trigCharge[i] * fTriggerSelectCharge < 0)
 	  continue;
 	
       if (fRejectResonanceDaughters > 0)
@@ -712,48 +852,60 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 // 	  Printf("Skipped i=%d", i);
 	  continue;
 	}
+      
+      const Double_t triggerPt = trigPt[i];
+      const Double_t triggerPhi = trigPhi[i];
+      const Int_t triggerCharge = trigCharge[i];
+      
+      for (Int_t j=0; j<jMax; j++)
+	deltaEta[j] = triggerEta - eta[j];
+      for (Int_t j=0; j<jMax; j++)
+      {
+	Double_t dphi = triggerPhi - phi[j];
+	if (dphi > 1.5 * TMath::Pi()) 
+	  dphi -= TMath::TwoPi();
+	if (dphi < -0.5 * TMath::Pi())
+	  dphi += TMath::TwoPi();
+	deltaPhi[j] = dphi;
+      }
+      
+      Int_t nAccepted = 0;
 	
       for (Int_t j=0; j<jMax; j++)
       {
         if (!mixed && i == j)
           continue;
       
-        AliVParticle* particle = 0;
-        if (!mixed)
-          particle = (AliVParticle*) particles->UncheckedAt(j);
-        else
-          particle = (AliVParticle*) mixed->UncheckedAt(j);
-        
         // check if both particles point to the same element (does not occur for mixed events, but if subsets are mixed within the same event)
         if (fCheckEventNumberInCorrelation)
         {
           AliBasicParticle* triggerParticleBasic = dynamic_cast<AliBasicParticle*>(triggerParticle);
-          AliBasicParticle* particleBasic        = dynamic_cast<AliBasicParticle*>(particle);
+          AliBasicParticle* particleBasic        = dynamic_cast<AliBasicParticle*>(input->UncheckedAt(j));
           if(!triggerParticleBasic || !particleBasic)
             AliFatal("If fCheckEventNumberInCorrelation is set, particle must be derived from AliBasicParticle");
       
           if(triggerParticleBasic->IsInSameEvent(particleBasic))
             continue;
         }
-        else if (mixed && triggerParticle->IsEqual(particle))
+        else if (mixed && triggerParticle->IsEqual(input->UncheckedAt(j)))
           continue;
         
         if (fPtOrder)
-	  if (particle->Pt() >= triggerParticle->Pt())
+	  if (pt[j] >= triggerPt)
 	    continue;
 	
 	if (fAssociatedSelectCharge != 0)
-	  if (particle->Charge() * fAssociatedSelectCharge < 0)
+	  if (charge[j] * fAssociatedSelectCharge < 0)
 	    continue;
 
         if (fSelectCharge > 0)
         {
           // skip like sign
-          if (fSelectCharge == 1 && particle->Charge() * triggerParticle->Charge() > 0)
+          if (fSelectCharge == 1 && charge[j] * triggerCharge > 0)
             continue;
             
           // skip unlike sign
-          if (fSelectCharge == 2 && particle->Charge() * triggerParticle->Charge() < 0)
+          if (fSelectCharge == 2 && charge[j] * triggerCharge < 0)
             continue;
         }
         
@@ -766,20 +918,20 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	}
 
 	if (fRejectResonanceDaughters > 0)
-	  if (particle->TestBit(kResonanceDaughterFlag))
+	  if (input->UncheckedAt(j)->TestBit(kResonanceDaughterFlag))
 	  {
 // 	    Printf("Skipped j=%d", j);
 	    continue;
 	  }
 
 	// conversions
-	if (fCutConversionsV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
+	if (fCutConversionsV > 0 && charge[j] * triggerCharge < 0)
 	{
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.510e-3, 0.510e-3);
+	  Float_t mass = GetInvMassSquaredCheapTanTheta(triggerPt, trigTanTheta[i], triggerPhi, pt[j], tanTheta[j], phi[j], 0.510e-3, 0.510e-3);
 	  
 	  if (mass < fCutConversionsV * 5)
 	  {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.510e-3, 0.510e-3);
+	    mass = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, pt[j], eta[j], phi[j], 0.510e-3, 0.510e-3);
 	    
 	    fControlConvResoncances->Fill(0.0, mass);
 
@@ -789,15 +941,15 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	}
 	
 	// K0s
-	if (fCutResonancesV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
+	if (fCutResonancesV > 0 && charge[j] * triggerCharge < 0)
 	{
-	  Float_t mass = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
+	  Float_t mass = GetInvMassSquaredCheapTanTheta(triggerPt, trigTanTheta[i], triggerPhi, pt[j], tanTheta[j], phi[j], 0.1396, 0.1396);
 	  
 	  const Float_t kK0smass = 0.4976;
 	  
 	  if (TMath::Abs(mass - kK0smass*kK0smass) < fCutResonancesV * 5)
 	  {
-	    mass = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.1396);
+	    mass = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, pt[j], eta[j], phi[j], 0.1396, 0.1396);
 	    
 	    fControlConvResoncances->Fill(1, mass - kK0smass*kK0smass);
 
@@ -807,16 +959,16 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	}
 	
 	// Lambda
-	if (fCutResonancesV > 0 && particle->Charge() * triggerParticle->Charge() < 0)
+	if (fCutResonancesV > 0 && charge[j] * triggerCharge < 0)
 	{
-	  Float_t mass1 = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.9383);
-	  Float_t mass2 = GetInvMassSquaredCheap(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.9383, 0.1396);
+	  Float_t mass1 = GetInvMassSquaredCheapTanTheta(triggerPt, trigTanTheta[i], triggerPhi, pt[j], tanTheta[j], phi[j], 0.1396, 0.9383);
+	  Float_t mass2 = GetInvMassSquaredCheapTanTheta(triggerPt, trigTanTheta[i], triggerPhi, pt[j], tanTheta[j], phi[j], 0.9383, 0.1396);
 	  
 	  const Float_t kLambdaMass = 1.115;
 
 	  if (TMath::Abs(mass1 - kLambdaMass*kLambdaMass) < fCutResonancesV * 5)
 	  {
-	    mass1 = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.1396, 0.9383);
+	    mass1 = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, pt[j], eta[j], phi[j], 0.1396, 0.9383);
 
 	    fControlConvResoncances->Fill(2, mass1 - kLambdaMass*kLambdaMass);
 	    
@@ -825,7 +977,7 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	  }
 	  if (TMath::Abs(mass2 - kLambdaMass*kLambdaMass) < fCutResonancesV * 5)
 	  {
-	    mass2 = GetInvMassSquared(triggerParticle->Pt(), triggerEta, triggerParticle->Phi(), particle->Pt(), eta[j], particle->Phi(), 0.9383, 0.1396);
+	    mass2 = GetInvMassSquared(triggerPt, triggerEta, triggerPhi, pt[j], eta[j], phi[j], 0.9383, 0.1396);
 
 	    fControlConvResoncances->Fill(2, mass2 - kLambdaMass*kLambdaMass);
 
@@ -839,22 +991,22 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	  // the variables & cuthave been developed by the HBT group 
 	  // see e.g. https://indico.cern.ch/materialDisplay.py?contribId=36&sessionId=6&materialId=slides&confId=142700
 
-	  Float_t phi1 = triggerParticle->Phi();
-	  Float_t pt1 = triggerParticle->Pt();
-	  Float_t charge1 = triggerParticle->Charge();
+	  Float_t phi1 = triggerPhi;
+	  Float_t pt1 = triggerPt;
+	  Float_t charge1 = triggerCharge;
 	    
-	  Float_t phi2 = particle->Phi();
-	  Float_t pt2 = particle->Pt();
-	  Float_t charge2 = particle->Charge();
+	  Float_t phi2 = phi[j];
+	  Float_t pt2 = pt[j];
+	  Float_t charge2 = charge[j];
 	      
-	  Float_t deta = triggerEta - eta[j];
+	  Float_t deta = deltaEta[j];
 	      
 	  // optimization
 	  if (TMath::Abs(deta) < twoTrackEfficiencyCutValue * 2.5 * 3)
 	  {
 	    // check first boundaries to see if is worth to loop and find the minimum
-	    Float_t dphistar1 = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, fTwoTrackCutMinRadius, bSign);
-	    Float_t dphistar2 = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, 2.5, bSign);
+	    Float_t dphistar1 = GetDPhiStarFromBending(phi1, charge1, trigBendingMin[i], phi2, charge2, bendingMin[j], bSign);
+	    Float_t dphistar2 = GetDPhiStarFromBending(phi1, charge1, trigBendingMax[i], phi2, charge2, bendingMax[j], bSign);
 	    
 	    const Float_t kLimit = twoTrackEfficiencyCutValue * 3;
 
@@ -862,9 +1014,25 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	    Float_t dphistarmin = 1e5;
 	    if (TMath::Abs(dphistar1) < kLimit || TMath::Abs(dphistar2) < kLimit || dphistar1 * dphistar2 < 0)
 	    {
-	      for (Double_t rad=fTwoTrackCutMinRadius; rad<2.51; rad+=0.01) 
+	      const Int_t nRadii = radii.GetSize();
+	      Double_t* bending1 = trigBendingScan + i * nRadii;
+	      Double_t* bending2 = bendingScan.GetArray() + j * nRadii;
+	      if (!trigBendingScanDone[i])
+	      {
+		for (Int_t k=0; k<nRadii; k++)
+		  bending1[k] = GetDPhiStarBending(pt1, radii[k]);
+		trigBendingScanDone[i] = 1;
+	      }
+	      if (!bendingScanDone[j])
 	      {
-		Float_t dphistar = GetDPhiStar(phi1, pt1, charge1, phi2, pt2, charge2, rad, bSign);
+		for (Int_t k=0; k<nRadii; k++)
+		  bending2[k] = GetDPhiStarBending(pt2, radii[k]);
+		bendingScanDone[j] = 1;
+	      }
+	      
+	      for (Int_t k=0; k<nRadii; k++)
+	      {
+		Float_t dphistar = GetDPhiStarFromBending(phi1, charge1, bending1[k], phi2, charge2, bending2[k], bSign);
 
 		Float_t dphistarabs = TMath::Abs(dphistar);
 		
@@ -889,19 +1057,15 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	}
         
         Double_t vars[6];
-        vars[0] = triggerEta - eta[j];
-        vars[1] = particle->Pt();
-        vars[2] = triggerParticle->Pt();
+        vars[0] = deltaEta[j];
+        vars[1] = pt[j];
+        vars[2] = triggerPt;
         vars[3] = centrality;
-        vars[4] = triggerParticle->Phi() - particle->Phi();
-        if (vars[4] > 1.5 * TMath::Pi()) 
-          vars[4] -= TMath::TwoPi();
-        if (vars[4] < -0.5 * TMath::Pi())
-          vars[4] += TMath::TwoPi();
+        vars[4] = deltaPhi[j];
 	vars[5] = zVtx;
 	
 	if (fillpT)
-	  weight = particle->Pt();
+	  weight = pt[j];
 	
 	Double_t useWeight = weight;
 	if (applyEfficiency)
@@ -939,16 +1103,28 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
 	}
     
         // fill all in toward region and do not use the other regions
-	fNumberDensityPhi->GetTrackHist(AliUEHist::kToward)->Fill(vars, step, useWeight);
+	if (trackHistTHn)
+	{
+	  // collected and filled after the loop
+	  for (Int_t k=0; k<kNVars; k++)
+	    batchVars[k][nAccepted] = vars[k];
+	  batchWeights[nAccepted] = useWeight;
+	  nAccepted++;
+	}
+	else
+	  fNumberDensityPhi->GetTrackHist(AliUEHist::kToward)->Fill(vars, step, useWeight);
 
 // 	Printf("%.2f %.2f --> %.2f", triggerEta, eta[j], vars[0]);
       }
+      
+      if (nAccepted > 0)
+	trackHistTHn->FillBatch(nAccepted, batchVars, step, batchWeights.GetArray());
  
       if (firstTime)
       {
         // once per trigger particle
         Double_t vars[3];
-        vars[0] = triggerParticle->Pt();
+        vars[0] = triggerPt;
         vars[1] = centrality;
 	vars[2] = zVtx;
 
@@ -11,6 +11,8 @@
 #include "TNamed.h"
 #include "AliUEHist.h"
 #include "TMath.h"
+#include "TArrayC.h"
+#include "TArrayD.h"
 #include "THn.h" // in cxx file causes .../THn.h:257: error: conflicting declaration ‘typedef class THnT<float> THnF’
 
 class AliVParticle;
@@ -113,6 +115,10 @@ protected:
   inline Float_t GetInvMassSquared(Float_t pt1, Float_t eta1, Float_t phi1, Float_t pt2, Float_t eta2, Float_t phi2, Float_t m0_1, Float_t m0_2);
   inline Float_t GetInvMassSquaredCheap(Float_t pt1, Float_t eta1, Float_t phi1, Float_t pt2, Float_t eta2, Float_t phi2, Float_t m0_1, Float_t m0_2);
   inline Float_t GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t radius, Float_t bSign);
+  inline Double_t GetDPhiStarBending(Float_t pt, Float_t radius) { return TMath::ASin(0.075 * radius / pt); }
+  inline Float_t GetDPhiStarFromBending(Float_t phi1, Float_t charge1, Double_t bending1, Float_t phi2, Float_t charge2, Double_t bending2, Float_t bSign);
+  inline Float_t GetTanThetaCheap(Float_t eta);
+  inline Float_t GetInvMassSquaredCheapTanTheta(Float_t pt1, Float_t tantheta1, Float_t phi1, Float_t pt2, Float_t tantheta2, Float_t phi2, Float_t m0_1, Float_t m0_2);
   
   static const Int_t fgkUEHists; // number of histograms
 
@@ -163,6 +169,11 @@ protected:
   
   Int_t fMergeCount;		// counts how many objects have been merged together
   
+  TArrayD fBendingScan;            //! buffer for the dphistar bending terms on the radius scan of the associated particles (two-track cut)
+  TArrayD fTriggerBendingScan;     //! same for the trigger particles in mixed events
+  TArrayC fBendingScanDone;        //! radius scan computed for associated particle
+  TArrayC fTriggerBendingScanDone; //! radius scan computed for trigger particle in mixed events
+  
   ClassDef(AliUEHistograms, 31)  // underlying event histogram container
 };
 
@@ -172,7 +183,16 @@ Float_t AliUEHistograms::GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1,
   // calculates dphistar
   //
   
-  Float_t dphistar = phi1 - phi2 - charge1 * bSign * TMath::ASin(0.075 * radius / pt1) + charge2 * bSign * TMath::ASin(0.075 * radius / pt2);
+  return GetDPhiStarFromBending(phi1, charge1, GetDPhiStarBending(pt1, radius), phi2, charge2, GetDPhiStarBending(pt2, radius), bSign);
+}
+
+Float_t AliUEHistograms::GetDPhiStarFromBending(Float_t phi1, Float_t charge1, Double_t bending1, Float_t phi2, Float_t charge2, Double_t bending2, Float_t bSign)
+{ 
+  //
+  // calculates dphistar from the bending terms of both particles (see GetDPhiStarBending), which can be cached per particle
+  //
+  
+  Float_t dphistar = phi1 - phi2 - charge1 * bSign * bending1 + charge2 * bSign * bending2;
   
   static const Double_t kPi = TMath::Pi();
   
@@ -231,21 +251,28 @@ Float_t AliUEHistograms::GetInvMassSquaredCheap(Float_t pt1, Float_t eta1, Float
 {
   // calculate inv mass squared approximately
   
-  Float_t tantheta1 = 1e10;
+  return GetInvMassSquaredCheapTanTheta(pt1, GetTanThetaCheap(eta1), phi1, pt2, GetTanThetaCheap(eta2), phi2, m0_1, m0_2);
+}
+
+Float_t AliUEHistograms::GetTanThetaCheap(Float_t eta)
+{
+  // tan(theta) from eta with an approximated exponential
   
-  if (eta1 < -1e-10 || eta1 > 1e-10)
-  {
-    Float_t expTmp = 1.0-eta1+eta1*eta1/2-eta1*eta1*eta1/6+eta1*eta1*eta1*eta1/24;
-    tantheta1 = 2.0 * expTmp / ( 1.0 - expTmp*expTmp);
-  }
+  Float_t tantheta = 1e10;
   
-  Float_t tantheta2 = 1e10;
-  if (eta2 < -1e-10 || eta2 > 1e-10)
+  if (eta < -1e-10 || eta > 1e-10)
   {
-    Float_t expTmp = 1.0-eta2+eta2*eta2/2-eta2*eta2*eta2/6+eta2*eta2*eta2*eta2/24;
-    tantheta2 = 2.0 * expTmp / ( 1.0 - expTmp*expTmp);
+    Float_t expTmp = 1.0-eta+eta*eta/2-eta*eta*eta/6+eta*eta*eta*eta/24;
+    tantheta = 2.0 * expTmp / ( 1.0 - expTmp*expTmp);
   }
   
+  return tantheta;
+}
+
+Float_t AliUEHistograms::GetInvMassSquaredCheapTanTheta(Float_t pt1, Float_t tantheta1, Float_t phi1, Float_t pt2, Float_t tantheta2, Float_t phi2, Float_t m0_1, Float_t m0_2)
+{
+  // calculate inv mass squared approximately, tan(theta) precomputed with GetTanThetaCheap
+  
   Float_t e1squ = m0_1 * m0_1 + pt1 * pt1 * (1.0 + 1.0 / tantheta1 / tantheta1);
   Float_t e2squ = m0_2 * m0_2 + pt2 * pt2 * (1.0 + 1.0 / tantheta2 / tantheta2);
   
@@ -26,6 +26,12 @@ AliFemtoPair::AliFemtoPair():
   fDKLong(0.0),
   fCVK(0.0),
   fKStarCalc(0.0),
+  fKinParNotCalculated(1),
+  fQInvCalc(0.0),
+  fKTCalc(0.0),
+  fQOutCMSCalc(0.0),
+  fQSideCMSCalc(0.0),
+  fQLongCMSCalc(0.0),
   fNonIdParNotCalculatedGlobal(0),
   fMergingParNotCalculated(0),
   fWeightedAvSep(0.0),
@@ -64,6 +70,12 @@ AliFemtoPair::AliFemtoPair(AliFemtoParticle* a, AliFemtoParticle* b):
   fDKLong(0.0),
   fCVK(0.0),
   fKStarCalc(0.0),
+  fKinParNotCalculated(1),
+  fQInvCalc(0.0),
+  fKTCalc(0.0),
+  fQOutCMSCalc(0.0),
+  fQSideCMSCalc(0.0),
+  fQLongCMSCalc(0.0),
   fNonIdParNotCalculatedGlobal(0),
   fMergingParNotCalculated(0),
   fWeightedAvSep(0.0),
@@ -133,6 +145,12 @@ AliFemtoPair::AliFemtoPair(const AliFemtoPair &aPair):
   fDKLong(aPair.fDKLong),
   fCVK(aPair.fCVK),
   fKStarCalc(aPair.fKStarCalc),
+  fKinParNotCalculated(aPair.fKinParNotCalculated),
+  fQInvCalc(aPair.fQInvCalc),
+  fKTCalc(aPair.fKTCalc),
+  fQOutCMSCalc(aPair.fQOutCMSCalc),
+  fQSideCMSCalc(aPair.fQSideCMSCalc),
+  fQLongCMSCalc(aPair.fQLongCMSCalc),
   fNonIdParNotCalculatedGlobal(aPair.fNonIdParNotCalculatedGlobal),
   fMergingParNotCalculated(aPair.fMergingParNotCalculated),
   fWeightedAvSep(aPair.fWeightedAvSep),
@@ -179,6 +197,13 @@ AliFemtoPair& AliFemtoPair::operator=(const AliFemtoPair &aPair)
   fCVK = aPair.fCVK;
   fKStarCalc = aPair.fKStarCalc;
 
+  fKinParNotCalculated = aPair.fKinParNotCalculated;
+  fQInvCalc = aPair.fQInvCalc;
+  fKTCalc = aPair.fKTCalc;
+  fQOutCMSCalc = aPair.fQOutCMSCalc;
+  fQSideCMSCalc = aPair.fQSideCMSCalc;
+  fQLongCMSCalc = aPair.fQLongCMSCalc;
+
   fNonIdParNotCalculatedGlobal = aPair.fNonIdParNotCalculatedGlobal;
 
   fMergingParNotCalculated = aPair.fMergingParNotCalculated;
@@ -229,10 +254,8 @@ double AliFemtoPair::MInv() const
 double AliFemtoPair::KT() const
 {
   // transverse momentum
-  double tmp = (fTrack1->FourMomentum() + fTrack2->FourMomentum()).Perp();
-  tmp *= .5;
-
-  return (tmp);
+  if (fKinParNotCalculated) CalcKinPar();
+  return fKTCalc;
 }
 //_________________
 double AliFemtoPair::Rap() const
@@ -356,62 +379,23 @@ void AliFemtoPair::QYKPPF(double& qP, double& qT, double& q0) const
 double AliFemtoPair::QOutCMS() const
 {
   // relative momentum out component in lab frame
-    AliFemtoThreeVector tmp1 = fTrack1->FourMomentum().vect();
-    AliFemtoThreeVector tmp2 = fTrack2->FourMomentum().vect();
-
-    double dx = tmp1.x() - tmp2.x();
-    double xt = tmp1.x() + tmp2.x();
-
-    double dy = tmp1.y() - tmp2.y();
-    double yt = tmp1.y() + tmp2.y();
-
-    double k1 = (::sqrt(xt*xt+yt*yt));
-    double k2 = (dx*xt+dy*yt);
-    double tmp;
-
-    if(k1!=0) tmp= k2/k1;
-    else tmp=0;
-
-    return (tmp);
+  if (fKinParNotCalculated) CalcKinPar();
+  return fQOutCMSCalc;
 }
 //_________________
 double AliFemtoPair::QSideCMS() const
 {
   // relative momentum side component in lab frame
-    AliFemtoThreeVector tmp1 = fTrack1->FourMomentum().vect();
-    AliFemtoThreeVector tmp2 = fTrack2->FourMomentum().vect();
-
-    double x1 = tmp1.x();  double y1 = tmp1.y();
-    double x2 = tmp2.x();  double y2 = tmp2.y();
-
-    double xt = x1+x2;  double yt = y1+y2;
-    double k1 = ::sqrt(xt*xt+yt*yt);
-
-    double tmp;
-    if(k1!=0) tmp= 2.0*(x2*y1-x1*y2)/k1;
-    else tmp=0;
-
-    return (tmp);
+  if (fKinParNotCalculated) CalcKinPar();
+  return fQSideCMSCalc;
 }
 
 //_________________________
 double AliFemtoPair::QLongCMS() const
 {
   // relative momentum component in lab frame
-    AliFemtoLorentzVector tmp1 = fTrack1->FourMomentum();
-    AliFemtoLorentzVector tmp2 = fTrack2->FourMomentum();
-
-    double dz = tmp1.z() - tmp2.z();
-    double zz = tmp1.z() + tmp2.z();
-
-    double dt = tmp1.t() - tmp2.t();
-    double tt = tmp1.t() + tmp2.t();
-
-    double beta = zz/tt;
-    double gamma = 1.0/TMath::Sqrt((1.-beta)*(1.+beta));
-
-    double temp = gamma*(dz - beta*dt);
-    return (temp);
+  if (fKinParNotCalculated) CalcKinPar();
+  return fQLongCMSCalc;
 }
 
 //________________________________
@@ -707,6 +691,48 @@ double AliFemtoPair::QInvFlippedXY() const
   return ( -1.* tDiff.m());
 }
 
+void AliFemtoPair::CalcKinPar() const
+{
+  // Calculate qinv, kT and the LCMS components of the relative momentum
+  // at once; all pair cuts and correlation functions then share them
+  fKinParNotCalculated=0;
+
+  const AliFemtoLorentzVector &tP1 = fTrack1->FourMomentum();
+  const AliFemtoLorentzVector &tP2 = fTrack2->FourMomentum();
+
+  AliFemtoLorentzVector tDiff = tP1 - tP2;
+  fQInvCalc = -1.* tDiff.m();
+
+  double x1 = tP1.x();  double y1 = tP1.y();
+  double x2 = tP2.x();  double y2 = tP2.y();
+
+  double dx = x1 - x2;  double xt = x1 + x2;
+  double dy = y1 - y2;  double yt = y1 + y2;
+
+  double k1 = ::sqrt(xt*xt+yt*yt);
+  fKTCalc = 0.5*k1;
+
+  if (k1!=0) {
+    fQOutCMSCalc = (dx*xt+dy*yt)/k1;
+    fQSideCMSCalc = 2.0*(x2*y1-x1*y2)/k1;
+  }
+  else {
+    fQOutCMSCalc = 0;
+    fQSideCMSCalc = 0;
+  }
+
+  double dz = tP1.z() - tP2.z();
+  double zz = tP1.z() + tP2.z();
+
+  double dt = tP1.t() - tP2.t();
+  double tt = tP1.t() + tP2.t();
+
+  double beta = zz/tt;
+  double gamma = 1.0/TMath::Sqrt((1.-beta)*(1.+beta));
+
+  fQLongCMSCalc = gamma*(dz - beta*dt);
+}
+
 void AliFemtoPair::CalcNonIdPar() const
 { // fortran like function! faster?
   // Calculate generalized relative mometum
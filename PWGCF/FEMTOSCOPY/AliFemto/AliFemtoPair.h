@@ -172,6 +172,14 @@ private:
   mutable double fKStarCalc; // momemntum of first particle in PRF - k*
   void CalcNonIdPar() const;
 
+  mutable short fKinParNotCalculated; // Set to 1 when the pair kinematics below have not been calculated yet
+  mutable double fQInvCalc;    // invariant relative momentum qinv
+  mutable double fKTCalc;      // pair transverse momentum kT
+  mutable double fQOutCMSCalc; // relative momentum out component in LCMS
+  mutable double fQSideCMSCalc;// relative momentum side component in LCMS
+  mutable double fQLongCMSCalc;// relative momentum long component in LCMS
+  void CalcKinPar() const;
+
   mutable short fNonIdParNotCalculatedGlobal; // If global k* was calculated
  /* mutable double fDKSideGlobal;
   mutable double fDKOutGlobal;
@@ -228,6 +236,7 @@ private:
 
 inline void AliFemtoPair::ResetParCalculated(){
   fNonIdParNotCalculated=1;
+  fKinParNotCalculated=1;
   fNonIdParNotCalculatedGlobal=1;
   fMergingParNotCalculated=1;
   fMergingParNotCalculatedTrkV0Pos=1;
@@ -267,8 +276,8 @@ inline double AliFemtoPair::KStar() const{
   return fKStarCalc;
 }
 inline double AliFemtoPair::QInv() const {
-  AliFemtoLorentzVector tDiff = (fTrack1->FourMomentum()-fTrack2->FourMomentum());
-  return ( -1.* tDiff.m());
+  if(fKinParNotCalculated) CalcKinPar();
+  return fQInvCalc;
 }
 
 // Fabrice private <<<
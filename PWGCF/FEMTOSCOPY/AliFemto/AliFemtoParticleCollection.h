@@ -30,19 +30,24 @@
 #define AliFemtoParticleCollection_hh
 #include "AliFemtoParticle.h"
 #include <list>
+#include <vector>
 
+// The collection is a vector, so that the pair loops in the analyses run over
+// contiguous memory; the particles themselves are owned by the AliFemtoPicoEvent.
+// std::list is still made visible for code which relied on this header for it.
 #if !defined(ST_NO_NAMESPACES)
 using std::list;
+using std::vector;
 #endif
 
 #ifdef ST_NO_TEMPLATE_DEF_ARGS
-typedef list<AliFemtoParticle *, allocator<AliFemtoParticle *> >            AliFemtoParticleCollection;
-typedef list<AliFemtoParticle *, allocator<AliFemtoParticle *> >::iterator  AliFemtoParticleIterator;
-typedef list<AliFemtoParticle *, allocator<AliFemtoParticle *> >::const_iterator  AliFemtoParticleConstIterator;
+typedef vector<AliFemtoParticle *, allocator<AliFemtoParticle *> >            AliFemtoParticleCollection;
+typedef vector<AliFemtoParticle *, allocator<AliFemtoParticle *> >::iterator  AliFemtoParticleIterator;
+typedef vector<AliFemtoParticle *, allocator<AliFemtoParticle *> >::const_iterator  AliFemtoParticleConstIterator;
 #else
-typedef list<AliFemtoParticle *>            AliFemtoParticleCollection;
-typedef list<AliFemtoParticle *>::iterator  AliFemtoParticleIterator;
-typedef list<AliFemtoParticle *>::const_iterator  AliFemtoParticleConstIterator;
+typedef vector<AliFemtoParticle *>            AliFemtoParticleCollection;
+typedef vector<AliFemtoParticle *>::iterator  AliFemtoParticleIterator;
+typedef vector<AliFemtoParticle *>::const_iterator  AliFemtoParticleConstIterator;
 #endif
 
 #endif
@@ -195,4 +195,19 @@ AliFemtoPicoEvent& AliFemtoPicoEvent::operator=(const AliFemtoPicoEvent& aPicoEv
 
   return *this;
 }
-
+//_________________
+void AliFemtoPicoEvent::Clear()
+{
+  // Delete all particles but keep the collections, so that the pico event
+  // can be refilled without reallocating them
+  AliFemtoParticleCollection *collections[3] = {fFirstParticleCollection,
+                                                fSecondParticleCollection,
+                                                fThirdParticleCollection};
+  for (int i = 0; i < 3; i++) {
+    if (!collections[i]) continue;
+    for (AliFemtoParticleIterator iter = collections[i]->begin(); iter != collections[i]->end(); iter++) {
+      delete *iter;
+    }
+    collections[i]->clear();
+  }
+}
@@ -52,6 +52,8 @@ public:
 
   AliFemtoPicoEvent& operator=(const AliFemtoPicoEvent& aPicoEvent);
 
+  void Clear(); // delete all particles; collections keep their capacity for reuse
+
   /* may want to have other stuff in here, like where is primary vertex */
 
   AliFemtoParticleCollection* FirstParticleCollection();
@@ -9,6 +9,7 @@
 #include "AliFemtoXiCut.h"
 #include "AliFemtoXiTrackCut.h"
 #include "AliFemtoPicoEvent.h"
+#include "AliFemtoPair.h"
 
 #include <string>
 #include <iostream>
@@ -183,7 +184,9 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis():
   fMinSizePartCollection(0),
   fVerbose(kTRUE),
   fPerformSharedDaughterCut(kFALSE),
-  fEnablePairMonitors(kFALSE)
+  fEnablePairMonitors(kFALSE),
+  fPair(nullptr),
+  fRecycledPicoEvent(nullptr)
 {
   // Default constructor
   fCorrFctnCollection = new AliFemtoCorrFctnCollection;
@@ -205,7 +208,9 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis(const AliFemtoSimpleAnalysis& a):
   fMinSizePartCollection(a.fMinSizePartCollection),
   fVerbose(a.fVerbose),
   fPerformSharedDaughterCut(a.fPerformSharedDaughterCut),
-  fEnablePairMonitors(a.fEnablePairMonitors)
+  fEnablePairMonitors(a.fEnablePairMonitors),
+  fPair(nullptr),
+  fRecycledPicoEvent(nullptr)
 {
   /// Copy constructor
 
@@ -317,6 +322,9 @@ AliFemtoSimpleAnalysis::~AliFemtoSimpleAnalysis()
     }
     delete fMixingBuffer;
   }
+
+  delete fRecycledPicoEvent;
+  delete fPair;
 }
 //______________________
 AliFemtoSimpleAnalysis& AliFemtoSimpleAnalysis::operator=(const AliFemtoSimpleAnalysis& aAna)
@@ -473,7 +481,7 @@ void AliFemtoSimpleAnalysis::ProcessEvent(const AliFemtoEvent* hbtEvent)
   // Buffer.
   // No memory leak: we will delete picoevents when they come out of the
   // mixing buffer
-  fPicoEvent = new AliFemtoPicoEvent;
+  fPicoEvent = NewPicoEvent();
 
   AliFemtoParticleCollection *collection1 = fPicoEvent->FirstParticleCollection(),
                              *collection2 = fPicoEvent->SecondParticleCollection();
@@ -482,7 +490,8 @@ void AliFemtoSimpleAnalysis::ProcessEvent(const AliFemtoEvent* hbtEvent)
   if (collection1 == nullptr || collection2 == nullptr) {
     cout << "E-AliFemtoSimpleAnalysis::ProcessEvent: new PicoEvent is missing particle collections!\n";
     EventEnd(hbtEvent);  // cleanup for EbyE
-    delete fPicoEvent;
+    RecyclePicoEvent(fPicoEvent);
+    fPicoEvent = nullptr;
     return;
   }
 
@@ -526,7 +535,8 @@ void AliFemtoSimpleAnalysis::ProcessEvent(const AliFemtoEvent* hbtEvent)
 
   if (!tmpPassEvent) {
     EventEnd(hbtEvent);
-    delete fPicoEvent;
+    RecyclePicoEvent(fPicoEvent);
+    fPicoEvent = nullptr;
     return;
   }
 
@@ -562,9 +572,9 @@ void AliFemtoSimpleAnalysis::ProcessEvent(const AliFemtoEvent* hbtEvent)
     cout << " - mixed done   \n";
   }
 
-  //--------- If mixing buffer is full, delete oldest event ---------//
+  //--------- If mixing buffer is full, recycle oldest event ---------//
   if ( MixingBufferFull() ) {
-    delete MixingBuffer()->back();
+    RecyclePicoEvent(MixingBuffer()->back());
     MixingBuffer()->pop_back();
   }
 
@@ -587,6 +597,14 @@ void AliFemtoSimpleAnalysis::MakePairs(const char* typeIn,
 
   const string type = typeIn;
 
+  // Decide once which correlation function method is called
+  const bool is_real = (type == "real"),
+             is_mixed = (type == "mixed");
+  if (!is_real && !is_mixed) {
+    cout << "Problem with pair type, type = " << type << endl;
+    return;
+  }
+
   //  int swpart = ((long int) partCollection1) % 2;
 
   // Used to swap particle 1 & 2 in identical-particle analysis
@@ -616,8 +634,13 @@ void AliFemtoSimpleAnalysis::MakePairs(const char* typeIn,
     tEndInnerLoop = partCollection1->end() ;     //   Inner loop goes to last particle
   }
 
-  // Create the pair outside the loop - only allocate once
-  AliFemtoPair* tPair = new AliFemtoPair;
+  // The pair is kept by the analysis - only allocated once. Pair kinematics
+  // (qinv, kT, k*, LCMS components) are calculated on first use and shared
+  // by the pair cut and all correlation functions until a track is changed.
+  if (fPair == nullptr) {
+    fPair = new AliFemtoPair;
+  }
+  AliFemtoPair* tPair = fPair;
 
   // Begin the outer loop
   for (AliFemtoParticleConstIterator tPartIter1 = tStartOuterLoop;
@@ -661,21 +684,49 @@ void AliFemtoSimpleAnalysis::MakePairs(const char* typeIn,
 
       // If pair passes cut, loop over CF's and add pair to real/mixed
       if (tmpPassPair) {
-        for (auto &tCorrFctn : *fCorrFctnCollection) {
-          if (type == "real")
+        if (is_real) {
+          for (auto &tCorrFctn : *fCorrFctnCollection) {
             tCorrFctn->AddRealPair(tPair);
-          else if(type == "mixed")
+          }
+        } else {
+          for (auto &tCorrFctn : *fCorrFctnCollection) {
             tCorrFctn->AddMixedPair(tPair);
-          else
-            cout << "Problem with pair type, type = " << type << endl;
+          }
         } // loop over corellatoin functions
       }
 
     }    // loop over second particle
   }      // loop over first particle
+}
+//_________________________
+AliFemtoPicoEvent* AliFemtoSimpleAnalysis::NewPicoEvent()
+{
+  /// Return an empty pico event, reusing the recycled one if available
+
+  if (fRecycledPicoEvent == nullptr) {
+    return new AliFemtoPicoEvent;
+  }
+
+  AliFemtoPicoEvent *picoEvent = fRecycledPicoEvent;
+  fRecycledPicoEvent = nullptr;
+  return picoEvent;
+}
+//_________________________
+void AliFemtoSimpleAnalysis::RecyclePicoEvent(AliFemtoPicoEvent* picoEvent)
+{
+  /// Empty the pico event and keep it for the next event
+
+  if (picoEvent == nullptr) {
+    return;
+  }
+
+  if (fRecycledPicoEvent != nullptr) {
+    delete picoEvent;
+    return;
+  }
 
-  // we are done with the pair
-  delete tPair;
+  picoEvent->Clear();
+  fRecycledPicoEvent = picoEvent;
 }
 //_________________________
 void AliFemtoSimpleAnalysis::EventBegin(const AliFemtoEvent* ev)
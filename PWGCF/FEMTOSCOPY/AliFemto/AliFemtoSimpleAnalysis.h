@@ -18,6 +18,7 @@
 
 class AliFemtoPicoEventCollectionVectorHideAway;
 class AliFemtoPicoEvent;
+class AliFemtoPair;
 
 ///
 /// \class AliFemtoSimpleAnalysis
@@ -159,6 +160,15 @@ protected:
                  AliFemtoParticleCollection* ParticlesPssingCut2=NULL,
                  Bool_t enablePairMonitors=kFALSE);
 
+  /// Returns an empty pico event for the current event. The event which
+  /// last left the mixing buffer is reused if available, so particle
+  /// collections are not reallocated for every event.
+  AliFemtoPicoEvent* NewPicoEvent();
+
+  /// Empties the pico event and keeps it for the next call of NewPicoEvent
+  /// (deletes it if another one is kept already)
+  void RecyclePicoEvent(AliFemtoPicoEvent* picoEvent);
+
   AliFemtoPicoEventCollectionVectorHideAway* fPicoEventCollectionVectorHideAway; //!<! Mixing Buffer used for Analyses which wrap this one
 
   AliFemtoPairCut*             fPairCut;             ///< cut applied to pairs
@@ -178,6 +188,9 @@ protected:
   Bool_t fPerformSharedDaughterCut;
   Bool_t fEnablePairMonitors;
 
+  AliFemtoPair* fPair;                    //!<! pair object reused by all calls of MakePairs
+  AliFemtoPicoEvent* fRecycledPicoEvent;  //!<! emptied pico event, reused by NewPicoEvent
+
 #ifdef __ROOT__
   /// \cond CLASSIMP
   ClassDef(AliFemtoSimpleAnalysis, 0);
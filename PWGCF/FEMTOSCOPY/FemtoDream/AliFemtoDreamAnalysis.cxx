@@ -50,6 +50,7 @@ void AliFemtoDreamAnalysis::Init(
     bool isMonteCarlo,bool MinimalBooking,UInt_t trigger) {
   fFemtoTrack=new AliFemtoDreamTrack();
   fFemtoTrack->SetUseMCInfo(isMonteCarlo);
+  fFemtoTrack->SetUseNSigmaCache(fTrackCuts->GetUseNSigmaCache());
 
   fFemtov0=new AliFemtoDreamv0();
   fFemtov0->SetPDGCode(fv0Cuts->GetPDGv0());
@@ -11,6 +11,7 @@
 #include "AliAODMCParticle.h"
 #include "AliInputEventHandler.h"
 #include "AliFemtoDreamTrack.h"
+#include "AliPIDnSigmaCache.h"
 #include "AliLog.h"
 #include "TClonesArray.h"
 #include <iostream>
@@ -40,6 +41,7 @@ AliFemtoDreamTrack::AliFemtoDreamTrack()
 ,fTPCRefit(false)
 ,fTrack(0)
 ,fGlobalTrack(0)
+,fUseNSigmaCache(false)
 {
   for (int i=0;i<5;++i) {
     fnSigmaTPC[i]=0;
@@ -198,12 +200,16 @@ void AliFemtoDreamTrack::SetPIDInformation() {
   for (int i=0;i<5;++i) {
     if(statusTPC == AliPIDResponse::kDetPidOk){
       (this->fnSigmaTPC)[i] =
+          fUseNSigmaCache?
+          AliPIDnSigmaCache::NumberOfSigmas(fPIDResponse,AliPIDResponse::kTPC,fGlobalTrack,particleID[i]):
           fPIDResponse->NumberOfSigmas(AliPIDResponse::kTPC,fGlobalTrack,particleID[i]);
     }else{
       (this->fnSigmaTPC)[i] = -999.;
     }
     if(statusTOF == AliPIDResponse::kDetPidOk){
       (this->fnSigmaTOF)[i] =
+          fUseNSigmaCache?
+          AliPIDnSigmaCache::NumberOfSigmas(fPIDResponse,AliPIDResponse::kTOF,fGlobalTrack,particleID[i]):
           fPIDResponse->NumberOfSigmas(AliPIDResponse::kTOF,fGlobalTrack,particleID[i]);
     }else{
       (this->fnSigmaTOF)[i] = -999.;
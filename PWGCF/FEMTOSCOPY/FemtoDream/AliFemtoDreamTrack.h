@@ -16,6 +16,7 @@ class AliFemtoDreamTrack : public AliFemtoDreamBasePart {
   AliFemtoDreamTrack();
   virtual ~AliFemtoDreamTrack();
   void SetTrack(AliAODTrack *track);
+  void SetUseNSigmaCache(bool use){fUseNSigmaCache=use;};
   UInt_t GetilterMap() const {return fFilterMap;};
   bool TestFilterBit(UInt_t filterBit)
   {return (bool) ((filterBit & fFilterMap) != 0);}
@@ -77,7 +78,8 @@ class AliFemtoDreamTrack : public AliFemtoDreamBasePart {
   AliAODTrack *fGlobalTrack;
   float fnSigmaTPC[5];
   float fnSigmaTOF[5];
-  ClassDef(AliFemtoDreamTrack,2)
+  bool fUseNSigmaCache;   // n sigma from AliPIDnSigmaCache (same values, computed once per event)
+  ClassDef(AliFemtoDreamTrack,3)
 };
 
 #endif /* ALIFEMTODREAMTRACK_H_ */
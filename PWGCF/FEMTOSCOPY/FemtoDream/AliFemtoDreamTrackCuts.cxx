@@ -48,6 +48,7 @@ AliFemtoDreamTrackCuts::AliFemtoDreamTrackCuts()
 ,fNSigValue(3.)
 ,fPIDPTPCThreshold(0)
 ,fRejectPions(false)
+,fUseNSigmaCache(false)
 {}
 
 AliFemtoDreamTrackCuts::~AliFemtoDreamTrackCuts() {
@@ -50,6 +50,8 @@ class AliFemtoDreamTrackCuts {
   void SetCheckPileUpITS(bool check){fCheckPileUpITS=check;};
   void SetCheckPileUpTOF(bool check){fCheckPileUpTOF=check;};
   void SetCheckPileUp(bool check){fCheckPileUp=check;};
+  void SetUseNSigmaCache(bool use){fUseNSigmaCache=use;};
+  bool GetUseNSigmaCache() const {return fUseNSigmaCache;};
   void SetNClsTPC(int nCls){fnTPCCls = nCls; fcutnTPCCls = kTRUE;};
   void SetDCAReCalculation(bool which){fDCAProp = which;};
   void SetDCAVtxXY(float dcaXY){fDCAToVertexXY = dcaXY; fCutDCAToVtxXY = kTRUE;};
@@ -119,7 +121,8 @@ class AliFemtoDreamTrackCuts {
   float fNSigValue;                  // defaults to 3
   float fPIDPTPCThreshold;           // defaults to 0
   bool fRejectPions;                  // Supress Pions at low pT with the TOF, if information is available
-  ClassDef(AliFemtoDreamTrackCuts,2);
+  bool fUseNSigmaCache;               // Take the n sigma of the tracks from AliPIDnSigmaCache
+  ClassDef(AliFemtoDreamTrackCuts,3);
 };
 
 #endif /* ALIFEMTODREAMTRACKCUTS_H_ */
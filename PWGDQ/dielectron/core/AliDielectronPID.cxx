@@ -35,6 +35,7 @@ Detailed description
 #include <AliLog.h>
 #include <AliExternalTrackParam.h>
 #include <AliPIDResponse.h>
+#include <AliPIDnSigmaCache.h>
 #include <AliTRDPIDResponse.h>
 #include <AliESDtrack.h> //!!!!! Remove once Eta correction is treated in the tender
 #include <AliAODTrack.h>
@@ -63,7 +64,9 @@ AliDielectronPID::AliDielectronPID() :
   AliAnalysisCuts(),
   fUsedVars(new TBits(AliDielectronVarManager::kNMaxValues)),
   fNcuts(0),
-  fPIDResponse(0x0)
+  fPIDResponse(0x0),
+  fUseNSigmaCache(kFALSE),
+  fTPCsignalCorrected(kFALSE)
 {
   //
   // Default Constructor
@@ -93,7 +96,9 @@ AliDielectronPID::AliDielectronPID(const char* name, const char* title) :
   AliAnalysisCuts(name, title),
   fUsedVars(new TBits(AliDielectronVarManager::kNMaxValues)),
   fNcuts(0),
-  fPIDResponse(0x0)
+  fPIDResponse(0x0),
+  fUseNSigmaCache(kFALSE),
+  fTPCsignalCorrected(kFALSE)
 {
   //
   // Named Constructor
@@ -303,18 +308,25 @@ Bool_t AliDielectronPID::IsSelected(TObject* track)
   AliESDtrack *esdTrack=0x0;
   AliAODTrack *aodTrack=0x0;
   Double_t origdEdx=-1;
+  fTPCsignalCorrected=kFALSE;
 
   // apply ETa correction, remove once this is in the tender
+  // the per-event nsigma table has the TPC nsigma of the uncorrected signal,
+  // it is not used for the TPC as long as the signal is corrected
   if( (part->IsA() == AliESDtrack::Class()) ){
     esdTrack=static_cast<AliESDtrack*>(part);
     origdEdx=esdTrack->GetTPCsignal();
-    esdTrack->SetTPCsignal(origdEdx/GetEtaCorr(esdTrack)/fgCorrdEdx,esdTrack->GetTPCsignalSigma(),esdTrack->GetTPCsignalN());
+    Double_t etaCorr=GetEtaCorr(esdTrack);
+    fTPCsignalCorrected=(etaCorr!=1. || fgCorrdEdx!=1.);
+    esdTrack->SetTPCsignal(origdEdx/etaCorr/fgCorrdEdx,esdTrack->GetTPCsignalSigma(),esdTrack->GetTPCsignalN());
   } else if ( (part->IsA() == AliAODTrack::Class()) ){
     aodTrack=static_cast<AliAODTrack*>(track);
     AliAODPid *pid=const_cast<AliAODPid*>(aodTrack->GetDetPid());
     if (pid){
       origdEdx=pid->GetTPCsignal();
-      pid->SetTPCsignal(origdEdx/GetEtaCorr(aodTrack)/fgCorrdEdx);
+      Double_t etaCorr=GetEtaCorr(aodTrack);
+      fTPCsignalCorrected=(etaCorr!=1. || fgCorrdEdx!=1.);
+      pid->SetTPCsignal(origdEdx/etaCorr/fgCorrdEdx);
     }
   }
 
@@ -376,7 +388,7 @@ Bool_t AliDielectronPID::IsSelected(TObject* track)
 
     // check if fFunSigma is set, then check if 'part' is in sigma range of the function
     if(fFunSigma[icut]){
-        val= fPIDResponse->NumberOfSigmasTPC(part, fPartType[icut]);
+        val= NumberOfSigmas(kTPC, part, fPartType[icut]);
         if (fPartType[icut]==AliPID::kElectron){
             val-=fgCorr;
         }
@@ -442,6 +454,21 @@ Bool_t AliDielectronPID::IsSelected(TObject* track)
   return (fNcuts==0 ? kTRUE :selected);
 }
 
+//______________________________________________
+Float_t AliDielectronPID::NumberOfSigmas(DetType det, AliVTrack * const part, AliPID::EParticleType type) const
+{
+  //
+  // ITS, TPC or TOF nsigma from the pid response, or from the per-event table if requested
+  // (not for the TPC if the dE/dx was corrected in IsSelected)
+  //
+  AliPIDResponse::EDetector detector=AliPIDResponse::kTPC;
+  if (det==kITS) detector=AliPIDResponse::kITS;
+  else if (det==kTOF) detector=AliPIDResponse::kTOF;
+  if (fUseNSigmaCache && !(det==kTPC && fTPCsignalCorrected))
+    return AliPIDnSigmaCache::NumberOfSigmas(fPIDResponse, detector, part, type);
+  return fPIDResponse->NumberOfSigmas(detector, part, type);
+}
+
 //______________________________________________
 Bool_t AliDielectronPID::IsSelectedITS(AliVTrack * const part, Int_t icut)
 {
@@ -455,7 +482,7 @@ Bool_t AliDielectronPID::IsSelectedITS(AliVTrack * const part, Int_t icut)
 
   Double_t mom=part->P();
 
-  Float_t numberOfSigmas=fPIDResponse->NumberOfSigmasITS(part, fPartType[icut]);
+  Float_t numberOfSigmas=NumberOfSigmas(kITS, part, fPartType[icut]);
 
   // post pid corrections ("eta corrections")
   if (fPartType[icut]==AliPID::kElectron){
@@ -484,7 +511,7 @@ Bool_t AliDielectronPID::IsSelectedTPC(AliVTrack * const part, Int_t icut, Doubl
   if (fRequirePIDbit[icut]==AliDielectronPID::kIfAvailable&&(pidStatus!=AliPIDResponse::kDetPidOk)) return kTRUE;
 
 
-  Float_t numberOfSigmas=fPIDResponse->NumberOfSigmasTPC(part, fPartType[icut]);
+  Float_t numberOfSigmas=NumberOfSigmas(kTPC, part, fPartType[icut]);
 
   // post pid corrections ("eta corrections")
   if (fPartType[icut]==AliPID::kElectron){
@@ -581,7 +608,7 @@ Bool_t AliDielectronPID::IsSelectedTOF(AliVTrack * const part, Int_t icut)
   if (fRequirePIDbit[icut]==AliDielectronPID::kRequire&&(pidStatus!=AliPIDResponse::kDetPidOk)) return kFALSE;
   if (fRequirePIDbit[icut]==AliDielectronPID::kIfAvailable&&(pidStatus!=AliPIDResponse::kDetPidOk)) return kTRUE;
 
-  Float_t numberOfSigmas=fPIDResponse->NumberOfSigmasTOF(part, fPartType[icut]);
+  Float_t numberOfSigmas=NumberOfSigmas(kTOF, part, fPartType[icut]);
 
   // post pid corrections ("eta corrections")
   if (fPartType[icut]==AliPID::kElectron){
@@ -70,6 +70,10 @@ public:
   void SetDefaults(Int_t def);
 
   Int_t GetNCuts() { return fNcuts;}
+
+  // read the ITS/TPC/TOF nsigma from the per-event table of AliPIDnSigmaCacheTask
+  void SetUseNSigmaCache(Bool_t use=kTRUE) { fUseNSigmaCache=use; }
+  Bool_t GetUseNSigmaCache() const { return fUseNSigmaCache; }
   //
   //Analysis cuts interface
   //const
@@ -125,6 +129,8 @@ private:
   AliDielectronVarCuts *fVarCuts[kNmaxPID]; // varcuts
 
   AliPIDResponse *fPIDResponse;   //! pid response object
+  Bool_t fUseNSigmaCache;         // take the nsigma from AliPIDnSigmaCache (same values, computed once per event)
+  Bool_t fTPCsignalCorrected;     //! TPC signal of the current track corrected for eta/run, TPC nsigma not from the cache
   
   static TGraph *fgFitCorr;       //spline fit object to correct the nsigma deviation in the TPC electron band
   static Double_t fgCorr;         //!correction value for current run. Set if fgFitCorr is set and SetCorrVal(run)
@@ -143,6 +149,7 @@ private:
   static Double_t GetPIDCorr(const AliVTrack *track, TH1 *hist);
   
   THnBase* fMapElectronCutLow[kNmaxPID];  //map for the electron lower cut in units of n-sigma widths 1 centered to zero
+  Float_t NumberOfSigmas(DetType det, AliVTrack * const part, AliPID::EParticleType type) const;
   Bool_t IsSelectedITS(AliVTrack * const part, Int_t icut);
   Bool_t IsSelectedTPC(AliVTrack * const part, Int_t icut, Double_t *values);
 	Bool_t IsSelectedTRD(AliVTrack * const part, Int_t icut, AliTRDPIDResponse::ETRDPIDMethod PIDmethod);
@@ -153,7 +160,7 @@ private:
   AliDielectronPID(const AliDielectronPID &c);
   AliDielectronPID &operator=(const AliDielectronPID &c);
 
-  ClassDef(AliDielectronPID,8)         // Dielectron PID
+  ClassDef(AliDielectronPID,9)         // Dielectron PID
 };
 
 #endif
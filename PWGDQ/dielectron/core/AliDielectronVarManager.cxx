@@ -661,14 +661,11 @@ const char* AliDielectronVarManager::fgkParticleNames[AliDielectronVarManager::k
 };
 
 AliPIDResponse* AliDielectronVarManager::fgPIDResponse      = 0x0;
-AliVEvent*      AliDielectronVarManager::fgEvent            = 0x0;
-AliEventplane*  AliDielectronVarManager::fgTPCEventPlane    = 0x0;
-AliKFVertex*    AliDielectronVarManager::fgKFVertex         = 0x0;
 TProfile*       AliDielectronVarManager::fgMultEstimatorAvg[7][9] = {{0x0}};
 TH3D*           AliDielectronVarManager::fgTRDpidEff[10][4] = {{0x0}};
 TObject*        AliDielectronVarManager::fgLegEffMap           = 0x0;
 TObject*        AliDielectronVarManager::fgPairEffMap          = 0x0;
-TBits*          AliDielectronVarManager::fgFillMap          = 0x0;
+AliDielectronVarContext AliDielectronVarManager::fgDefaultContext;
 Double_t        AliDielectronVarManager::fgTRDpidEffCentRanges[10][4] = {{0.0}};
 TString         AliDielectronVarManager::fgVZEROCalibrationFile = "";
 TString         AliDielectronVarManager::fgVZERORecenteringFile = "";
@@ -680,7 +677,6 @@ AliDielectronQnEPcorrection* AliDielectronVarManager::fgQnEPacRemoval = 0x0;
 Bool_t          AliDielectronVarManager::fgEventPlaneACremoval = kFALSE;
 TString         AliDielectronVarManager::fgQnVectorNorm = "";
 Int_t           AliDielectronVarManager::fgCurrentRun = -1;
-Double_t        AliDielectronVarManager::fgData[AliDielectronVarManager::kNMaxValues] = {0.};
 //________________________________________________________________
 AliDielectronVarManager::AliDielectronVarManager() :
   TNamed("AliDielectronVarManager","AliDielectronVarManager")
@@ -751,6 +747,38 @@ AliDielectronVarManager::~AliDielectronVarManager()
 
 }
 
+//________________________________________________________________
+void AliDielectronVarManager::CompileFillPlan(AliDielectronVarContext &ctx)
+{
+  //
+  // Compile the list of event variables copied into the particle/pair arrays
+  // for the fill map of the context: the requested event variables plus the ones
+  // used to calculate particle/pair variables (vertex, event planes, Q-vectors)
+  //
+  static const ValueTypes kDependencies[] = {
+    kXvPrim, kYvPrim, kZvPrim, kXvPrimMCtruth, kYvPrimMCtruth, kZvPrimMCtruth,
+    kV0ArpH2, kV0CrpH2, kV0ACrpH2, kv0ArpH2, kv0CrpH2, kv0ACrpH2, kTPCrpH2, kZDCACrpH1,
+    kQnTPCrpH2, kQnV0ArpH2, kQnV0CrpH2, kQnV0rpH2, kQnSPDrpH2,
+    kQnV0AxH2, kQnV0AyH2, kQnV0CxH2, kQnV0CyH2, kQnV0xH2, kQnV0yH2, kQnSPDxH2, kQnSPDyH2
+  };
+  const Int_t nDependencies = sizeof(kDependencies)/sizeof(kDependencies[0]);
+
+  ctx.fFillPlanMap = *ctx.fFillMap;
+  ctx.fFillPlanValid = kTRUE;
+  ctx.fFillPlanNEventVars = 0;
+
+  // efficiency maps can be binned in any variable
+  ctx.fFillPlanCopyAll = (ctx.Req(kLegEff) || ctx.Req(kOneOverLegEff) ||
+                       ctx.Req(kPairEff) || ctx.Req(kOneOverPairEff) || ctx.Req(kOneOverPairEffSq));
+  if (ctx.fFillPlanCopyAll) return;
+
+  TBits plan(kNMaxValues);
+  for (Int_t i=0; i<nDependencies; ++i) plan.SetBitNumber(kDependencies[i]);
+  for (Int_t i=kPairMax; i<kNMaxValues; ++i) {
+    if (ctx.Req((ValueTypes)i) || plan.TestBitNumber(i)) ctx.fFillPlanEventVars[ctx.fFillPlanNEventVars++] = i;
+  }
+}
+
 //________________________________________________________________
 UInt_t AliDielectronVarManager::GetValueType(const char* valname) {
   //
@@ -237,6 +237,7 @@ Bool_t AliHFEpid::InitializePID(Int_t run){
     if(fDetectorPID[idet]){ 
       status &= fDetectorPID[idet]->InitializePID(run);
       if(HasMCData() && status) fDetectorPID[idet]->SetHasMCData();
+      fDetectorPID[idet]->SetUseNSigmaCache(UseNSigmaCache());
     }
   }
   SetBit(kIsInit);
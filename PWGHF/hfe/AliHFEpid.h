@@ -66,12 +66,14 @@ class AliHFEpid : public TNamed{
     Bool_t IsSelected(const AliHFEpidObject * const track, AliHFEcontainer *cont = NULL, const Char_t *contname = "trackContainer", AliHFEpidQAmanager *qa = NULL);
 
     Bool_t HasMCData() const { return TestBit(kHasMCData); };
+    Bool_t UseNSigmaCache() const { return TestBit(kUseNSigmaCache); };
 
     void AddDetector(TString detector, UInt_t position);
     void SetDetectorsForAnalysis(TString detectors);
     void SetPIDResponse(const AliPIDResponse * const pid);
     void SetVarManager(AliHFEvarManager *vm) { fVarManager = vm; }
     void SetHasMCData(Bool_t hasMCdata = kTRUE) { SetBit(kHasMCData, hasMCdata); };
+    void SetUseNSigmaCache(Bool_t use = kTRUE) { SetBit(kUseNSigmaCache, use); };
 
     const AliPIDResponse *GetPIDResponse() const;
     UInt_t GetNumberOfPIDdetectors() const { return fNPIDdetectors; }
@@ -102,7 +104,8 @@ class AliHFEpid : public TNamed{
     enum{
       kHasMCData = BIT(14),
       kIsInit = BIT(15),
-      kDetectorsSorted = BIT(16)
+      kDetectorsSorted = BIT(16),
+      kUseNSigmaCache = BIT(17)
     };
     enum{
       kCombinedTPCTRD=0
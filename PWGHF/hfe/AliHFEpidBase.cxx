@@ -21,6 +21,10 @@
 //   Markus Fasel <M.Fasel@gsi.de> 
 // 
 
+#include "AliPIDResponse.h"
+#include "AliPIDnSigmaCache.h"
+#include "AliVTrack.h"
+
 #include "AliHFEpidBase.h"
 #include "AliHFEtools.h"
 
@@ -81,4 +85,29 @@ void AliHFEpidBase::Copy(TObject &ref) const {
   TNamed::Copy(ref);
 }
 
+//___________________________________________________________________
+Float_t AliHFEpidBase::NumberOfSigmasITS(const AliVParticle *track, AliPID::EParticleType species) const {
+  //
+  // ITS n sigma, from the per-event table if requested
+  //
+  if(UseNSigmaCache()) return AliPIDnSigmaCache::NumberOfSigmas(fkPIDResponse, AliPIDResponse::kITS, dynamic_cast<const AliVTrack *>(track), species);
+  return fkPIDResponse->NumberOfSigmasITS(track, species);
+}
+
+//___________________________________________________________________
+Float_t AliHFEpidBase::NumberOfSigmasTPC(const AliVParticle *track, AliPID::EParticleType species) const {
+  //
+  // TPC n sigma, from the per-event table if requested
+  //
+  if(UseNSigmaCache()) return AliPIDnSigmaCache::NumberOfSigmas(fkPIDResponse, AliPIDResponse::kTPC, dynamic_cast<const AliVTrack *>(track), species);
+  return fkPIDResponse->NumberOfSigmasTPC(track, species);
+}
 
+//___________________________________________________________________
+Float_t AliHFEpidBase::NumberOfSigmasTOF(const AliVParticle *track, AliPID::EParticleType species) const {
+  //
+  // TOF n sigma, from the per-event table if requested
+  //
+  if(UseNSigmaCache()) return AliPIDnSigmaCache::NumberOfSigmas(fkPIDResponse, AliPIDResponse::kTOF, dynamic_cast<const AliVTrack *>(track), species);
+  return fkPIDResponse->NumberOfSigmasTOF(track, species);
+}
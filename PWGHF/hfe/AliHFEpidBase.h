@@ -27,6 +27,10 @@
 #include "AliHFEpidObject.h"
 #endif
 
+#ifndef ALIPID_H
+#include "AliPID.h"
+#endif
+
 class TList;
 class AliPIDResponse;
 class AliVParticle;
@@ -45,9 +49,11 @@ class AliHFEpidBase : public TNamed{
     virtual Int_t IsSelected(const AliHFEpidObject *track, AliHFEpidQAmanager *pidqa = NULL) const = 0;
 
     Bool_t HasMCData() const { return TestBit(kHasMCData); };
+    Bool_t UseNSigmaCache() const { return TestBit(kUseNSigmaCache); };
 
     void SetPIDResponse(const AliPIDResponse * const pid) { fkPIDResponse = pid; }
     void SetHasMCData(Bool_t hasMCdata = kTRUE) { SetBit(kHasMCData,hasMCdata); };
+    void SetUseNSigmaCache(Bool_t use = kTRUE) { SetBit(kUseNSigmaCache,use); };
 
     const AliPIDResponse *GetPIDResponse() const { return fkPIDResponse; }; 
 
@@ -55,9 +61,15 @@ class AliHFEpidBase : public TNamed{
     const AliPIDResponse *fkPIDResponse;        //! PID Response
     void Copy(TObject &ref) const;
 
+    // n sigma from the PID Response, or from the per-event table of AliPIDnSigmaCacheTask if requested
+    Float_t NumberOfSigmasITS(const AliVParticle *track, AliPID::EParticleType species) const;
+    Float_t NumberOfSigmasTPC(const AliVParticle *track, AliPID::EParticleType species) const;
+    Float_t NumberOfSigmasTOF(const AliVParticle *track, AliPID::EParticleType species) const;
+
   private:
     enum{
-      kHasMCData = BIT(14)
+      kHasMCData = BIT(14),
+      kUseNSigmaCache = BIT(22) // bits 15-21 are used by the detector PIDs
     };
 
     ClassDef(AliHFEpidBase, 2)      // Base class for detector Electron ID
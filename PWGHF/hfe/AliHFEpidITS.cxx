@@ -144,7 +144,7 @@ Double_t AliHFEpidITS::GetITSNsigmaCorrected(const AliVTrack *track) const {
     //
     // Get the ITS number of sigmas corrected for a possible shift of the mean dE/dx
     //
-    return fkPIDResponse->NumberOfSigmasITS(track, AliPID::kElectron) - fMeanShift;
+    return NumberOfSigmasITS(track, AliPID::kElectron) - fMeanShift;
 }
 //___________________________________________________________________
 void AliHFEpidITS::SetITSnSigma(Float_t nSigmalow, Float_t nSigmahigh) {
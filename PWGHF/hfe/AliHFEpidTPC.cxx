@@ -219,13 +219,13 @@ Int_t AliHFEpidTPC::IsSelected(const AliHFEpidObject *track, AliHFEpidQAmanager
    if((fkEtaMeanCorrection&&fkEtaWidthCorrection)|| (fkPMeanCorrection&&fkPWidthCorrection) ||
       (fkCentralityMeanCorrection&&fkCentralityWidthCorrection)){
       TPCnSigmaCorrected=kTRUE;
-      correctedTPCnSigma=GetCorrectedTPCnSigma(track->GetRecTrack()->Eta(), track->GetMultiplicity(), fkPIDResponse->NumberOfSigmasTPC(track->GetRecTrack(), AliPID::kElectron), track->GetRecTrack()->P());
+      correctedTPCnSigma=GetCorrectedTPCnSigma(track->GetRecTrack()->Eta(), track->GetMultiplicity(), NumberOfSigmasTPC(track->GetRecTrack(), AliPID::kElectron), track->GetRecTrack()->P());
    }
    // jpsi
    if((fkCentralityEtaCorrectionMeanJpsi)&&
       (fkCentralityEtaCorrectionWidthJpsi)){
       TPCnSigmaCorrected=kTRUE;
-      correctedTPCnSigma=GetCorrectedTPCnSigmaJpsi(track->GetRecTrack()->Eta(), track->GetMultiplicity(), fkPIDResponse->NumberOfSigmasTPC(track->GetRecTrack(), AliPID::kElectron));
+      correctedTPCnSigma=GetCorrectedTPCnSigmaJpsi(track->GetRecTrack()->Eta(), track->GetMultiplicity(), NumberOfSigmasTPC(track->GetRecTrack(), AliPID::kElectron));
    }
    if(fkEtaCorrection || fkCentralityCorrection){
       // Correction available
@@ -262,7 +262,7 @@ Int_t AliHFEpidTPC::IsSelected(const AliHFEpidObject *track, AliHFEpidQAmanager
    // make copy of the track in order to allow for applying the correction
    Float_t nsigma=correctedTPCnSigma;
    if(!TPCnSigmaCorrected)
-      nsigma = fUsedEdx ? rectrack->GetTPCsignal() : fkPIDResponse->NumberOfSigmasTPC(rectrack, AliPID::kElectron);
+      nsigma = fUsedEdx ? rectrack->GetTPCsignal() : NumberOfSigmasTPC(rectrack, AliPID::kElectron);
    AliDebug(1, Form("TPC NSigma: %f", nsigma));
    // exclude crossing points:
    // Determine the bethe values for each particle species
@@ -270,7 +270,7 @@ Int_t AliHFEpidTPC::IsSelected(const AliHFEpidObject *track, AliHFEpidQAmanager
    for(Int_t ispecies = 0; ispecies < AliPID::kSPECIES; ispecies++){
       if(ispecies == AliPID::kElectron) continue;
       if(!(fLineCrossingsEnabled & 1 << ispecies)) continue;
-      if(TMath::Abs(fkPIDResponse->NumberOfSigmasTPC(rectrack, (AliPID::EParticleType)ispecies)) < fLineCrossingSigma[ispecies] && TMath::Abs(nsigma) < fNsigmaTPC){
+      if(TMath::Abs(NumberOfSigmasTPC(rectrack, (AliPID::EParticleType)ispecies)) < fLineCrossingSigma[ispecies] && TMath::Abs(nsigma) < fNsigmaTPC){
          // Point in a line crossing region, no PID possible, but !PID still possible ;-)
          isLineCrossing = kTRUE;
          break;
@@ -317,7 +317,7 @@ Bool_t AliHFEpidTPC::CutSigmaModel(const AliHFEpidObject * const track) const {
    //
    Bool_t isSelected = kTRUE;
    AliHFEpidObject::AnalysisType_t anatype = track->IsESDanalysis() ? AliHFEpidObject::kESDanalysis : AliHFEpidObject::kAODanalysis;
-   Float_t nsigma = fUsedEdx ? track->GetRecTrack()->GetTPCsignal() : fkPIDResponse->NumberOfSigmasTPC(track->GetRecTrack(), AliPID::kElectron);
+   Float_t nsigma = fUsedEdx ? track->GetRecTrack()->GetTPCsignal() : NumberOfSigmasTPC(track->GetRecTrack(), AliPID::kElectron);
    Double_t p = GetP(track->GetRecTrack(), anatype);
    Int_t centrality = track->IsPbPb() ? track->GetCentrality() + 1 : 0;
    AliDebug(2, Form("Centrality: %d\n", centrality));
@@ -339,7 +339,7 @@ Int_t AliHFEpidTPC::Reject(const AliVParticle *track, AliHFEpidObject::AnalysisT
       if(!TESTBIT(fRejectionEnabled, ispec)) continue;
       // Particle rejection enabled
       if(p < fRejection[4*ispec] || p > fRejection[4*ispec+2]) continue;
-      Double_t sigma = fkPIDResponse->NumberOfSigmasTPC(track, static_cast<AliPID::EParticleType>(ispec));
+      Double_t sigma = NumberOfSigmasTPC(track, static_cast<AliPID::EParticleType>(ispec));
       if(sigma >= fRejection[4*ispec+1] && sigma <= fRejection[4*ispec+3]) return pdc[ispec] * track->Charge();
    }
    return 0;
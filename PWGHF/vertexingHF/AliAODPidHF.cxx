@@ -31,6 +31,7 @@
 #include "AliAODPid.h"
 #include "AliPID.h"
 #include "AliPIDResponse.h"
+#include "AliPIDnSigmaCache.h"
 #include "AliAODpidUtil.h"
 #include "AliESDtrack.h"
 
@@ -81,7 +82,8 @@ fTPCResponse(new AliTPCPIDResponse()),
 fPriorsH(),
 fCombDetectors(kTPCTOF),
 fUseCombined(kFALSE),
-fDefaultPriors(kTRUE)
+fDefaultPriors(kTRUE),
+fUseNSigmaCache(kFALSE)
 {
   ///
   /// Default constructor
@@ -186,7 +188,8 @@ fPidCombined(0x0),
 fTPCResponse(0x0),
 fCombDetectors(pid.fCombDetectors),
 fUseCombined(pid.fUseCombined),
-fDefaultPriors(pid.fDefaultPriors)
+fDefaultPriors(pid.fDefaultPriors),
+fUseNSigmaCache(pid.fUseNSigmaCache)
 {
   
   fnSigmaCompat=new Double_t[fnNSigmaCompat];
@@ -624,12 +627,12 @@ Int_t AliAODPidHF::MatchTPCTOF(AliAODTrack *track, Int_t specie){
     
     Double_t nSigmaTPC=0.;
     if(okTPC) {
-      nSigmaTPC=fPidResponse->NumberOfSigmasTPC(track,(AliPID::EParticleType)specie);
+      nSigmaTPC=ResponseNumberOfSigmas(AliPIDResponse::kTPC,track,(AliPID::EParticleType)specie);
       if(nSigmaTPC<-990.) nSigmaTPC=0.;
     }
     Double_t nSigmaTOF=0.;
     if(okTOF) {
-      nSigmaTOF=fPidResponse->NumberOfSigmasTOF(track,(AliPID::EParticleType)specie);
+      nSigmaTOF=ResponseNumberOfSigmas(AliPIDResponse::kTOF,track,(AliPID::EParticleType)specie);
     }
     Int_t iPart=specie-2; //species is 2 for pions,3 for kaons and 4 for protons
     if(iPart<0 || iPart>2) return -1;
@@ -877,7 +880,7 @@ Int_t AliAODPidHF::GetnSigmaITS(AliAODTrack *track,Int_t species, Double_t &nsig
   else { // new pid
     
     AliPID::EParticleType type=AliPID::EParticleType(species);
-    nsigmaITS = fPidResponse->NumberOfSigmasITS(track,type);
+    nsigmaITS = ResponseNumberOfSigmas(AliPIDResponse::kITS,track,type);
     
   } //new pid
   
@@ -907,7 +910,7 @@ Int_t AliAODPidHF::GetnSigmaTPC(AliAODTrack *track, Int_t species, Double_t &nsi
   } else{
     if(!fPidResponse) return -1;
     AliPID::EParticleType type=AliPID::EParticleType(species);
-    nsigmaTPC = fPidResponse->NumberOfSigmasTPC(track,type);
+    nsigmaTPC = ResponseNumberOfSigmas(AliPIDResponse::kTPC,track,type);
     nsigma=nsigmaTPC;
   }
   return 1;
@@ -921,7 +924,7 @@ Int_t AliAODPidHF::GetnSigmaTOF(AliAODTrack *track,Int_t species, Double_t &nsig
   if(!CheckTOFPIDStatus(track)) return -1;
   
   if(fPidResponse){
-    nsigma = fPidResponse->NumberOfSigmasTOF(track,(AliPID::EParticleType)species);
+    nsigma = ResponseNumberOfSigmas(AliPIDResponse::kTOF,track,(AliPID::EParticleType)species);
     return 1;
   }else{
     AliFatal("To use TOF PID you need to attach AliPIDResponseTask");
@@ -1282,17 +1285,25 @@ Bool_t AliAODPidHF::CheckDetectorPIDStatus(AliPIDResponse::EDetector detector, A
   }
 }
 
+//------------------
+Float_t AliAODPidHF::ResponseNumberOfSigmas(AliPIDResponse::EDetector detector, AliAODTrack *track, AliPID::EParticleType specie) const {
+  /// n sigma from the PID response, or from the per-event table of
+  /// AliPIDnSigmaCacheTask if requested (same value)
+  if(fUseNSigmaCache) return AliPIDnSigmaCache::NumberOfSigmas(fPidResponse, detector, track, specie);
+  return fPidResponse->NumberOfSigmas(detector, track, specie);
+}
+
 //------------------
 Float_t AliAODPidHF::NumberOfSigmas(AliPID::EParticleType specie, AliPIDResponse::EDetector detector, AliAODTrack *track) {
   switch (detector) {
     case AliPIDResponse::kITS:
-      return fPidResponse->NumberOfSigmasITS(track, specie);
+      return ResponseNumberOfSigmas(AliPIDResponse::kITS, track, specie);
       break;
     case AliPIDResponse::kTPC:
-      return fPidResponse->NumberOfSigmasTPC(track, specie);
+      return ResponseNumberOfSigmas(AliPIDResponse::kTPC, track, specie);
       break;
     case AliPIDResponse::kTOF:
-      return fPidResponse->NumberOfSigmasTOF(track, specie);
+      return ResponseNumberOfSigmas(AliPIDResponse::kTOF, track, specie);
       break;
     default:
       return -999.;
@@ -109,6 +109,8 @@ public:
   void SetPtThresholdTPC(Double_t ptThresholdTPC){fPtThresholdTPC=ptThresholdTPC;return;}
   void SetMaxTrackMomForCombinedPID(Double_t mom){fMaxTrackMomForCombinedPID=mom;}
   void SetPidResponse(AliPIDResponse *pidResp) {fPidResponse=pidResp;return;}
+  /// read the ITS/TPC/TOF n sigma from the per-event table of AliPIDnSigmaCacheTask
+  void SetUseNSigmaCache(Bool_t use=kTRUE) {fUseNSigmaCache=use;return;}
   void SetCombDetectors(ECombDetectors pidComb) {
     fCombDetectors=pidComb;
   }
@@ -231,6 +233,8 @@ private:
 
   AliAODPidHF& operator=(const AliAODPidHF& pid);
 
+  Float_t ResponseNumberOfSigmas(AliPIDResponse::EDetector detector, AliAODTrack *track, AliPID::EParticleType specie) const;
+
   Int_t fnNSigma; /// number of sigmas
   /// sigma for the raw signal PID: 0-2 for TPC, 3 for TOF, 4 for ITS
   Double_t *fnSigma; // [fnNSigma], sigma for the raw signal PID: 0-2 for TPC, 3 for TOF, 4 for ITS
@@ -283,6 +287,7 @@ private:
   ECombDetectors fCombDetectors; /// detectors to be involved for combined PID
   Bool_t fUseCombined; /// detectors to be involved for combined PID
   Bool_t fDefaultPriors; /// use default priors for combined PID
+  Bool_t fUseNSigmaCache; /// n sigma from AliPIDnSigmaCache (same values, computed once per event)
 
   /// Storage of identification/compatibility band for different species and detectors:
   TF1 *fIdBandMin[AliPID::kSPECIES][4];
@@ -291,7 +296,7 @@ private:
   TF1 *fCompBandMax[AliPID::kSPECIES][4];
 
   /// \cond CLASSIMP
-  ClassDef(AliAODPidHF,24); /// AliAODPid for heavy flavor PID
+  ClassDef(AliAODPidHF,25); /// AliAODPid for heavy flavor PID
   /// \endcond
 
 };
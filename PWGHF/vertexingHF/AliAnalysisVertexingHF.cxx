@@ -618,6 +618,18 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
   AliDebug(1,Form(" Selected tracks: %d",nSeleTrks));
   fnSeleTrksTotal += nSeleTrks;
 
+  // counters of the 3-prong triplets rejected by the invariant mass cut
+  // before computing the DCAs, and of those for which the DCAs are computed
+  Long64_t n3ProngMassPreRejected=0;
+  Long64_t n3ProngWithDCA=0;
+
+  // momenta of selected tracks at primary vertex, used for the invariant
+  // mass pre-selection of 3 prong candidates before the DCA calculation
+  Double_t *momAtVertex = new Double_t[3*nSeleTrks+1];
+  for(Int_t iTrk=0; iTrk<nSeleTrks; iTrk++) {
+    ((AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrk))->GetPxPyPz(&momAtVertex[3*iTrk]);
+  }
+
 
   TObjArray *twoTrackArray1    = new TObjArray(2);
   TObjArray *twoTrackArray2    = new TObjArray(2);
@@ -1121,6 +1133,21 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	  if(!TESTBIT(seleFlags[iTrkP1],kBitKaonCompat) &&
 	     !TESTBIT(seleFlags[iTrkP2],kBitKaonCompat) ) okForDsToKKpi=kFALSE;
 	}
+
+	// check invariant mass cuts for D+,Ds,Lc with the momenta at primary
+	// vertex before the DCA calculation, when a failure rejects the triplet
+	// (the fOKInvMass flags used in Make3Prong are those of this call)
+	Bool_t massCutDone=kFALSE;
+	if(f3Prong && fMassCutBeforeVertexing && !f4Prong){
+	  for(Int_t iCoord=0; iCoord<3; iCoord++) mompos2[iCoord]=momAtVertex[3*iTrkP2+iCoord];
+	  Double_t pxDau[3]={mompos1[0],momneg1[0],mompos2[0]};
+	  Double_t pyDau[3]={mompos1[1],momneg1[1],mompos2[1]};
+	  Double_t pzDau[3]={mompos1[2],momneg1[2],mompos2[2]};
+	  if(!SelectInvMassAndPt3prong(pxDau,pyDau,pzDau,pidLcStatus)) { postrack2=0; n3ProngMassPreRejected++; continue; }
+	  massCutDone=kTRUE;
+	}
+	n3ProngWithDCA++;
+
 	// back to primary vertex
 	//	postrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
 	//	postrack2->PropagateToDCA(fV1,fBzkG,kVeryBig);
@@ -1128,6 +1155,11 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	SetParametersAtVertex(postrack1,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkP1));
 	SetParametersAtVertex(negtrack1,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkN1));
 	SetParametersAtVertex(postrack2,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkP2));
+	if(massCutDone && !SameMomentum(postrack2,&momAtVertex[3*iTrkP2])){
+	  // not expected, SetParametersAtVertex copies the parameters: redo the mass cut below
+	  AliError("Momentum at primary vertex differs from the cached one, mass cut repeated");
+	  massCutDone=kFALSE;
+	}
 
 	//printf("********** %d %d %d\n",postrack1->GetID(),postrack2->GetID(),negtrack1->GetID());
 
@@ -1148,7 +1180,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	    threeTrackArray->AddAt(postrack1,1);
 	    threeTrackArray->AddAt(postrack2,2);
 	  }
-	  if(fMassCutBeforeVertexing){
+	  if(fMassCutBeforeVertexing && !massCutDone){
 	    postrack2->GetPxPyPz(mompos2);
 	    Double_t pxDau[3]={mompos1[0],momneg1[0],mompos2[0]};
 	    Double_t pyDau[3]={mompos1[1],momneg1[1],mompos2[1]};
@@ -1400,6 +1432,25 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	     !TESTBIT(seleFlags[iTrkN2],kBitKaonCompat) ) okForDsToKKpi=kFALSE;
 	}
 
+	// check invariant mass cuts for D+,Ds,Lc with the momenta at primary
+	// vertex, before the DCA calculation
+	// (the fOKInvMass flags used in Make3Prong are those of this call)
+        massCutOK=kTRUE;
+	if(fMassCutBeforeVertexing && f3Prong){
+	  for(Int_t iCoord=0; iCoord<3; iCoord++) momneg2[iCoord]=momAtVertex[3*iTrkN2+iCoord];
+	  Double_t pxDau[3]={momneg1[0],mompos1[0],momneg2[0]};
+	  Double_t pyDau[3]={momneg1[1],mompos1[1],momneg2[1]};
+	  Double_t pzDau[3]={momneg1[2],mompos1[2],momneg2[2]};
+	  //	  massCutOK = SelectInvMassAndPt3prong(threeTrackArray);
+	  massCutOK = SelectInvMassAndPt3prong(pxDau,pyDau,pzDau,pidLcStatus);
+	}
+	if(!massCutOK) {
+	  negtrack2=0;
+	  n3ProngMassPreRejected++;
+	  continue;
+	}
+	n3ProngWithDCA++;
+
 	// back to primary vertex
 	// postrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
 	// negtrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
@@ -1407,6 +1458,15 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	SetParametersAtVertex(postrack1,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkP1));
 	SetParametersAtVertex(negtrack1,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkN1));
 	SetParametersAtVertex(negtrack2,(AliExternalTrackParam*)tracksAtVertex.UncheckedAt(iTrkN2));
+	if(fMassCutBeforeVertexing && f3Prong && !SameMomentum(negtrack2,&momAtVertex[3*iTrkN2])){
+	  // not expected, SetParametersAtVertex copies the parameters: redo the mass cut
+	  AliError("Momentum at primary vertex differs from the cached one, mass cut repeated");
+	  negtrack2->GetPxPyPz(momneg2);
+	  Double_t pxDau[3]={momneg1[0],mompos1[0],momneg2[0]};
+	  Double_t pyDau[3]={momneg1[1],mompos1[1],momneg2[1]};
+	  Double_t pzDau[3]={momneg1[2],mompos1[2],momneg2[2]};
+	  if(!SelectInvMassAndPt3prong(pxDau,pyDau,pzDau,pidLcStatus)) { negtrack2=0; continue; }
+	}
 	//printf("********** %d %d %d\n",postrack1->GetID(),negtrack1->GetID(),negtrack2->GetID());
 
 	dcap1n2 = postrack1->GetDCA(negtrack2,fBzkG,xdummy,ydummy);
@@ -1418,22 +1478,6 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	threeTrackArray->AddAt(postrack1,1);
 	threeTrackArray->AddAt(negtrack2,2);
 
-	// check invariant mass cuts for D+,Ds,Lc
-        massCutOK=kTRUE;
-	if(fMassCutBeforeVertexing && f3Prong){
-	  negtrack2->GetPxPyPz(momneg2);
-	  Double_t pxDau[3]={momneg1[0],mompos1[0],momneg2[0]};
-	  Double_t pyDau[3]={momneg1[1],mompos1[1],momneg2[1]};
-	  Double_t pzDau[3]={momneg1[2],mompos1[2],momneg2[2]};
-	  //	  massCutOK = SelectInvMassAndPt3prong(threeTrackArray);
-	  massCutOK = SelectInvMassAndPt3prong(pxDau,pyDau,pzDau,pidLcStatus);
-	}
-	if(!massCutOK) {
-	  threeTrackArray->Clear();
-	  negtrack2=0;
-	  continue;
-	}
-
 	// Vertexing
 	twoTrackArray2->AddAt(postrack1,0);
 	twoTrackArray2->AddAt(negtrack2,1);
@@ -1514,6 +1558,8 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
   if(f3Prong) {
     AliDebug(1,Form(" Charm->3Prong in event = %d;",
 		    (Int_t)aodCharm3ProngTClArr->GetEntriesFast()));
+    AliDebug(1,Form(" 3-prong triplets rejected by the mass cut before the DCA calculation = %lld, with DCA calculation = %lld;",
+		    n3ProngMassPreRejected,n3ProngWithDCA));
   }
   if(f4Prong) {
     AliDebug(1,Form(" Charm->4Prong in event = %d;\n",
@@ -1545,6 +1591,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
   threeTrackArray->Delete(); delete threeTrackArray;
   fourTrackArray->Delete();  delete fourTrackArray;
   delete [] seleFlags; seleFlags=NULL;
+  delete [] momAtVertex; momAtVertex=NULL;
   if(evtNumber) {delete [] evtNumber; evtNumber=NULL;}
   tracksAtVertex.Delete();
 
@@ -3697,6 +3744,14 @@ void AliAnalysisVertexingHF::SetParametersAtVertex(AliESDtrack* esdt, const AliE
   return;
 }
 //-----------------------------------------------------------------------------
+Bool_t AliAnalysisVertexingHF::SameMomentum(const AliESDtrack* esdt, const Double_t* mom) const{
+  /// Check that the momentum of the track is the given one (bit by bit)
+
+  Double_t trackMom[3];
+  esdt->GetPxPyPz(trackMom);
+  return trackMom[0]==mom[0] && trackMom[1]==mom[1] && trackMom[2]==mom[2];
+}
+//-----------------------------------------------------------------------------
 void AliAnalysisVertexingHF::SetMasses(){
   /// Set the hadron mass values from TDatabasePDG
 
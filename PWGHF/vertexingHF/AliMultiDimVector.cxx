@@ -29,6 +29,7 @@
 #include <fstream>
 #include <Riostream.h>
 #include "TH2.h"
+#include "TBuffer.h"
 #include "AliMultiDimVector.h"
 #include "AliLog.h"
 #include "TString.h"
@@ -40,13 +41,18 @@ using std::endl;
 ClassImp(AliMultiDimVector);
 /// \endcond
 
+const Double_t AliMultiDimVector::fgkMaxExactFloat=16777216.; // 2^24
+
 //___________________________________________________________________________
 AliMultiDimVector::AliMultiDimVector():TNamed("AliMultiDimVector","default"),
 fNVariables(0),
 fNPtBins(0),
 fVett(0),
 fNTotCells(0),
-fIsIntegrated(0)
+fIsIntegrated(0),
+fDeferIntegration(kFALSE),
+fPendingFills(0),
+fNPendingFills(0)
 {
   // default constructor
 
@@ -67,7 +73,10 @@ fNVariables(npars),
 fNPtBins(nptbins),
 fVett(0),
 fNTotCells(0),
-fIsIntegrated(0){
+fIsIntegrated(0),
+fDeferIntegration(kFALSE),
+fPendingFills(0),
+fNPendingFills(0){
 // standard constructor
 
   for(Int_t i=0; i<fgkMaxNVariables; i++) {
@@ -119,7 +128,10 @@ fNVariables(mv.fNVariables),
 fNPtBins(mv.fNPtBins),
 fVett(0),
 fNTotCells(mv.fNTotCells),
-fIsIntegrated(mv.fIsIntegrated)
+fIsIntegrated(mv.fIsIntegrated),
+fDeferIntegration(mv.fDeferIntegration),
+fPendingFills(mv.fPendingFills),
+fNPendingFills(mv.fNPendingFills)
 {
   // copy constructor
 
@@ -160,6 +172,9 @@ AliMultiDimVector &AliMultiDimVector::operator=(const AliMultiDimVector &mv)
   fNPtBins=mv.fNPtBins;
   fNTotCells=mv.fNTotCells;
   fIsIntegrated=mv.fIsIntegrated;
+  fDeferIntegration=mv.fDeferIntegration;
+  fPendingFills=mv.fPendingFills;
+  fNPendingFills=mv.fNPendingFills;
 
 
   for(Int_t i=0; i<fgkMaxNVariables; i++) {
@@ -204,6 +219,8 @@ void AliMultiDimVector::CopyStructure(const AliMultiDimVector* mv){
   }
   for(Int_t ipt=0;ipt<fNPtBins+1;ipt++) fPtLimits[ipt]=mv->GetPtLimit(ipt);
   fVett.Set(fNTotCells);  
+  fPendingFills.Set(0);
+  fNPendingFills=0;
 }
 //______________________________________________________________________
 Bool_t AliMultiDimVector::GetIndicesFromGlobalAddress(ULong64_t globadd, Int_t *ind, Int_t &ptbin) const {
@@ -325,6 +342,18 @@ void AliMultiDimVector::Add(const AliMultiDimVector* mv){
   }
 }
 //_____________________________________________________________________________
+void AliMultiDimVector::Streamer(TBuffer &R__b){
+  // stream an object of class AliMultiDimVector
+  // candidates pending from deferred integration are added to the matrix before writing
+
+  if(R__b.IsReading()){
+    R__b.ReadClassBuffer(AliMultiDimVector::Class(),this);
+  }else{
+    if(fNPendingFills>0) AddPendingFills();
+    R__b.WriteClassBuffer(AliMultiDimVector::Class(),this);
+  }
+}
+//_____________________________________________________________________________
 void AliMultiDimVector::Sum(const AliMultiDimVector* mv1, const AliMultiDimVector* mv2){
   // Sets AliMultiDimVector=mv1+mv2
   if (fNTotCells!=mv1->GetNTotCells()&&mv1->GetNTotCells()!=mv2->GetNTotCells()) {
@@ -542,15 +571,83 @@ void  AliMultiDimVector::GetFillRange(Int_t iVar, Int_t iCell, Int_t& minbin, In
 //_____________________________________________________________________________ 
 void AliMultiDimVector::Integrate(){
   // integrates the matrix
+  // (with deferred integration: integrates the pending candidates and adds them to the matrix)
   if(fIsIntegrated){
-    AliError("MultiDimVector already integrated");
+    if(fNPendingFills==0){
+      AliError("MultiDimVector already integrated");
+      return;
+    }
+    AddPendingFills();
     return;
   }
-  TArrayF integral(fNTotCells);
-  for(ULong64_t i=0;i<fNTotCells;i++) integral[i]=CountsAboveCell(i);
-  for(ULong64_t i=0;i<fNTotCells;i++) fVett[i]= integral[i];
+  TArrayD integral(fNTotCells);
+  for(ULong64_t i=0;i<fNTotCells;i++) integral[i]=fVett[i];
+  if(CumulateAboveCells(integral)){
+    for(ULong64_t i=0;i<fNTotCells;i++) fVett[i]=integral[i];
+  }else{
+    // contents are not exact integers: cell by cell, with the same rounding as before
+    TArrayF integralCells(fNTotCells);
+    for(ULong64_t i=0;i<fNTotCells;i++) integralCells[i]=CountsAboveCell(i);
+    for(ULong64_t i=0;i<fNTotCells;i++) fVett[i]=integralCells[i];
+  }
   fIsIntegrated=kTRUE;
-}//_____________________________________________________________________________ 
+  if(fNPendingFills>0) AddPendingFills();
+}
+//_____________________________________________________________________________ 
+void AliMultiDimVector::AddPendingFills(){
+  // integrates the candidates counted with deferred integration and adds them to the matrix:
+  // each candidate contributes 1 to all cells below its own cell
+
+  CumulateAboveCells(fPendingFills);
+  for(ULong64_t i=0;i<fNTotCells;i++){
+    Double_t nfills=fPendingFills[i];
+    if(nfills==0) continue;
+    Float_t cont=fVett[i];
+    if(cont==TMath::Floor(cont) && TMath::Abs(cont)+nfills<fgkMaxExactFloat){
+      fVett[i]=cont+nfills;
+    }else{
+      // not exact in single precision: increment one by one as FillAndIntegrate
+      for(Double_t k=0;k<nfills;k++) cont+=1.;
+      fVett[i]=cont;
+    }
+  }
+  fPendingFills.Set(0);
+  fNPendingFills=0;
+}
+//_____________________________________________________________________________ 
+Bool_t AliMultiDimVector::CumulateAboveCells(TArrayD& vett) const{
+  // replaces each element of vett (with the structure of this AliMultiDimVector)
+  // by the sum of the elements above it, i.e. with index >= its own index for all variables
+  // (as CountsAboveCell), using one cumulative sum per variable: N*fNVariables operations
+  // Returns kTRUE if the contents are integers small enough for all sums to be exact 
+  // in single precision, i.e. if the result is identical to the one of CountsAboveCell
+
+  Double_t sumabs=0.;
+  Bool_t isExact=kTRUE;
+  for(ULong64_t i=0;i<fNTotCells;i++){
+    if(vett[i]!=TMath::Floor(vett[i])) isExact=kFALSE;
+    sumabs+=TMath::Abs(vett[i]);
+  }
+  if(sumabs>=fgkMaxExactFloat) isExact=kFALSE;
+  if(fNTotCells==0) return isExact;
+
+  // pt bin is the fastest index, the last variable the next one
+  ULong64_t stride=fNPtBins;
+  for(Int_t iVar=fNVariables-1;iVar>=0;iVar--){
+    const ULong64_t nSteps=fNCutSteps[iVar];
+    const ULong64_t block=stride*nSteps;
+    for(ULong64_t first=0;first<fNTotCells;first+=block){
+      for(ULong64_t iStep=nSteps-1;iStep>0;iStep--){
+	Double_t *to=vett.GetArray()+first+(iStep-1)*stride;
+	const Double_t *from=to+stride;
+	for(ULong64_t j=0;j<stride;j++) to[j]+=from[j];
+      }
+    }
+    stride=block;
+  }
+  return isExact;
+}
+//_____________________________________________________________________________ 
 ULong64_t* AliMultiDimVector::GetGlobalAddressesAboveCuts(const Float_t *values, Int_t ptbin, Int_t& nVals) const{
   // fills an array with global addresses of cells passing the cuts
 
@@ -652,6 +749,13 @@ void AliMultiDimVector::FillAndIntegrate(Float_t* values, Int_t ptbin){
   Bool_t retcode=GetIndicesFromValues(values,ind);
   if(!retcode) return;
   for(Int_t i=fNVariables; i<fgkMaxNVariables; i++) ind[i]=0;
+  if(fDeferIntegration){
+    // only count the candidate, cells passing the cuts are filled in Integrate()
+    if(fPendingFills.GetSize()!=(Int_t)fNTotCells) fPendingFills.Set(fNTotCells);
+    fPendingFills[GetGlobalAddressFromIndices(ind,ptbin)]+=1.;
+    fNPendingFills++;
+    return;
+  }
   Int_t mink[fgkMaxNVariables];
   Int_t maxk[fgkMaxNVariables];
   for(Int_t i=0;i<fgkMaxNVariables;i++){
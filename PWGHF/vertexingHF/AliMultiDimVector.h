@@ -18,6 +18,7 @@
 ///                                                               //
 ///////////////////////////////////////////////////////////////////
 
+#include "TArrayD.h"
 #include "TArrayF.h"
 #include "TArrayI.h"
 #include "TNamed.h"
@@ -98,9 +99,17 @@ class AliMultiDimVector :  public TNamed{
   void Fill(Float_t* values, Int_t ptbin);
   void FillAndIntegrate(Float_t* values, Int_t ptbin);
   void Integrate();
+  /// With deferred integration FillAndIntegrate only counts the candidate in its cell,
+  /// the counts are integrated (and added to the vector) by the next call to Integrate(),
+  /// which must be done before using the content of the vector (done automatically when writing)
+  void SetDeferredIntegration(Bool_t defer=kTRUE) {fDeferIntegration=defer;}
+  Bool_t IsDeferredIntegration() const {return fDeferIntegration;}
+  ULong64_t GetNPendingFills() const {return fNPendingFills;}
 
   void Reset(){
     for(ULong64_t i=0; i<fNTotCells; i++) fVett[i]=0.;
+    fPendingFills.Set(0);
+    fNPendingFills=0;
   }
   void MultiplyBy(Float_t factor);
   void Multiply(const AliMultiDimVector* mv,Float_t factor);
@@ -131,12 +140,15 @@ class AliMultiDimVector :  public TNamed{
   void GetIntegrationLimits(Int_t iVar, Int_t iCell, Int_t& minbin, Int_t& maxbin) const;
   void GetFillRange(Int_t iVar, Int_t iCell, Int_t& minbin, Int_t& maxbin) const;
   Float_t   CountsAboveCell(ULong64_t globadd) const;
+  Bool_t    CumulateAboveCells(TArrayD& vett) const;
+  void      AddPendingFills();
 
   //void SetMinLimits(Int_t nvar, Float_t* minlim);
   //void SetMaxLimits(Int_t nvar, Float_t* maxlim);
  private:
   static const Int_t fgkMaxNVariables=10;  /// max. n. of selection variables
   static const Int_t fgkMaxNPtBins=10;     /// max. n. of Pt bins
+  static const Double_t fgkMaxExactFloat;  /// integers up to this value are exact in single precision
 
   Int_t     fNVariables;                   /// n. of selection variables
   Int_t     fNPtBins;                      /// n. of pt bins
@@ -149,9 +161,12 @@ class AliMultiDimVector :  public TNamed{
   TArrayF   fVett;                   /// array with n. of candidates vs. cuts
   ULong64_t fNTotCells;              /// total number of matrix elements
   Bool_t    fIsIntegrated;           /// flag for integrated matrix
+  Bool_t    fDeferIntegration;       //! integrate FillAndIntegrate entries in Integrate()
+  TArrayD   fPendingFills;           //! candidates filled with deferred integration, not yet integrated
+  ULong64_t fNPendingFills;          //! n. of candidates in fPendingFills
 
   /// \cond CLASSIMP    
-  ClassDef(AliMultiDimVector,2); /// a multi-dimensional vector class
+  ClassDef(AliMultiDimVector,3); /// a multi-dimensional vector class
   /// \endcond
 };
 
@@ -73,7 +73,7 @@
 #pragma link C++ class AliAnalysisTaskSESignificance+;
 #pragma link C++ class AliAnalysisTaskSEHFQA+;
 #pragma link C++ class AliAnalysisTaskTrackingSysPropagation+;
-#pragma link C++ class AliMultiDimVector+;
+#pragma link C++ class AliMultiDimVector-;
 #pragma link C++ class AliSignificanceCalculator+;
 #pragma link C++ class AliHFMassFitter+;
 #pragma link C++ class AliHFPtSpectrum+;
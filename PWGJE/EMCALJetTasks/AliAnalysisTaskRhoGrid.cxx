@@ -0,0 +1,348 @@
+// $Id$
+//
+// Calculation of rho from the tiles of an η–φ grid, filled with the accepted
+// tracks and clusters: rho is the median over the tiles of the summed pt over
+// the tile area, rho mass the median of the summed mt - pt over the tile area,
+// with mt from the mass hypothesis of the particle container. No kt jet
+// finding is needed. The tiles overlapping the leading jets of the jet
+// container (if any) can be excluded; with the occupancy correction the
+// median is taken over the occupied tiles only and scaled by the fraction
+// of occupied tiles, which avoids rho = 0 in sparse events.
+// A rho from another task can be given with SetCompareRhoName() to validate
+// the grid estimate against it (macros/RunRhoGridValidation.C compares it with
+// the kt rho).
+
+#include "AliAnalysisTaskRhoGrid.h"
+
+#include <algorithm>
+#include <functional>
+
+#include <TClonesArray.h>
+#include <TH2F.h>
+#include <TMath.h>
+#include <TVector2.h>
+
+#include "AliEmcalJet.h"
+#include "AliJetContainer.h"
+#include "AliLog.h"
+#include "AliRhoParameter.h"
+#include "AliClusterContainer.h"
+#include "AliParticleContainer.h"
+
+ClassImp(AliAnalysisTaskRhoGrid)
+
+//________________________________________________________________________
+AliAnalysisTaskRhoGrid::AliAnalysisTaskRhoGrid() :
+  AliAnalysisTaskRhoBase("AliAnalysisTaskRhoGrid"),
+  fTileSizeEta(0.55),
+  fTileSizePhi(0.55),
+  fNExclLeadJets(0),
+  fOccupancyCorr(kFALSE),
+  fOutRhoMassName(),
+  fNTilesEta(0),
+  fNTilesPhi(0),
+  fGridEtaMin(0),
+  fGridPhiMin(0),
+  fTileEta(0),
+  fTilePhi(0),
+  fOccupancy(0),
+  fTilePt(),
+  fTileMtMinusPt(),
+  fTileNPart(),
+  fTileExcluded(),
+  fMedianValues(),
+  fOutRhoMass(0),
+  fHistOccupancyvsCent(0),
+  fHistRhoMassvsCent(0),
+  fHistRhovsCompareRho(0),
+  fHistDeltaRhovsCent(0)
+{
+  // Default constructor.
+}
+
+//________________________________________________________________________
+AliAnalysisTaskRhoGrid::AliAnalysisTaskRhoGrid(const char *name, Bool_t histo) :
+  AliAnalysisTaskRhoBase(name, histo),
+  fTileSizeEta(0.55),
+  fTileSizePhi(0.55),
+  fNExclLeadJets(0),
+  fOccupancyCorr(kFALSE),
+  fOutRhoMassName(),
+  fNTilesEta(0),
+  fNTilesPhi(0),
+  fGridEtaMin(0),
+  fGridPhiMin(0),
+  fTileEta(0),
+  fTilePhi(0),
+  fOccupancy(0),
+  fTilePt(),
+  fTileMtMinusPt(),
+  fTileNPart(),
+  fTileExcluded(),
+  fMedianValues(),
+  fOutRhoMass(0),
+  fHistOccupancyvsCent(0),
+  fHistRhoMassvsCent(0),
+  fHistRhovsCompareRho(0),
+  fHistDeltaRhovsCent(0)
+{
+  // Constructor.
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskRhoGrid::UserCreateOutputObjects()
+{
+  // User create output objects, called at the beginning of the analysis.
+
+  AliAnalysisTaskRhoBase::UserCreateOutputObjects();
+
+  if (!fCreateHisto)
+    return;
+
+  fHistOccupancyvsCent = new TH2F("fHistOccupancyvsCent", "fHistOccupancyvsCent", 101, -1, 100, 100, 0, 1);
+  fHistOccupancyvsCent->GetXaxis()->SetTitle("Centrality (%)");
+  fHistOccupancyvsCent->GetYaxis()->SetTitle("Fraction of occupied tiles");
+  fOutput->Add(fHistOccupancyvsCent);
+
+  if (!fOutRhoMassName.IsNull()) {
+    fHistRhoMassvsCent = new TH2F("fHistRhoMassvsCent", "fHistRhoMassvsCent", 101, -1, 100, fNbins, 0, fMaxBinPt/4);
+    fHistRhoMassvsCent->GetXaxis()->SetTitle("Centrality (%)");
+    fHistRhoMassvsCent->GetYaxis()->SetTitle("#rho_{m} (GeV/c^{2} * rad^{-1})");
+    fOutput->Add(fHistRhoMassvsCent);
+  }
+
+  if (!fCompareRhoName.IsNull()) {
+    fHistRhovsCompareRho = new TH2F("fHistRhovsCompareRho", "fHistRhovsCompareRho", fNbins, fMinBinPt, fMaxBinPt*2, fNbins, fMinBinPt, fMaxBinPt*2);
+    fHistRhovsCompareRho->GetXaxis()->SetTitle("#rho to compare (GeV/c * rad^{-1})");
+    fHistRhovsCompareRho->GetYaxis()->SetTitle("#rho grid (GeV/c * rad^{-1})");
+    fOutput->Add(fHistRhovsCompareRho);
+
+    fHistDeltaRhovsCent = new TH2F("fHistDeltaRhovsCent", "fHistDeltaRhovsCent", 101, -1, 100, fNbins, -fMaxBinPt/2, fMaxBinPt/2);
+    fHistDeltaRhovsCent->GetXaxis()->SetTitle("Centrality (%)");
+    fHistDeltaRhovsCent->GetYaxis()->SetTitle("#rho grid - #rho to compare (GeV/c * rad^{-1})");
+    fOutput->Add(fHistDeltaRhovsCent);
+  }
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskRhoGrid::ExecOnce()
+{
+  // Init the analysis.
+
+  if (!fOutRhoMassName.IsNull() && !fOutRhoMass) {
+    fOutRhoMass = new AliRhoParameter(fOutRhoMassName, 0);
+
+    if (fAttachToEvent) {
+      if (!(InputEvent()->FindListObject(fOutRhoMassName))) {
+        InputEvent()->AddObject(fOutRhoMass);
+      } else {
+        AliFatal(Form("%s: Container with same name %s already present. Aborting", GetName(), fOutRhoMassName.Data()));
+        return;
+      }
+    }
+  }
+
+  AliAnalysisTaskRhoBase::ExecOnce();
+
+  // grid covering the acceptance of the particles
+  Double_t minEta = -0.9, maxEta = 0.9;
+  Double_t minPhi = 0, maxPhi = TMath::TwoPi();
+  AliParticleContainer *partCont = GetParticleContainer(0);
+  if (partCont) {
+    minEta = partCont->GetParticleEtaMin();
+    maxEta = partCont->GetParticleEtaMax();
+    minPhi = partCont->GetParticlePhiMin();
+    maxPhi = partCont->GetParticlePhiMax();
+  }
+  else {
+    AliError(Form("%s: No particle container found! Assuming |eta| < 0.9 and full phi...", GetName()));
+  }
+
+  if (maxPhi > TMath::TwoPi()) maxPhi = TMath::TwoPi();
+  if (minPhi < 0) minPhi = 0;
+
+  fNTilesEta = TMath::Max(1, TMath::Nint((maxEta - minEta) / fTileSizeEta));
+  fNTilesPhi = TMath::Max(1, TMath::Nint((maxPhi - minPhi) / fTileSizePhi));
+  fGridEtaMin = minEta;
+  fGridPhiMin = minPhi;
+  fTileEta = (maxEta - minEta) / fNTilesEta;
+  fTilePhi = (maxPhi - minPhi) / fNTilesPhi;
+
+  if (fTileEta * fTilePhi < 1e-6) {
+    AliError(Form("%s: Tile area = %f < 1e-6, assuming a single tile of area 1", GetName(), fTileEta * fTilePhi));
+    fNTilesEta = 1;
+    fNTilesPhi = 1;
+    fTileEta = 1;
+    fTilePhi = 1;
+  }
+
+  const Int_t nTiles = fNTilesEta * fNTilesPhi;
+  fTilePt.resize(nTiles);
+  fTileMtMinusPt.resize(nTiles);
+  fTileNPart.resize(nTiles);
+  fTileExcluded.resize(nTiles);
+
+  AliInfo(Form("%s: grid of %d x %d tiles of %.3f x %.3f in eta x phi", GetName(), fNTilesEta, fNTilesPhi, fTileEta, fTilePhi));
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskRhoGrid::ExcludeLeadingJets()
+{
+  // Exclude the tiles whose centre is within the radius of one of the leading jets.
+
+  std::fill(fTileExcluded.begin(), fTileExcluded.end(), kFALSE);
+
+  AliJetContainer *jets = GetJetContainer(0);
+  if (fNExclLeadJets == 0 || !jets)
+    return;
+
+  std::vector<std::pair<Double_t, AliEmcalJet*> > leadJets;
+  AliJetIterableContainer itcont = jets->accepted();
+  for (AliJetIterableContainer::iterator it = itcont.begin(); it != itcont.end(); it++) {
+    leadJets.push_back(std::make_pair((*it)->Pt(), *it));
+  }
+  const UInt_t nExcl = TMath::Min(fNExclLeadJets, (UInt_t)leadJets.size());
+  std::partial_sort(leadJets.begin(), leadJets.begin() + nExcl, leadJets.end(), std::greater<std::pair<Double_t, AliEmcalJet*> >());
+
+  const Double_t r2 = jets->GetJetRadius() * jets->GetJetRadius();
+  for (UInt_t ij = 0; ij < nExcl; ij++) {
+    AliEmcalJet *jet = leadJets[ij].second;
+    for (Int_t ieta = 0; ieta < fNTilesEta; ieta++) {
+      Double_t deta = fGridEtaMin + (ieta + 0.5) * fTileEta - jet->Eta();
+      for (Int_t iphi = 0; iphi < fNTilesPhi; iphi++) {
+        Double_t dphi = TVector2::Phi_mpi_pi(fGridPhiMin + (iphi + 0.5) * fTilePhi - jet->Phi());
+        if (deta * deta + dphi * dphi < r2) fTileExcluded[ieta * fNTilesPhi + iphi] = kTRUE;
+      }
+    }
+  }
+}
+
+//________________________________________________________________________
+Double_t AliAnalysisTaskRhoGrid::GetMedian(const std::vector<Double_t> &tileVal) const
+{
+  // Median of tileVal / tile area over the tiles not excluded by the leading jets.
+  // With the occupancy correction, the median over the occupied tiles times the occupancy.
+
+  std::vector<Double_t> &values = fMedianValues;
+  values.clear();
+
+  Int_t nUsed = 0;
+  const Int_t nTiles = tileVal.size();
+  for (Int_t i = 0; i < nTiles; i++) {
+    if (fTileExcluded[i])
+      continue;
+    nUsed++;
+    if (fOccupancyCorr && fTileNPart[i] == 0)
+      continue;
+    values.push_back(tileVal[i] / (fTileEta * fTilePhi));
+  }
+
+  if (values.empty())
+    return 0;
+
+  Double_t median = TMath::Median(values.size(), &values[0]);
+  if (fOccupancyCorr)
+    median *= Double_t(values.size()) / nUsed;
+
+  return median;
+}
+
+//________________________________________________________________________
+Bool_t AliAnalysisTaskRhoGrid::Run()
+{
+  // Run the analysis.
+
+  fOutRho->SetVal(0);
+  if (fOutRhoScaled)
+    fOutRhoScaled->SetVal(0);
+  if (fOutRhoMass)
+    fOutRhoMass->SetVal(0);
+  fOccupancy = 0;
+
+  if (fTilePt.empty())
+    return kFALSE;
+
+  std::fill(fTilePt.begin(), fTilePt.end(), 0.);
+  std::fill(fTileMtMinusPt.begin(), fTileMtMinusPt.end(), 0.);
+  std::fill(fTileNPart.begin(), fTileNPart.end(), 0);
+
+  ExcludeLeadingJets();
+
+  // fill the tiles with the accepted particles and clusters
+  AliParticleContainer *partCont = 0;
+  TIter nextPartCont(&fParticleCollArray);
+  while ((partCont = static_cast<AliParticleContainer*>(nextPartCont()))) {
+    AliParticleIterableMomentumContainer itcont = partCont->accepted_momentum();
+    for (AliParticleIterableMomentumContainer::iterator it = itcont.begin(); it != itcont.end(); it++) {
+      Int_t ieta = TMath::FloorNint((it->first.Eta() - fGridEtaMin) / fTileEta);
+      Int_t iphi = TMath::FloorNint((it->first.Phi_0_2pi() - fGridPhiMin) / fTilePhi);
+      if (ieta < 0 || ieta >= fNTilesEta || iphi < 0 || iphi >= fNTilesPhi)
+        continue;
+      Int_t itile = ieta * fNTilesPhi + iphi;
+      fTilePt[itile] += it->first.Pt();
+      fTileMtMinusPt[itile] += it->first.Mt() - it->first.Pt();
+      fTileNPart[itile]++;
+    }
+  }
+
+  AliClusterContainer *clusCont = 0;
+  TIter nextClusCont(&fClusterCollArray);
+  while ((clusCont = static_cast<AliClusterContainer*>(nextClusCont()))) {
+    AliClusterIterableMomentumContainer itcont = clusCont->accepted_momentum();
+    for (AliClusterIterableMomentumContainer::iterator it = itcont.begin(); it != itcont.end(); it++) {
+      Int_t ieta = TMath::FloorNint((it->first.Eta() - fGridEtaMin) / fTileEta);
+      Int_t iphi = TMath::FloorNint((it->first.Phi_0_2pi() - fGridPhiMin) / fTilePhi);
+      if (ieta < 0 || ieta >= fNTilesEta || iphi < 0 || iphi >= fNTilesPhi)
+        continue;
+      Int_t itile = ieta * fNTilesPhi + iphi;
+      fTilePt[itile] += it->first.Pt();
+      fTileMtMinusPt[itile] += it->first.Mt() - it->first.Pt();
+      fTileNPart[itile]++;
+    }
+  }
+
+  Int_t nUsed = 0, nOccupied = 0;
+  for (UInt_t i = 0; i < fTilePt.size(); i++) {
+    if (fTileExcluded[i])
+      continue;
+    nUsed++;
+    if (fTileNPart[i] > 0)
+      nOccupied++;
+  }
+  if (nUsed > 0)
+    fOccupancy = Double_t(nOccupied) / nUsed;
+
+  Double_t rho = GetMedian(fTilePt);
+  fOutRho->SetVal(rho);
+
+  if (fOutRhoScaled) {
+    Double_t rhoScaled = rho * GetScaleFactor(fCent);
+    fOutRhoScaled->SetVal(rhoScaled);
+  }
+
+  if (fOutRhoMass)
+    fOutRhoMass->SetVal(GetMedian(fTileMtMinusPt));
+
+  return kTRUE;
+}
+
+//________________________________________________________________________
+Bool_t AliAnalysisTaskRhoGrid::FillHistograms()
+{
+  // Fill histograms.
+
+  AliAnalysisTaskRhoBase::FillHistograms();
+
+  fHistOccupancyvsCent->Fill(fCent, fOccupancy);
+
+  if (fHistRhoMassvsCent && fOutRhoMass)
+    fHistRhoMassvsCent->Fill(fCent, fOutRhoMass->GetVal());
+
+  if (fHistRhovsCompareRho && fCompareRho)
+    fHistRhovsCompareRho->Fill(fCompareRho->GetVal(), fOutRho->GetVal());
+
+  if (fHistDeltaRhovsCent && fCompareRho)
+    fHistDeltaRhovsCent->Fill(fCent, fOutRho->GetVal() - fCompareRho->GetVal());
+
+  return kTRUE;
+}
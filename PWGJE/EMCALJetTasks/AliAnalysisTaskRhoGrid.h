@@ -0,0 +1,67 @@
+#ifndef ALIANALYSISTASKRHOGRID_H
+#define ALIANALYSISTASKRHOGRID_H
+
+// $Id$
+
+class TH2F;
+class AliRhoParameter;
+
+#include <vector>
+
+#include "AliAnalysisTaskRhoBase.h"
+
+class AliAnalysisTaskRhoGrid : public AliAnalysisTaskRhoBase {
+
+ public:
+  AliAnalysisTaskRhoGrid();
+  AliAnalysisTaskRhoGrid(const char *name, Bool_t histo=kFALSE);
+  virtual ~AliAnalysisTaskRhoGrid() {}
+
+  void             UserCreateOutputObjects();
+
+  void             SetTileSize(Double_t deta, Double_t dphi)  { fTileSizeEta    = deta ; fTileSizePhi = dphi; }
+  void             SetExcludeLeadJets(UInt_t n)               { fNExclLeadJets  = n    ; }
+  void             SetOccupancyCorrection(Bool_t b=kTRUE)     { fOccupancyCorr  = b    ; }
+  void             SetOutRhoMassName(const char *name)        { fOutRhoMassName = name ; }
+
+  const char*      GetOutRhoMassName() const                  { return fOutRhoMassName.Data(); }
+
+ protected:
+  void             ExecOnce();
+  Bool_t           Run();
+  Bool_t           FillHistograms();
+
+  void             ExcludeLeadingJets();
+  Double_t         GetMedian(const std::vector<Double_t> &tileVal) const;
+
+  Double_t               fTileSizeEta          ;// requested tile size in eta (adjusted to fit the grid)
+  Double_t               fTileSizePhi          ;// requested tile size in phi (adjusted to fit the grid)
+  UInt_t                 fNExclLeadJets        ;// number of leading jets whose tiles are excluded from the median calculation
+  Bool_t                 fOccupancyCorr        ;// median over the occupied tiles scaled by the occupancy, instead of the median over all tiles
+  TString                fOutRhoMassName       ;// name of the output rho mass object (rho mass not calculated if empty)
+
+  Int_t                  fNTilesEta            ;//!number of tiles in eta
+  Int_t                  fNTilesPhi            ;//!number of tiles in phi
+  Double_t               fGridEtaMin           ;//!lower eta edge of the grid
+  Double_t               fGridPhiMin           ;//!lower phi edge of the grid
+  Double_t               fTileEta              ;//!tile size in eta
+  Double_t               fTilePhi              ;//!tile size in phi
+  Double_t               fOccupancy            ;//!fraction of the used tiles with at least one particle
+  std::vector<Double_t>  fTilePt               ;//!sum of the particle pt in each tile
+  std::vector<Double_t>  fTileMtMinusPt        ;//!sum of the particle mt - pt in each tile
+  std::vector<Int_t>     fTileNPart            ;//!number of particles in each tile
+  std::vector<Bool_t>    fTileExcluded         ;//!tile excluded by a leading jet
+  mutable std::vector<Double_t> fMedianValues  ;//!tile values entering the median (kept between events)
+  AliRhoParameter       *fOutRhoMass           ;//!output rho mass object
+
+  TH2F                  *fHistOccupancyvsCent  ;//!occupancy vs. centrality
+  TH2F                  *fHistRhoMassvsCent    ;//!rho mass vs. centrality
+  TH2F                  *fHistRhovsCompareRho  ;//!rho vs. rho to compare
+  TH2F                  *fHistDeltaRhovsCent   ;//!rho - rho to compare vs. centrality
+
+  AliAnalysisTaskRhoGrid(const AliAnalysisTaskRhoGrid&);             // not implemented
+  AliAnalysisTaskRhoGrid& operator=(const AliAnalysisTaskRhoGrid&);  // not implemented
+
+  ClassDef(AliAnalysisTaskRhoGrid, 2); // Rho task, median of a grid of tiles
+};
+#endif
@@ -15,6 +15,7 @@
 
 #include <vector>
 
+#include <TBufferFile.h>
 #include <TClonesArray.h>
 #include <TMath.h>
 #include <TRandom3.h>
@@ -50,6 +51,63 @@ ClassImp(AliEmcalJetTask);
 
 const Int_t AliEmcalJetTask::fgkConstIndexShift = 100000;
 
+namespace {
+
+/**
+ * @struct AliEmcalJetTaskInput
+ * @brief Input vectors of the jet finders with the same input containers
+ */
+struct AliEmcalJetTaskInput {
+  TString                          fKey;       ///< configuration and arrays of the input containers
+  std::vector<fastjet::PseudoJet>  fVectors;   ///< input vectors, with the constituent index as user index
+};
+
+/**
+ * @struct AliEmcalJetTaskSharedInputs
+ * @brief Input vectors built by the jet finders in the current event
+ */
+struct AliEmcalJetTaskSharedInputs {
+  AliEmcalJetTaskSharedInputs() : fEntry(-1), fEvent(0), fInputs() {}
+
+  Long64_t                           fEntry;   ///< analysis manager entry of the event
+  const AliVEvent                   *fEvent;   ///< input event
+  std::vector<AliEmcalJetTaskInput>  fInputs;  ///< input vectors of the event
+};
+
+AliEmcalJetTaskSharedInputs gSharedInputs;
+
+/**
+ * Input vectors shared between the jet finders of the current event.
+ * The inputs of the previous event are dropped when the event changes.
+ * @param event Input event
+ * @return Input vectors of the current event
+ */
+std::vector<AliEmcalJetTaskInput> &SharedInputs(const AliVEvent *event)
+{
+  AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+  Long64_t entry = mgr ? mgr->GetCurrentEntry() : -1;
+  if (entry != gSharedInputs.fEntry || event != gSharedInputs.fEvent) {
+    gSharedInputs.fEntry = entry;
+    gSharedInputs.fEvent = event;
+    gSharedInputs.fInputs.clear();
+  }
+  return gSharedInputs.fInputs;
+}
+
+/**
+ * Append the array and the number of entries of the input containers to the key.
+ * @param key Key of the input vectors
+ * @param containers Input containers
+ */
+void AppendArrays(TString &key, const TObjArray &containers)
+{
+  TIter next(&containers);
+  AliEmcalContainer *cont = 0;
+  while ((cont = static_cast<AliEmcalContainer*>(next()))) key += Form(";%p:%d", static_cast<void*>(cont->GetArray()), cont->GetNEntries());
+}
+
+}
+
 /**
  * Default constructor. This constructor is only for ROOT I/O and
  * not to be used by users.
@@ -79,6 +137,8 @@ AliEmcalJetTask::AliEmcalJetTask() :
   fIsEmcPart(0),
   fLegacyMode(kFALSE),
   fFillGhost(kFALSE),
+  fShareInput(kTRUE),
+  fInputKey(),
   fJets(0),
   fFastJetWrapper("AliEmcalJetTask","AliEmcalJetTask"),
   fClusterContainerIndexMap(),
@@ -115,6 +175,8 @@ AliEmcalJetTask::AliEmcalJetTask(const char *name) :
   fIsEmcPart(0),
   fLegacyMode(kFALSE),
   fFillGhost(kFALSE),
+  fShareInput(kTRUE),
+  fInputKey(),
   fJets(0),
   fFastJetWrapper(name,name),
   fClusterContainerIndexMap(),
@@ -237,6 +299,49 @@ Int_t AliEmcalJetTask::FindJets()
 
   AliDebug(2,Form("Jet type = %d", fJetType));
 
+  // The input vectors do not depend on the jet definition: jet finders with the same
+  // input containers use the vectors built by the first of them in the event
+  if (fShareInput && fTrackEfficiency >= 1.) {
+    if (fInputKey.IsNull()) fInputKey = GetInputKey();
+    TString key(fInputKey);
+    AppendArrays(key, fParticleCollArray);
+    AppendArrays(key, fClusterCollArray);
+
+    std::vector<AliEmcalJetTaskInput> &inputs = SharedInputs(InputEvent());
+    std::vector<AliEmcalJetTaskInput>::const_iterator input = inputs.begin();
+    while (input != inputs.end() && input->fKey != key) ++input;
+    if (input != inputs.end()) {
+      AliDebug(2,Form("Using %d input vectors shared with another jet finder", (Int_t)input->fVectors.size()));
+      for (std::vector<fastjet::PseudoJet>::const_iterator vec = input->fVectors.begin(); vec != input->fVectors.end(); ++vec) {
+        fFastJetWrapper.AddInputVector(vec->px(), vec->py(), vec->pz(), vec->E(), vec->user_index());
+      }
+    }
+    else {
+      AddInputVectors();
+      AliEmcalJetTaskInput newInput;
+      newInput.fKey = key;
+      newInput.fVectors = fFastJetWrapper.GetInputVectors();
+      inputs.push_back(newInput);
+    }
+  }
+  else {
+    AddInputVectors();
+  }
+
+  if (fFastJetWrapper.GetInputVectors().size() == 0) return 0;
+
+  // run jet finder
+  fFastJetWrapper.Run();
+
+  return fFastJetWrapper.GetInclusiveJets().size();
+}
+
+/**
+ * Loops over all particle and cluster containers and adds the accepted
+ * objects (tracks, particles, clusters) as input vectors to the FastJet wrapper.
+ */
+void AliEmcalJetTask::AddInputVectors()
+{
   Int_t iColl = 1;
   TIter nextPartColl(&fParticleCollArray);
   AliParticleContainer* tracks = 0;
@@ -275,13 +380,19 @@ Int_t AliEmcalJetTask::FindJets()
     }
     iColl++;
   }
+}
 
-  if (fFastJetWrapper.GetInputVectors().size() == 0) return 0;
-
-  // run jet finder
-  fFastJetWrapper.Run();
-
-  return fFastJetWrapper.GetInclusiveJets().size();
+/**
+ * Configuration of the input containers, streamed in a buffer: jet finders
+ * with the same key build the same input vectors from the same arrays.
+ * @return Key of the input containers
+ */
+TString AliEmcalJetTask::GetInputKey() const
+{
+  TBufferFile buffer(TBuffer::kWrite);
+  buffer.WriteObject(&fParticleCollArray);
+  buffer.WriteObject(&fClusterCollArray);
+  return TString(buffer.Buffer(), buffer.Length());
 }
 
 /**
@@ -1071,6 +1182,9 @@ AliEmcalJetTask* AliEmcalJetTask::AddTaskEmcalJet(
   jetTask->SetJetAlgo(jetAlgo);
   jetTask->SetRecombScheme(reco);
   jetTask->SetRadius(radius);
+  // the jet finder does not modify its input objects: the selection is evaluated once per event
+  if (partCont) partCont->SetUseAcceptCache();
+  if (clusCont) clusCont->SetUseAcceptCache();
   if (partCont) jetTask->AdoptParticleContainer(partCont);
   if (clusCont) jetTask->AdoptClusterContainer(clusCont);
   jetTask->SetJetsName(tag);
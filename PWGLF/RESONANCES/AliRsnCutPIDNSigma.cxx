@@ -17,6 +17,7 @@
 //
 
 #include "AliPIDResponse.h"
+#include "AliPIDnSigmaCache.h"
 #include "AliESDpid.h"
 #include "AliAODpidUtil.h"
 
@@ -33,7 +34,8 @@ AliRsnCutPIDNSigma::AliRsnCutPIDNSigma() :
    fTrackNSigma(0.0),
    fTrackMom(0.0),
    fMyPID(0x0),
-   fRanges("AliRsnPIDRange", 0)
+   fRanges("AliRsnPIDRange", 0),
+   fUseNSigmaCache(kFALSE)
 {
 //
 // Main constructor.
@@ -50,7 +52,8 @@ AliRsnCutPIDNSigma::AliRsnCutPIDNSigma
    fTrackNSigma(0.0),
    fTrackMom(0.0),
    fMyPID(0x0),
-   fRanges("AliRsnPIDRange", 0)
+   fRanges("AliRsnPIDRange", 0),
+   fUseNSigmaCache(kFALSE)
 {
 //
 // Main constructor.
@@ -67,7 +70,8 @@ AliRsnCutPIDNSigma::AliRsnCutPIDNSigma
    fTrackNSigma(0.0),
    fTrackMom(0.0),
    fMyPID(copy.fMyPID),
-   fRanges(copy.fRanges)
+   fRanges(copy.fRanges),
+   fUseNSigmaCache(copy.fUseNSigmaCache)
 {
 //
 // Copy constructor.
@@ -89,6 +93,7 @@ AliRsnCutPIDNSigma &AliRsnCutPIDNSigma::operator=(const AliRsnCutPIDNSigma &copy
    fRejectUnmatched = copy.fRejectUnmatched;
    fMyPID = copy.fMyPID;
    fRanges = copy.fRanges;
+   fUseNSigmaCache = copy.fUseNSigmaCache;
 
    return (*this);
 }
@@ -153,13 +158,13 @@ Bool_t AliRsnCutPIDNSigma::IsSelected(TObject *object)
    // get number of sigmas
    switch (fDetector) {
       case kITS:
-         fTrackNSigma = TMath::Abs(pid->NumberOfSigmasITS(vtrack, fSpecies));
+         fTrackNSigma = TMath::Abs(fUseNSigmaCache ? AliPIDnSigmaCache::NumberOfSigmas(pid, AliPIDResponse::kITS, vtrack, fSpecies) : pid->NumberOfSigmasITS(vtrack, fSpecies));
          break;
       case kTPC:
-         fTrackNSigma = TMath::Abs(pid->NumberOfSigmasTPC(vtrack, fSpecies));
+         fTrackNSigma = TMath::Abs(fUseNSigmaCache ? AliPIDnSigmaCache::NumberOfSigmas(pid, AliPIDResponse::kTPC, vtrack, fSpecies) : pid->NumberOfSigmasTPC(vtrack, fSpecies));
          break;
       case kTOF:
-         fTrackNSigma = TMath::Abs(pid->NumberOfSigmasTOF(vtrack, fSpecies));
+         fTrackNSigma = TMath::Abs(fUseNSigmaCache ? AliPIDnSigmaCache::NumberOfSigmas(pid, AliPIDResponse::kTOF, vtrack, fSpecies) : pid->NumberOfSigmasTOF(vtrack, fSpecies));
          break;
       default:
          AliError("Bad detector chosen. Rejecting track");
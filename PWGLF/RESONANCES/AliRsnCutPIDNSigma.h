@@ -41,6 +41,7 @@ public:
    void             SetSpecies(AliPID::EParticleType type)        {fSpecies = type;}
    void             SetDetector(EDetector det)                    {fDetector = det;}
    void             SetRejectUnmatched(Bool_t yn = kTRUE)         {fRejectUnmatched = yn;}
+   void             SetUseNSigmaCache(Bool_t yn = kTRUE)          {fUseNSigmaCache = yn;}
 
    AliPIDResponse  *MyPID()                                       {return fMyPID;}
    void             InitMyPID(Bool_t isMC, Bool_t isESD);
@@ -65,8 +66,9 @@ private:
    Double_t                fTrackMom;        //! track reference momentum
    AliPIDResponse         *fMyPID;           //  PID response object to be configured manyally
    TClonesArray            fRanges;          //  collection of ranges
+   Bool_t                  fUseNSigmaCache;  //  take number of sigmas from AliPIDnSigmaCache (same values, computed once per event)
 
-   ClassDef(AliRsnCutPIDNSigma, 1)
+   ClassDef(AliRsnCutPIDNSigma, 2)
 };
 
 #endif
@@ -14,6 +14,9 @@
 //
 
 #include <Riostream.h>
+#include <algorithm>
+#include <map>
+#include <set>
 
 #include <TH1.h>
 #include <TList.h>
@@ -51,6 +54,33 @@
 
 ClassImp(AliRsnMiniAnalysisTask)
 
+namespace {
+   // cell of the mixing variables (vz, multiplicity, angle) of an event
+   struct RsnMixCell {
+      Long64_t fIdx[3];
+      bool operator<(const RsnMixCell &other) const
+      {
+         for (Int_t i = 0; i < 3; i++) if (fIdx[i] != other.fIdx[i]) return fIdx[i] < other.fIdx[i];
+         return false;
+      }
+   };
+
+   // events of a mixing cell not yet mixed the required number of times,
+   // visited in the order ievt+1, ievt+2, ... (restarting from 0) for an event ievt
+   struct RsnMixCursor {
+      std::set<Int_t>           *fEvents;
+      std::set<Int_t>::iterator  fNext;
+      Bool_t                     fWrapped;
+   };
+
+   TString RsnMatchList(const std::vector<Int_t> &matched)
+   {
+      TString list("|");
+      for (UInt_t i = 0; i < matched.size(); i++) list.Append(Form("%d|", matched[i]));
+      return list;
+   }
+}
+
 //__________________________________________________________________________________________________
 AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask() :
    AliAnalysisTaskSE(),
@@ -494,7 +524,7 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
    // prepare variables
    Int_t ievt, nEvents = (Int_t)fEvBuffer->GetEntries();
    Int_t idef, nDefs   = fHistograms.GetEntries();
-   Int_t imix, iloop, ifill;
+   Int_t imix, ifill;
    AliRsnMiniOutput *def = 0x0;
    AliRsnMiniOutput::EComputation compType;
 
@@ -505,6 +535,9 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
       else printNum = 0;
    }
 
+   // mixing variables of all events, kept for the search of mixing partners
+   std::vector<Float_t> mixVz(nEvents), mixMult(nEvents), mixAngle(nEvents);
+
    // loop on events, and for each one fill all outputs
    // using the appropriate procedure depending on its type
    // only mother-related histograms are filled in UserExec,
@@ -513,6 +546,9 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
    for (ievt = 0; ievt < nEvents; ievt++) {
       // get next entry
       fEvBuffer->GetEntry(ievt);
+      mixVz[ievt]    = fMiniEvent->Vz();
+      mixMult[ievt]  = fMiniEvent->Mult();
+      mixAngle[ievt] = fMiniEvent->Angle();
       if (printNum&&(ievt%printNum==0)) {
          AliInfo(Form("[%s] Std.Event %d/%d",GetName(), ievt,nEvents));
          timer.Stop(); timer.Print(); fflush(stdout); timer.Start(kFALSE);
@@ -562,66 +598,32 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
       return;
    }
 
-   // initialize mixing counter
-   Int_t    nmatched[nEvents];
-   TString *smatched = new TString[nEvents];
-   for (ievt = 0; ievt < nEvents; ievt++) {
-      smatched[ievt] = "|";
-      nmatched[ievt] = 0;
-   }
-
+   // mixing partners: matched[ievt] are the events mixed with ievt,
+   // nmatched[ievt] counts the mixings of ievt in both directions
+   std::vector<Int_t> nmatched(nEvents, 0);
+   std::vector< std::vector<Int_t> > matched(nEvents);
 
    AliInfo(Form("[%s] Std.Event %d/%d",GetName(), nEvents,nEvents));
    timer.Stop(); timer.Print(); timer.Start(); fflush(stdout);
 
    // search for good matchings
-   for (ievt = 0; ievt < nEvents; ievt++) {
-      if (printNum&&(ievt%printNum==0)) {
-         AliInfo(Form("[%s] EventMixing searching %d/%d",GetName(),ievt,nEvents));
-         timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
-      }
-      if (nmatched[ievt] >= fNMix) continue;
-      fEvBuffer->GetEntry(ievt);
-      AliRsnMiniEvent evMain(*fMiniEvent);
-      for (iloop = 1; iloop < nEvents; iloop++) {
-         imix = ievt + iloop;
-         if (imix >= nEvents) imix -= nEvents;
-         if (imix == ievt) continue;
-         // text next entry
-         fEvBuffer->GetEntry(imix);
-         // skip if events are not matched
-         if (!EventsMatch(&evMain, fMiniEvent)) continue;
-         // check that the array of good matches for mixed does not already contain main event
-         if (smatched[imix].Contains(Form("|%d|", ievt))) continue;
-         // check that the found good events has not enough matches already
-         if (nmatched[imix] >= fNMix) continue;
-         // add new mixing candidate
-         smatched[ievt].Append(Form("%d|", imix));
-         nmatched[ievt]++;
-         nmatched[imix]++;
-         if (nmatched[ievt] >= fNMix) break;
-      }
-      AliDebugClass(1, Form("Matches for event %5d = %d [%s] (missing are declared above)", evMain.ID(), nmatched[ievt], smatched[ievt].Data()));
-   }
+   FindMixingMatches(mixVz, mixMult, mixAngle, nmatched, matched);
 
    AliInfo(Form("[%s] EventMixing searching %d/%d",GetName(),nEvents,nEvents));
    timer.Stop(); timer.Print(); fflush(stdout); timer.Start();
 
    // perform mixing
-   TObjArray *list = 0x0;
-   TObjString *os = 0x0;
    for (ievt = 0; ievt < nEvents; ievt++) {
       if (printNum&&(ievt%printNum==0)) {
          AliInfo(Form("[%s] EventMixing %d/%d",GetName(),ievt,nEvents));
          timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
       }
+      if (matched[ievt].empty()) continue;
       ifill = 0;
       fEvBuffer->GetEntry(ievt);
       AliRsnMiniEvent evMain(*fMiniEvent);
-      list = smatched[ievt].Tokenize("|");
-      TObjArrayIter next(list);
-      while ( (os = (TObjString *)next()) ) {
-         imix = os->GetString().Atoi();
+      for (UInt_t im = 0; im < matched[ievt].size(); im++) {
+         imix = matched[ievt][im];
          fEvBuffer->GetEntry(imix);
          for (idef = 0; idef < nDefs; idef++) {
             def = (AliRsnMiniOutput *)fHistograms[idef];
@@ -634,11 +636,8 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
             }
          }
       }
-      delete list;
    }
 
-   delete [] smatched;
-
    AliInfo(Form("[%s] EventMixing %d/%d",GetName(),nEvents,nEvents));
    timer.Stop(); timer.Print(); fflush(stdout);
 
@@ -1459,13 +1458,23 @@ Bool_t AliRsnMiniAnalysisTask::EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEv
 //
 
    if (!event1 || !event2) return kFALSE;
+   return EventsMatch(event1->Vz(), event1->Mult(), event1->Angle(), event2->Vz(), event2->Mult(), event2->Angle());
+}
+
+//__________________________________________________________________________________________________
+Bool_t AliRsnMiniAnalysisTask::EventsMatch(Float_t vz1, Float_t mult1, Float_t angle1, Float_t vz2, Float_t mult2, Float_t angle2) const
+{
+//
+// Check if two events with the given mixing variables are compatible (see above).
+//
+
    Int_t ivz1, ivz2, imult1, imult2, iangle1, iangle2;
    Double_t dv, dm, da;
 
    if (fContinuousMix) {
-      dv = TMath::Abs(event1->Vz()    - event2->Vz()   );
-      dm = TMath::Abs(event1->Mult()  - event2->Mult() );
-      da = TMath::Abs(event1->Angle() - event2->Angle());
+      dv = TMath::Abs(vz1    - vz2   );
+      dm = TMath::Abs(mult1  - mult2 );
+      da = TMath::Abs(angle1 - angle2);
       if (dv > fMaxDiffVz) {
          //AliDebugClass(2, Form("Events #%4d and #%4d don't match due to a too large diff in Vz = %f", event1->ID(), event2->ID(), dv));
          return kFALSE;
@@ -1480,12 +1489,12 @@ Bool_t AliRsnMiniAnalysisTask::EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEv
       }
       return kTRUE;
    } else {
-      ivz1 = (Int_t)(event1->Vz() / fMaxDiffVz);
-      ivz2 = (Int_t)(event2->Vz() / fMaxDiffVz);
-      imult1 = (Int_t)(event1->Mult() / fMaxDiffMult);
-      imult2 = (Int_t)(event2->Mult() / fMaxDiffMult);
-      iangle1 = (Int_t)(event1->Angle() / fMaxDiffAngle);
-      iangle2 = (Int_t)(event2->Angle() / fMaxDiffAngle);
+      ivz1 = (Int_t)(vz1 / fMaxDiffVz);
+      ivz2 = (Int_t)(vz2 / fMaxDiffVz);
+      imult1 = (Int_t)(mult1 / fMaxDiffMult);
+      imult2 = (Int_t)(mult2 / fMaxDiffMult);
+      iangle1 = (Int_t)(angle1 / fMaxDiffAngle);
+      iangle2 = (Int_t)(angle2 / fMaxDiffAngle);
       if (ivz1 != ivz2) return kFALSE;
       if (imult1 != imult2) return kFALSE;
       if (iangle1 != iangle2) return kFALSE;
@@ -1493,6 +1502,127 @@ Bool_t AliRsnMiniAnalysisTask::EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEv
    }
 }
 
+//__________________________________________________________________________________________________
+void AliRsnMiniAnalysisTask::FindMixingMatches(const std::vector<Float_t> &vz, const std::vector<Float_t> &mult, const std::vector<Float_t> &angle,
+                                               std::vector<Int_t> &nmatched, std::vector< std::vector<Int_t> > &matched) const
+{
+//
+// Search of the mixing partners of all events, from their mixing variables.
+// The result is the one of a scan of the events ievt+1, ievt+2, ... (restarting
+// from 0) for each event ievt with less than fNMix mixings: an event is added
+// to the partners of ievt if it matches ievt, has not ievt among its own
+// partners and has less than fNMix mixings, until ievt has fNMix mixings.
+// Instead of all events, only the events in the cells of the mixing variables
+// which can match ievt are scanned: the bin of ievt in binned mixing, the
+// cells of size 2*maxdiff next to the one of ievt in continuous mixing.
+// Events with fNMix mixings are removed from the cells.
+//
+
+   Int_t nEvents = vz.size();
+   const std::vector<Float_t> *values[3] = {&vz, &mult, &angle};
+   Double_t maxDiff[3] = {fMaxDiffVz, fMaxDiffMult, fMaxDiffAngle};
+   Int_t range = (fContinuousMix ? 1 : 0);
+
+   // continuous mixing: a variable which can not be binned (window not positive
+   // or not finite, value not finite or too large) is not used for the cells
+   Bool_t useCells[3];
+   for (Int_t iv = 0; iv < 3; iv++) {
+      useCells[iv] = kTRUE;
+      if (!fContinuousMix) continue;
+      useCells[iv] = (maxDiff[iv] > 0. && TMath::Finite(maxDiff[iv]));
+      for (Int_t ievt = 0; useCells[iv] && ievt < nEvents; ievt++) {
+         Double_t x = (*values[iv])[ievt] / (2. * maxDiff[iv]);
+         if (!TMath::Finite(x) || TMath::Abs(x) > 1E15) useCells[iv] = kFALSE;
+      }
+   }
+
+   // fill the cells
+   std::map<RsnMixCell, std::set<Int_t> > cells;
+   std::vector<RsnMixCell> cellOf(nEvents);
+   std::vector< std::set<Int_t>* > eventsOf(nEvents);
+   for (Int_t ievt = 0; ievt < nEvents; ievt++) {
+      for (Int_t iv = 0; iv < 3; iv++) {
+         if (!fContinuousMix)
+            cellOf[ievt].fIdx[iv] = (Int_t)((*values[iv])[ievt] / maxDiff[iv]); // same bin as in EventsMatch
+         else if (useCells[iv])
+            cellOf[ievt].fIdx[iv] = (Long64_t)TMath::Floor((*values[iv])[ievt] / (2. * maxDiff[iv]));
+         else
+            cellOf[ievt].fIdx[iv] = 0;
+      }
+      eventsOf[ievt] = &cells[cellOf[ievt]];
+      eventsOf[ievt]->insert(ievt);
+   }
+
+   std::vector<RsnMixCursor> cursors;
+   for (Int_t ievt = 0; ievt < nEvents; ievt++) {
+      if (nmatched[ievt] >= fNMix) continue;
+
+      // cells which can contain events matching ievt
+      cursors.clear();
+      RsnMixCell cell;
+      for (Int_t i0 = -range; i0 <= range; i0++) {
+         for (Int_t i1 = -range; i1 <= range; i1++) {
+            for (Int_t i2 = -range; i2 <= range; i2++) {
+               Int_t shift[3] = {i0, i1, i2};
+               Bool_t skip = kFALSE;
+               for (Int_t iv = 0; iv < 3; iv++) {
+                  if (shift[iv] != 0 && !useCells[iv]) skip = kTRUE;
+                  cell.fIdx[iv] = cellOf[ievt].fIdx[iv] + shift[iv];
+               }
+               if (skip) continue;
+               std::map<RsnMixCell, std::set<Int_t> >::iterator found = cells.find(cell);
+               if (found == cells.end() || found->second.empty()) continue;
+               RsnMixCursor cursor;
+               cursor.fEvents  = &found->second;
+               cursor.fNext    = found->second.upper_bound(ievt);
+               cursor.fWrapped = kFALSE;
+               cursors.push_back(cursor);
+            }
+         }
+      }
+
+      // scan the events of these cells in the order ievt+1, ievt+2, ...
+      while (kTRUE) {
+         Int_t ibest = -1;
+         Long64_t best = nEvents;
+         for (UInt_t ic = 0; ic < cursors.size(); ic++) {
+            RsnMixCursor &cursor = cursors[ic];
+            if (!cursor.fWrapped && cursor.fNext == cursor.fEvents->end()) {
+               cursor.fNext    = cursor.fEvents->begin();
+               cursor.fWrapped = kTRUE;
+            }
+            if (cursor.fNext == cursor.fEvents->end()) continue;
+            Int_t icand = *cursor.fNext;
+            if (cursor.fWrapped && icand >= ievt) continue;
+            Long64_t order = (cursor.fWrapped ? icand + nEvents : icand) - ievt;
+            if (order < best) {
+               best  = order;
+               ibest = ic;
+            }
+         }
+         if (ibest < 0) break;
+         std::set<Int_t>::iterator current = cursors[ibest].fNext++;
+         Int_t imix = *current;
+         // skip if events are not matched
+         if (!EventsMatch(vz[ievt], mult[ievt], angle[ievt], vz[imix], mult[imix], angle[imix])) continue;
+         // check that the array of good matches for mixed does not already contain main event
+         if (std::find(matched[imix].begin(), matched[imix].end(), ievt) != matched[imix].end()) continue;
+         // check that the found good events has not enough matches already
+         if (nmatched[imix] >= fNMix) continue;
+         // add new mixing candidate
+         matched[ievt].push_back(imix);
+         nmatched[ievt]++;
+         nmatched[imix]++;
+         if (nmatched[imix] >= fNMix) cursors[ibest].fEvents->erase(current);
+         if (nmatched[ievt] >= fNMix) {
+            eventsOf[ievt]->erase(ievt);
+            break;
+         }
+      }
+      AliDebugClass(1, Form("Matches for event %5d = %d [%s] (missing are declared above)", ievt, nmatched[ievt], RsnMatchList(matched[ievt]).Data()));
+   }
+}
+
 //---------------------------------------------------------------------
 Double_t AliRsnMiniAnalysisTask::ApplyCentralityPatchPbPb2011(){
   //This part rejects randomly events such that the centrality gets flat for LHC11h Pb-Pb data
@@ -123,6 +123,37 @@ class AliAODv0;
 using std::cout;
 using std::endl;
 
+//Superlight mode: rows of the compiled cut arrays (one row per cut variable,
+//one column per configuration), see CompileV0Configurations and CompileCascadeConfigurations
+namespace {
+    enum EV0CutVariable {
+        kV0CutHypothesis = 0, kV0CutOnTheFly,
+        kV0CutMinEtaTracks, kV0CutMaxEtaTracks, kV0CutMinRapidity, kV0CutMaxRapidity,
+        kV0CutV0Radius, kV0CutMaxV0Radius, kV0CutDCANegToPV, kV0CutDCAPosToPV, kV0CutDCAV0Daughters,
+        kV0CutV0CosPA, kV0CutUseVarV0CosPA, kV0CutVarV0CosPAPar0, kV0CutVarV0CosPAPar4 = kV0CutVarV0CosPAPar0+4,
+        kV0CutProperLifetime, kV0CutLeastNumberOfCrossedRows, kV0CutLeastNumberOfCrossedRowsOverFindable,
+        kV0CutMinBaryonMomentum, kV0CutTPCdEdx, kV0CutArmenteros, kV0CutArmenterosParameter,
+        kV0CutUseITSRefitTracks, kV0CutMaxChi2PerCluster, kV0CutMinTrackLength, kV0Cut276TeVLikedEdx,
+        kNV0CutVariables
+    };
+    enum ECascadeCutVariable {
+        kCascCutHypothesis = 0, kCascCutCharge,
+        kCascCutMinEtaTracks, kCascCutMaxEtaTracks, kCascCutMinRapidity, kCascCutMaxRapidity,
+        kCascCutDCANegToPV, kCascCutDCAPosToPV, kCascCutDCAV0Daughters,
+        kCascCutV0CosPA, kCascCutUseVarV0CosPA, kCascCutVarV0CosPAPar0, kCascCutVarV0CosPAPar4 = kCascCutVarV0CosPAPar0+4,
+        kCascCutV0Radius, kCascCutDCAV0ToPV, kCascCutV0Mass, kCascCutDCABachToPV,
+        kCascCutDCACascDaughters, kCascCutUseVarDCACascDau, kCascCutVarDCACascDauPar0, kCascCutVarDCACascDauPar4 = kCascCutVarDCACascDauPar0+4,
+        kCascCutCascCosPA, kCascCutUseVarCascCosPA, kCascCutVarCascCosPAPar0, kCascCutVarCascCosPAPar4 = kCascCutVarCascCosPAPar0+4,
+        kCascCutCascRadius, kCascCutV0MassSigma, kCascCutProperLifetime, kCascCutLeastNumberOfClusters,
+        kCascCutTPCdEdx, kCascCutXiRejection, kCascCutDCABachToBaryon,
+        kCascCutBachBaryonCosPA, kCascCutUseVarBBCosPA, kCascCutVarBBCosPAPar0, kCascCutVarBBCosPAPar4 = kCascCutVarBBCosPAPar0+4,
+        kCascCutMinV0Lifetime, kCascCutMaxV0Lifetime, kCascCutUseITSRefitTracks, kCascCutMaxChi2PerCluster,
+        kCascCutMinTrackLength, kCascCutUse276TeVV0CosPA, kCascCutDCACascadeToPV,
+        kCascCutDCANegToPVWeighted, kCascCutDCAPosToPVWeighted, kCascCutDCABachToPVWeighted,
+        kNCascCutVariables
+    };
+}
+
 ClassImp(AliAnalysisTaskStrangenessVsMultiplicityRun2)
 
 AliAnalysisTaskStrangenessVsMultiplicityRun2::AliAnalysisTaskStrangenessVsMultiplicityRun2()
@@ -348,7 +379,16 @@ fTreeCascVarNegIsKink(kFALSE),
 fkSelectCharge(0),
 //Histos
 fHistEventCounter(0),
-fHistCentrality(0)
+fHistCentrality(0),
+//Compiled configurations
+fNCompiledV0Configurations(-1),
+fV0CutArray(),
+fV0LoosestCut(),
+fV0CutHistos(),
+fNCompiledCascadeConfigurations(-1),
+fCascadeCutArray(),
+fCascadeLoosestCut(),
+fCascadeCutHistos()
 //------------------------------------------------
 // Tree Variables
 {
@@ -579,7 +619,16 @@ fTreeCascVarNegIsKink(kFALSE),
 fkSelectCharge(0),
 //Histos
 fHistEventCounter(0),
-fHistCentrality(0)
+fHistCentrality(0),
+//Compiled configurations
+fNCompiledV0Configurations(-1),
+fV0CutArray(),
+fV0LoosestCut(),
+fV0CutHistos(),
+fNCompiledCascadeConfigurations(-1),
+fCascadeCutArray(),
+fCascadeLoosestCut(),
+fCascadeCutHistos()
 {
     
     //Re-vertex: Will only apply for cascade candidates
@@ -1521,130 +1570,110 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
         // Superlight adaptive output mode
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
         
-        //Step 1: Sweep members of the output object TList and fill all of them as appropriate
-        Int_t lNumberOfConfigurations = fListV0->GetEntries();
+        //Step 1: Sweep all configurations and fill their histograms as appropriate
+        //(cuts are read from the arrays filled in CompileV0Configurations)
+        if( fNCompiledV0Configurations != fListV0->GetEntries() ) CompileV0Configurations();
+        const Int_t lNumberOfConfigurations = fNCompiledV0Configurations;
         //AliWarning(Form("[V0 Analyses] Processing different configurations (%i detected)",lNumberOfConfigurations));
-        TH3F *histoout         = 0x0;
-        AliV0Result *lV0Result = 0x0;
-        for(Int_t lcfg=0; lcfg<lNumberOfConfigurations; lcfg++){
-            lV0Result = (AliV0Result*) fListV0->At(lcfg);
-            histoout  = lV0Result->GetHistogram();
-            
-            Float_t lMass = 0;
-            Float_t lRap  = 0;
-            Float_t lPDGMass = -1;
-            Float_t lNegdEdx = 100;
-            Float_t lPosdEdx = 100;
-            Float_t lBaryonMomentum = -0.5;
-            Float_t lBaryonPt = -0.5;
-            Float_t lBaryondEdxFromProton = 0;
+        
+        //Candidates failing the loosest value of a one-sided cut fail all configurations
+        if( lNumberOfConfigurations > 0 &&
+           fTreeVariableV0Radius > fV0LoosestCut[kV0CutV0Radius] &&
+           fTreeVariableV0Radius < fV0LoosestCut[kV0CutMaxV0Radius] &&
+           fTreeVariableDcaNegToPrimVertex > fV0LoosestCut[kV0CutDCANegToPV] &&
+           fTreeVariableDcaPosToPrimVertex > fV0LoosestCut[kV0CutDCAPosToPV] &&
+           fTreeVariableDcaV0Daughters < fV0LoosestCut[kV0CutDCAV0Daughters] &&
+           fTreeVariableV0CosineOfPointingAngle > fV0LoosestCut[kV0CutV0CosPA] ){
             
-            //========================================================================
-            //Setting up: Variable V0 CosPA
-            Float_t lV0CosPACut = lV0Result -> GetCutV0CosPA();
-            Float_t lVarV0CosPApar[5];
-            lVarV0CosPApar[0] = lV0Result->GetCutVarV0CosPAExp0Const();
-            lVarV0CosPApar[1] = lV0Result->GetCutVarV0CosPAExp0Slope();
-            lVarV0CosPApar[2] = lV0Result->GetCutVarV0CosPAExp1Const();
-            lVarV0CosPApar[3] = lV0Result->GetCutVarV0CosPAExp1Slope();
-            lVarV0CosPApar[4] = lV0Result->GetCutVarV0CosPAConst();
-            Float_t lVarV0CosPA = TMath::Cos(
-                                             lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*fTreeVariablePt) +
-                                             lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*fTreeVariablePt) +
-                                             lVarV0CosPApar[4]);
-            if( lV0Result->GetCutUseVarV0CosPA() ){
-                //Only use if tighter than the non-variable cut
-                if( lVarV0CosPA > lV0CosPACut ) lV0CosPACut = lVarV0CosPA;
-            }
-            //========================================================================
+            //Candidate properties for each mass hypothesis: K0Short, Lambda, AntiLambda, other
+            const Float_t lMass[4]     = { fTreeVariableInvMassK0s, fTreeVariableInvMassLambda, fTreeVariableInvMassAntiLambda, 0 };
+            const Float_t lRap[4]      = { fTreeVariableRapK0Short, fTreeVariableRapLambda, fTreeVariableRapLambda, 0 };
+            const Float_t lPDGMass[4]  = { 0.497, 1.115683, 1.115683, -1 };
+            const Float_t lNegdEdx[4]  = { fTreeVariableNSigmasNegPion, fTreeVariableNSigmasNegPion, fTreeVariableNSigmasNegProton, 100 };
+            const Float_t lPosdEdx[4]  = { fTreeVariableNSigmasPosPion, fTreeVariableNSigmasPosProton, fTreeVariableNSigmasPosPion, 100 };
+            const Float_t lBaryonMomentum[4]       = { -0.5, fTreeVariablePosInnerP, fTreeVariableNegInnerP, -0.5 };
+            const Float_t lBaryonPt[4]             = { -0.5, lThisPosInnerPt, lThisNegInnerPt, -0.5 };
+            const Float_t lBaryondEdxFromProton[4] = { 0, fTreeVariableNSigmasPosProton, fTreeVariableNSigmasNegProton, 0 };
+            const Bool_t lITSRefitTracks =
+            (fTreeVariableNegTrackStatus & AliESDtrack::kITSrefit) &&
+            (fTreeVariablePosTrackStatus & AliESDtrack::kITSrefit);
             
-            if ( lV0Result->GetMassHypothesis() == AliV0Result::kK0Short     ){
-                lMass    = fTreeVariableInvMassK0s;
-                lRap     = fTreeVariableRapK0Short;
-                lPDGMass = 0.497;
-                lNegdEdx = fTreeVariableNSigmasNegPion;
-                lPosdEdx = fTreeVariableNSigmasPosPion;
-            }
-            if ( lV0Result->GetMassHypothesis() == AliV0Result::kLambda      ){
-                lMass = fTreeVariableInvMassLambda;
-                lRap = fTreeVariableRapLambda;
-                lPDGMass = 1.115683;
-                lNegdEdx = fTreeVariableNSigmasNegPion;
-                lPosdEdx = fTreeVariableNSigmasPosProton;
-                lBaryonMomentum = fTreeVariablePosInnerP;
-                lBaryonPt = lThisPosInnerPt;
-                lBaryondEdxFromProton = fTreeVariableNSigmasPosProton;
-            }
-            if ( lV0Result->GetMassHypothesis() == AliV0Result::kAntiLambda  ){
-                lMass = fTreeVariableInvMassAntiLambda;
-                lRap = fTreeVariableRapLambda;
-                lPDGMass = 1.115683;
-                lNegdEdx = fTreeVariableNSigmasNegProton;
-                lPosdEdx = fTreeVariableNSigmasPosPion;
-                lBaryonMomentum = fTreeVariableNegInnerP;
-                lBaryonPt = lThisNegInnerPt;
-                lBaryondEdxFromProton = fTreeVariableNSigmasNegProton;
-            }
+            const Double_t *lCut[kNV0CutVariables];
+            for(Int_t iVar=0; iVar<kNV0CutVariables; iVar++) lCut[iVar] = &fV0CutArray[iVar*lNumberOfConfigurations];
             
-            if (
-                //Check 1: Offline Vertexer
-                lOnFlyStatus == lV0Result->GetUseOnTheFly() &&
+            for(Int_t lcfg=0; lcfg<lNumberOfConfigurations; lcfg++){
+                const Int_t lHypo = (Int_t) lCut[kV0CutHypothesis][lcfg];
                 
-                //Check 2: Basic Acceptance cuts
-                lV0Result->GetCutMinEtaTracks() < fTreeVariableNegEta && fTreeVariableNegEta < lV0Result->GetCutMaxEtaTracks() &&
-                lV0Result->GetCutMinEtaTracks() < fTreeVariablePosEta && fTreeVariablePosEta < lV0Result->GetCutMaxEtaTracks() &&
-                lRap > lV0Result->GetCutMinRapidity() &&
-                lRap < lV0Result->GetCutMaxRapidity() &&
-                
-                //Check 3: Topological Variables
-                fTreeVariableV0Radius > lV0Result->GetCutV0Radius() &&
-                fTreeVariableV0Radius < lV0Result->GetCutMaxV0Radius() &&
-                fTreeVariableDcaNegToPrimVertex > lV0Result->GetCutDCANegToPV() &&
-                fTreeVariableDcaPosToPrimVertex > lV0Result->GetCutDCAPosToPV() &&
-                fTreeVariableDcaV0Daughters < lV0Result->GetCutDCAV0Daughters() &&
-                fTreeVariableV0CosineOfPointingAngle > lV0CosPACut &&
-                fTreeVariableDistOverTotMom*lPDGMass < lV0Result->GetCutProperLifetime() &&
-                fTreeVariableLeastNbrCrossedRows > lV0Result->GetCutLeastNumberOfCrossedRows() &&
-                fTreeVariableLeastRatioCrossedRowsOverFindable > lV0Result->GetCutLeastNumberOfCrossedRowsOverFindable() &&
-                
-                //Check 4: Minimum momentum of baryon daughter
-                ( lV0Result->GetMassHypothesis() == AliV0Result::kK0Short || lBaryonMomentum > lV0Result->GetCutMinBaryonMomentum() ) &&
-                
-                //Check 5: TPC dEdx selections
-                TMath::Abs(lNegdEdx)<lV0Result->GetCutTPCdEdx() &&
-                TMath::Abs(lPosdEdx)<lV0Result->GetCutTPCdEdx() &&
-                
-                //Check 6: Armenteros-Podolanski space cut (for K0Short analysis)
-                ( ( lV0Result->GetCutArmenteros() == kFALSE || lV0Result->GetMassHypothesis() != AliV0Result::kK0Short ) || ( fTreeVariablePtArmV0>lV0Result->GetCutArmenterosParameter()*TMath::Abs(fTreeVariableAlphaV0) ) ) &&
-                
-                //Check 7: kITSrefit track selection if requested
-                (
-                 ( (fTreeVariableNegTrackStatus & AliESDtrack::kITSrefit) &&
-                  (fTreeVariablePosTrackStatus & AliESDtrack::kITSrefit) )
-                 ||
-                 !lV0Result->GetCutUseITSRefitTracks()
-                 )&&
-                
-                //Check 8: Max Chi2/Clusters if not absurd
-                ( lV0Result->GetCutMaxChi2PerCluster()>1e+3 ||
-                 fTreeVariableMaxChi2PerCluster < lV0Result->GetCutMaxChi2PerCluster()
-                 ) &&
-                //Check 9: Min Track Length if positive
-                ( lV0Result->GetCutMinTrackLength()<0 || //this is a bit paranoid...
-                 fTreeVariableMinTrackLength > lV0Result->GetCutMinTrackLength()
-                 )&&
+                //========================================================================
+                //Setting up: Variable V0 CosPA
+                Float_t lV0CosPACut = lCut[kV0CutV0CosPA][lcfg];
+                if( lCut[kV0CutUseVarV0CosPA][lcfg] != 0 ){
+                    Float_t lVarV0CosPApar[5];
+                    for(Int_t ipar=0; ipar<5; ipar++) lVarV0CosPApar[ipar] = lCut[kV0CutVarV0CosPAPar0+ipar][lcfg];
+                    Float_t lVarV0CosPA = TMath::Cos(
+                                                     lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*fTreeVariablePt) +
+                                                     lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*fTreeVariablePt) +
+                                                     lVarV0CosPApar[4]);
+                    //Only use if tighter than the non-variable cut
+                    if( lVarV0CosPA > lV0CosPACut ) lV0CosPACut = lVarV0CosPA;
+                }
+                //========================================================================
                 
-                //Check 10: Special 2.76TeV-like dedx
-                // Logic: either not requested, or K0Short, or high-pT baryon daughter, or passes cut!
-                ( !lV0Result->GetCut276TeVLikedEdx() ||
-                 ( lV0Result->GetMassHypothesis() == AliV0Result::kK0Short ||
-                  ( lBaryonPt > 1.0 || TMath::Abs(lBaryondEdxFromProton)<3.0 )
-                  )
-                 )
-                )
-            {
-                //This satisfies all my conditionals! Fill histogram
-                histoout -> Fill ( fCentrality, fTreeVariablePt, lMass );
+                if (
+                    //Check 1: Offline Vertexer
+                    lOnFlyStatus == lCut[kV0CutOnTheFly][lcfg] &&
+                    
+                    //Check 2: Basic Acceptance cuts
+                    lCut[kV0CutMinEtaTracks][lcfg] < fTreeVariableNegEta && fTreeVariableNegEta < lCut[kV0CutMaxEtaTracks][lcfg] &&
+                    lCut[kV0CutMinEtaTracks][lcfg] < fTreeVariablePosEta && fTreeVariablePosEta < lCut[kV0CutMaxEtaTracks][lcfg] &&
+                    lRap[lHypo] > lCut[kV0CutMinRapidity][lcfg] &&
+                    lRap[lHypo] < lCut[kV0CutMaxRapidity][lcfg] &&
+                    
+                    //Check 3: Topological Variables
+                    fTreeVariableV0Radius > lCut[kV0CutV0Radius][lcfg] &&
+                    fTreeVariableV0Radius < lCut[kV0CutMaxV0Radius][lcfg] &&
+                    fTreeVariableDcaNegToPrimVertex > lCut[kV0CutDCANegToPV][lcfg] &&
+                    fTreeVariableDcaPosToPrimVertex > lCut[kV0CutDCAPosToPV][lcfg] &&
+                    fTreeVariableDcaV0Daughters < lCut[kV0CutDCAV0Daughters][lcfg] &&
+                    fTreeVariableV0CosineOfPointingAngle > lV0CosPACut &&
+                    fTreeVariableDistOverTotMom*lPDGMass[lHypo] < lCut[kV0CutProperLifetime][lcfg] &&
+                    fTreeVariableLeastNbrCrossedRows > lCut[kV0CutLeastNumberOfCrossedRows][lcfg] &&
+                    fTreeVariableLeastRatioCrossedRowsOverFindable > lCut[kV0CutLeastNumberOfCrossedRowsOverFindable][lcfg] &&
+                    
+                    //Check 4: Minimum momentum of baryon daughter
+                    ( lHypo == 0 || lBaryonMomentum[lHypo] > lCut[kV0CutMinBaryonMomentum][lcfg] ) &&
+                    
+                    //Check 5: TPC dEdx selections
+                    TMath::Abs(lNegdEdx[lHypo])<lCut[kV0CutTPCdEdx][lcfg] &&
+                    TMath::Abs(lPosdEdx[lHypo])<lCut[kV0CutTPCdEdx][lcfg] &&
+                    
+                    //Check 6: Armenteros-Podolanski space cut (for K0Short analysis)
+                    ( lCut[kV0CutArmenteros][lcfg] == 0 || ( fTreeVariablePtArmV0>lCut[kV0CutArmenterosParameter][lcfg]*TMath::Abs(fTreeVariableAlphaV0) ) ) &&
+                    
+                    //Check 7: kITSrefit track selection if requested
+                    ( lITSRefitTracks || lCut[kV0CutUseITSRefitTracks][lcfg] == 0 ) &&
+                    
+                    //Check 8: Max Chi2/Clusters if not absurd
+                    ( lCut[kV0CutMaxChi2PerCluster][lcfg]>1e+3 ||
+                     fTreeVariableMaxChi2PerCluster < lCut[kV0CutMaxChi2PerCluster][lcfg]
+                     ) &&
+                    //Check 9: Min Track Length if positive
+                    ( lCut[kV0CutMinTrackLength][lcfg]<0 || //this is a bit paranoid...
+                     fTreeVariableMinTrackLength > lCut[kV0CutMinTrackLength][lcfg]
+                     )&&
+                    
+                    //Check 10: Special 2.76TeV-like dedx
+                    // Logic: either not requested, or K0Short, or high-pT baryon daughter, or passes cut!
+                    ( lCut[kV0Cut276TeVLikedEdx][lcfg] == 0 ||
+                     ( lHypo == 0 ||
+                      ( lBaryonPt[lHypo] > 1.0 || TMath::Abs(lBaryondEdxFromProton[lHypo])<3.0 )
+                      )
+                     )
+                    )
+                {
+                    //This satisfies all my conditionals! Fill histogram
+                    fV0CutHistos[lcfg] -> Fill ( fCentrality, fTreeVariablePt, lMass[lHypo] );
+                }
             }
         }
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
@@ -2337,29 +2366,37 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
         // Superlight adaptive output mode
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
         
-        //Step 1: Sweep members of the output object TList and fill all of them as appropriate
-        Int_t lNumberOfConfigurationsCascade = fListCascade->GetEntries();
+        //Step 1: Sweep all configurations and fill their histograms as appropriate
+        //(cuts are read from the arrays filled in CompileCascadeConfigurations)
+        if( fNCompiledCascadeConfigurations != fListCascade->GetEntries() ) CompileCascadeConfigurations();
+        const Int_t lNumberOfConfigurationsCascade = fNCompiledCascadeConfigurations;
         //AliWarning(Form("[Cascade Analyses] Processing different configurations (%i detected)",lNumberOfConfigurationsCascade));
-        TH3F *histoout         = 0x0;
-        AliCascadeResult *lCascadeResult = 0x0;
-        for(Int_t lcfg=0; lcfg<lNumberOfConfigurationsCascade; lcfg++){
-            lCascadeResult = (AliCascadeResult*) fListCascade->At(lcfg);
-            histoout  = lCascadeResult->GetHistogram();
+        
+        //Candidates failing the loosest value of a one-sided cut fail all configurations
+        if( lNumberOfConfigurationsCascade > 0 &&
+           fTreeCascVarDCANegToPrimVtx > fCascadeLoosestCut[kCascCutDCANegToPV] &&
+           fTreeCascVarDCAPosToPrimVtx > fCascadeLoosestCut[kCascCutDCAPosToPV] &&
+           fTreeCascVarDCAV0Daughters < fCascadeLoosestCut[kCascCutDCAV0Daughters] &&
+           fTreeCascVarV0CosPointingAngle > fCascadeLoosestCut[kCascCutV0CosPA] &&
+           fTreeCascVarV0Radius > fCascadeLoosestCut[kCascCutV0Radius] &&
+           fTreeCascVarDCAV0ToPrimVtx > fCascadeLoosestCut[kCascCutDCAV0ToPV] &&
+           fTreeCascVarDCABachToPrimVtx > fCascadeLoosestCut[kCascCutDCABachToPV] &&
+           fTreeCascVarDCACascDaughters < fCascadeLoosestCut[kCascCutDCACascDaughters] &&
+           fTreeCascVarCascCosPointingAngle > fCascadeLoosestCut[kCascCutCascCosPA] &&
+           fTreeCascVarCascRadius > fCascadeLoosestCut[kCascCutCascRadius] ){
             
-            Float_t lMass = 0;
-            Float_t lV0Mass = 0;
-            Float_t lRap  = 0;
-            Float_t lPDGMass = -1;
-            Float_t lNegdEdx = 100;
-            Float_t lPosdEdx = 100;
-            Float_t lBachdEdx = 100;
-            Short_t  lCharge = -2;
-            Int_t lChargePos =  1;
-            Int_t lChargeNeg = -1;
-            Float_t lprpx, lprpy, lprpz, lpipx, lpipy, lpipz;
-            lpipx = fTreeCascVarBachPx;
-            lpipy = fTreeCascVarBachPy;
-            lpipz = fTreeCascVarBachPz;
+            //Candidate properties for each mass hypothesis: XiMinus, XiPlus, OmegaMinus, OmegaPlus, other
+            const Float_t lMass[5]     = { fTreeCascVarMassAsXi, fTreeCascVarMassAsXi, fTreeCascVarMassAsOmega, fTreeCascVarMassAsOmega, 0 };
+            const Float_t lV0Mass[5]   = { fTreeCascVarV0MassLambda, fTreeCascVarV0MassAntiLambda, fTreeCascVarV0MassLambda, fTreeCascVarV0MassAntiLambda, 0 };
+            const Float_t lRap[5]      = { fTreeCascVarRapXi, fTreeCascVarRapXi, fTreeCascVarRapOmega, fTreeCascVarRapOmega, 0 };
+            const Float_t lPDGMass[5]  = { 1.32171, 1.32171, 1.67245, 1.67245, -1 };
+            const Float_t lNegdEdx[5]  = { fTreeCascVarNegNSigmaPion, fTreeCascVarNegNSigmaProton, fTreeCascVarNegNSigmaPion, fTreeCascVarNegNSigmaProton, 100 };
+            const Float_t lPosdEdx[5]  = { fTreeCascVarPosNSigmaProton, fTreeCascVarPosNSigmaPion, fTreeCascVarPosNSigmaProton, fTreeCascVarPosNSigmaPion, 100 };
+            const Float_t lBachdEdx[5] = { fTreeCascVarBachNSigmaPion, fTreeCascVarBachNSigmaPion, fTreeCascVarBachNSigmaKaon, fTreeCascVarBachNSigmaKaon, 100 };
+            const Bool_t lITSRefitTracks =
+            (fTreeCascVarPosTrackStatus & AliESDtrack::kITSrefit) &&
+            (fTreeCascVarNegTrackStatus & AliESDtrack::kITSrefit) &&
+            (fTreeCascVarBachTrackStatus & AliESDtrack::kITSrefit);
             
             //For parametric V0 Mass selection
             Float_t lExpV0Mass =
@@ -2386,240 +2423,173 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
             }
             //========================================================================
             
-            //========================================================================
-            //Setting up: Variable Cascade CosPA
-            Float_t lCascCosPACut = lCascadeResult -> GetCutCascCosPA();
-            Float_t lVarCascCosPApar[5];
-            lVarCascCosPApar[0] = lCascadeResult->GetCutVarCascCosPAExp0Const();
-            lVarCascCosPApar[1] = lCascadeResult->GetCutVarCascCosPAExp0Slope();
-            lVarCascCosPApar[2] = lCascadeResult->GetCutVarCascCosPAExp1Const();
-            lVarCascCosPApar[3] = lCascadeResult->GetCutVarCascCosPAExp1Slope();
-            lVarCascCosPApar[4] = lCascadeResult->GetCutVarCascCosPAConst();
-            Float_t lVarCascCosPA = TMath::Cos(
-                                               lVarCascCosPApar[0]*TMath::Exp(lVarCascCosPApar[1]*fTreeCascVarPt) +
-                                               lVarCascCosPApar[2]*TMath::Exp(lVarCascCosPApar[3]*fTreeCascVarPt) +
-                                               lVarCascCosPApar[4]);
-            if( lCascadeResult->GetCutUseVarCascCosPA() ){
-                //Only use if tighter than the non-variable cut
-                if( lVarCascCosPA > lCascCosPACut ) lCascCosPACut = lVarCascCosPA;
-            }
-            //========================================================================
-            
-            //========================================================================
-            //Setting up: Variable V0 CosPA
-            Float_t lV0CosPACut = lCascadeResult -> GetCutV0CosPA();
-            Float_t lVarV0CosPApar[5];
-            lVarV0CosPApar[0] = lCascadeResult->GetCutVarV0CosPAExp0Const();
-            lVarV0CosPApar[1] = lCascadeResult->GetCutVarV0CosPAExp0Slope();
-            lVarV0CosPApar[2] = lCascadeResult->GetCutVarV0CosPAExp1Const();
-            lVarV0CosPApar[3] = lCascadeResult->GetCutVarV0CosPAExp1Slope();
-            lVarV0CosPApar[4] = lCascadeResult->GetCutVarV0CosPAConst();
-            Float_t lVarV0CosPA = TMath::Cos(
-                                             lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*fTreeCascVarPt) +
-                                             lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*fTreeCascVarPt) +
-                                             lVarV0CosPApar[4]);
-            if( lCascadeResult->GetCutUseVarV0CosPA() ){
-                //Only use if tighter than the non-variable cut
-                if( lVarV0CosPA > lV0CosPACut ) lV0CosPACut = lVarV0CosPA;
-            }
-            //========================================================================
-            
-            //========================================================================
-            //Setting up: Variable BB CosPA
-            Float_t lBBCosPACut = lCascadeResult -> GetCutBachBaryonCosPA();
-            Float_t lVarBBCosPApar[5];
-            lVarBBCosPApar[0] = lCascadeResult->GetCutVarBBCosPAExp0Const();
-            lVarBBCosPApar[1] = lCascadeResult->GetCutVarBBCosPAExp0Slope();
-            lVarBBCosPApar[2] = lCascadeResult->GetCutVarBBCosPAExp1Const();
-            lVarBBCosPApar[3] = lCascadeResult->GetCutVarBBCosPAExp1Slope();
-            lVarBBCosPApar[4] = lCascadeResult->GetCutVarBBCosPAConst();
-            Float_t lVarBBCosPA = TMath::Cos(
-                                             lVarBBCosPApar[0]*TMath::Exp(lVarBBCosPApar[1]*fTreeCascVarPt) +
-                                             lVarBBCosPApar[2]*TMath::Exp(lVarBBCosPApar[3]*fTreeCascVarPt) +
-                                             lVarBBCosPApar[4]);
-            if( lCascadeResult->GetCutUseVarBBCosPA() ){
-                //Only use if looser than the non-variable cut (WARNING: BEWARE INVERSE LOGIC)
-                if( lVarBBCosPA > lBBCosPACut ) lBBCosPACut = lVarBBCosPA;
-            }
-            //========================================================================
-            
-            //========================================================================
-            //Setting up: Variable DCA Casc Dau
-            Float_t lDCACascDauCut = lCascadeResult -> GetCutDCACascDaughters();
-            Float_t lVarDCACascDaupar[5];
-            lVarDCACascDaupar[0] = lCascadeResult->GetCutVarDCACascDauExp0Const();
-            lVarDCACascDaupar[1] = lCascadeResult->GetCutVarDCACascDauExp0Slope();
-            lVarDCACascDaupar[2] = lCascadeResult->GetCutVarDCACascDauExp1Const();
-            lVarDCACascDaupar[3] = lCascadeResult->GetCutVarDCACascDauExp1Slope();
-            lVarDCACascDaupar[4] = lCascadeResult->GetCutVarDCACascDauConst();
-            Float_t lVarDCACascDau = lVarDCACascDaupar[0]*TMath::Exp(lVarDCACascDaupar[1]*fTreeCascVarPt) +
-            lVarDCACascDaupar[2]*TMath::Exp(lVarDCACascDaupar[3]*fTreeCascVarPt) +
-            lVarDCACascDaupar[4];
-            if( lCascadeResult->GetCutUseVarDCACascDau() ){
-                //Loosest: default cut, parametric can go tighter
-                if( lVarDCACascDau < lDCACascDauCut ) lDCACascDauCut = lVarDCACascDau;
-            }
-            //========================================================================
+            //3D cascade DCA to PV and weighted daughter track DCAs to PV
+            const Double_t lCascDCAToPV = TMath::Sqrt(fTreeCascVarCascDCAtoPVz*fTreeCascVarCascDCAtoPVz + fTreeCascVarCascDCAtoPVxy*fTreeCascVarCascDCAtoPVxy);
+            const Double_t lNegDCAToPVWeighted  = fTreeCascVarDCANegToPrimVtx/TMath::Sqrt(fTreeCascVarNegDCAPVSigmaX2*fTreeCascVarNegDCAPVSigmaX2 + fTreeCascVarNegDCAPVSigmaY2*fTreeCascVarNegDCAPVSigmaY2+1e-6);
+            const Double_t lPosDCAToPVWeighted  = fTreeCascVarDCAPosToPrimVtx/TMath::Sqrt(fTreeCascVarPosDCAPVSigmaX2*fTreeCascVarPosDCAPVSigmaX2 + fTreeCascVarPosDCAPVSigmaY2*fTreeCascVarPosDCAPVSigmaY2+1e-6);
+            const Double_t lBachDCAToPVWeighted = fTreeCascVarDCABachToPrimVtx/TMath::Sqrt(fTreeCascVarBachDCAPVSigmaX2*fTreeCascVarBachDCAPVSigmaX2 + fTreeCascVarBachDCAPVSigmaY2*fTreeCascVarBachDCAPVSigmaY2+1e-6);
             
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiMinus     ){
-                lCharge  = -1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
-                lMass    = fTreeCascVarMassAsXi;
-                lV0Mass  = fTreeCascVarV0MassLambda;
-                lRap     = fTreeCascVarRapXi;
-                lPDGMass = 1.32171;
-                lNegdEdx = fTreeCascVarNegNSigmaPion;
-                lPosdEdx = fTreeCascVarPosNSigmaProton;
-                lBachdEdx= fTreeCascVarBachNSigmaPion;
-                lprpx = fTreeCascVarPosPx;
-                lprpy = fTreeCascVarPosPy;
-                lprpz = fTreeCascVarPosPz;
-            }
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiPlus      ){
-                lCharge  = +1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
-                lMass    = fTreeCascVarMassAsXi;
-                lV0Mass  = fTreeCascVarV0MassAntiLambda;
-                lRap     = fTreeCascVarRapXi;
-                lPDGMass = 1.32171;
-                lNegdEdx = fTreeCascVarNegNSigmaProton;
-                lPosdEdx = fTreeCascVarPosNSigmaPion;
-                lBachdEdx= fTreeCascVarBachNSigmaPion;
-                lprpx = fTreeCascVarNegPx;
-                lprpy = fTreeCascVarNegPy;
-                lprpz = fTreeCascVarNegPz;
-            }
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaMinus     ){
-                lCharge  = -1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
-                lMass    = fTreeCascVarMassAsOmega;
-                lV0Mass  = fTreeCascVarV0MassLambda;
-                lRap     = fTreeCascVarRapOmega;
-                lPDGMass = 1.67245;
-                lNegdEdx = fTreeCascVarNegNSigmaPion;
-                lPosdEdx = fTreeCascVarPosNSigmaProton;
-                lBachdEdx= fTreeCascVarBachNSigmaKaon;
-                lprpx = fTreeCascVarPosPx;
-                lprpy = fTreeCascVarPosPy;
-                lprpz = fTreeCascVarPosPz;
-            }
-            if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaPlus      ){
-                lCharge  = +1;
-                if ( lCascadeResult->GetSwapBachelorCharge() ) lCharge *= -1;
-                lMass    = fTreeCascVarMassAsOmega;
-                lV0Mass  = fTreeCascVarV0MassAntiLambda;
-                lRap     = fTreeCascVarRapOmega;
-                lPDGMass = 1.67245;
-                lNegdEdx = fTreeCascVarNegNSigmaProton;
-                lPosdEdx = fTreeCascVarPosNSigmaPion;
-                lBachdEdx= fTreeCascVarBachNSigmaKaon;
-                lprpx = fTreeCascVarNegPx;
-                lprpy = fTreeCascVarNegPy;
-                lprpz = fTreeCascVarNegPz;
-            }
+            const Double_t *lCut[kNCascCutVariables];
+            for(Int_t iVar=0; iVar<kNCascCutVariables; iVar++) lCut[iVar] = &fCascadeCutArray[iVar*lNumberOfConfigurationsCascade];
             
-            if (
-                //Check 1: Charge consistent with expectations
-                fTreeCascVarCharge == lCharge &&
-                
-                //Check 2: Basic Acceptance cuts
-                lCascadeResult->GetCutMinEtaTracks() < fTreeCascVarPosEta && fTreeCascVarPosEta < lCascadeResult->GetCutMaxEtaTracks() &&
-                lCascadeResult->GetCutMinEtaTracks() < fTreeCascVarNegEta && fTreeCascVarNegEta < lCascadeResult->GetCutMaxEtaTracks() &&
-                lCascadeResult->GetCutMinEtaTracks() < fTreeCascVarBachEta && fTreeCascVarBachEta < lCascadeResult->GetCutMaxEtaTracks() &&
-                lRap > lCascadeResult->GetCutMinRapidity() &&
-                lRap < lCascadeResult->GetCutMaxRapidity() &&
-                
-                //Check 3: Topological Variables
-                // - V0 Selections
-                fTreeCascVarDCANegToPrimVtx > lCascadeResult->GetCutDCANegToPV() &&
-                fTreeCascVarDCAPosToPrimVtx > lCascadeResult->GetCutDCAPosToPV() &&
-                fTreeCascVarDCAV0Daughters < lCascadeResult->GetCutDCAV0Daughters() &&
-                fTreeCascVarV0CosPointingAngle > lV0CosPACut &&
-                fTreeCascVarV0Radius > lCascadeResult->GetCutV0Radius() &&
-                // - Cascade Selections
-                fTreeCascVarDCAV0ToPrimVtx > lCascadeResult->GetCutDCAV0ToPV() &&
-                TMath::Abs(lV0Mass-1.116) < lCascadeResult->GetCutV0Mass() &&
-                fTreeCascVarDCABachToPrimVtx > lCascadeResult->GetCutDCABachToPV() &&
-                fTreeCascVarDCACascDaughters < lDCACascDauCut &&
-                fTreeCascVarCascCosPointingAngle > lCascCosPACut &&
-                fTreeCascVarCascRadius > lCascadeResult->GetCutCascRadius() &&
-                
-                // - Implementation of a parametric V0 Mass cut if requested
-                (
-                 ( lCascadeResult->GetCutV0MassSigma() > 50 ) || //anything goes
-                 (TMath::Abs( (lV0Mass-lExpV0Mass) / lExpV0Sigma ) < lCascadeResult->GetCutV0MassSigma() )
-                 ) &&
-                
-                // - Miscellaneous
-                fTreeCascVarDistOverTotMom*lPDGMass < lCascadeResult->GetCutProperLifetime() &&
-                fTreeCascVarLeastNbrClusters > lCascadeResult->GetCutLeastNumberOfClusters() &&
-                
-                //Check 4: TPC dEdx selections
-                TMath::Abs(lNegdEdx )<lCascadeResult->GetCutTPCdEdx() &&
-                TMath::Abs(lPosdEdx )<lCascadeResult->GetCutTPCdEdx() &&
-                TMath::Abs(lBachdEdx)<lCascadeResult->GetCutTPCdEdx() &&
-                
-                //Check 5: Xi rejection for Omega analysis
-                ( ( lCascadeResult->GetMassHypothesis() != AliCascadeResult::kOmegaMinus && lCascadeResult->GetMassHypothesis() != AliCascadeResult::kOmegaPlus  ) || ( TMath::Abs( fTreeCascVarMassAsXi - 1.32171 ) > lCascadeResult->GetCutXiRejection() ) ) &&
-                
-                //Check 6: Experimental DCA Bachelor to Baryon cut
-                ( fTreeCascVarDCABachToBaryon > lCascadeResult->GetCutDCABachToBaryon() ) &&
-                
-                //Check 7: Experimental Bach Baryon CosPA
-                ( fTreeCascVarWrongCosPA < lBBCosPACut  ) &&
+            for(Int_t lcfg=0; lcfg<lNumberOfConfigurationsCascade; lcfg++){
+                const Int_t lHypo = (Int_t) lCut[kCascCutHypothesis][lcfg];
                 
-                //Check 8: Min/Max V0 Lifetime cut
-                ( ( fTreeCascVarV0Lifetime > lCascadeResult->GetCutMinV0Lifetime() ) &&
-                 ( fTreeCascVarV0Lifetime < lCascadeResult->GetCutMaxV0Lifetime() ||
-                  lCascadeResult->GetCutMaxV0Lifetime() > 1e+3 ) ) &&
-                
-                //Check 9: kITSrefit track selection if requested
-                (
-                 ( (fTreeCascVarPosTrackStatus & AliESDtrack::kITSrefit) &&
-                  (fTreeCascVarNegTrackStatus & AliESDtrack::kITSrefit) &&
-                  (fTreeCascVarBachTrackStatus & AliESDtrack::kITSrefit)
-                  )
-                 ||
-                 !lCascadeResult->GetCutUseITSRefitTracks()
-                 ) &&
-                
-                //Check 10: Max Chi2/Clusters if not absurd
-                ( lCascadeResult->GetCutMaxChi2PerCluster()>1e+3 ||
-                 fTreeCascVarMaxChi2PerCluster < lCascadeResult->GetCutMaxChi2PerCluster()
-                 )&&
+                //========================================================================
+                //Setting up: Variable Cascade CosPA
+                Float_t lCascCosPACut = lCut[kCascCutCascCosPA][lcfg];
+                if( lCut[kCascCutUseVarCascCosPA][lcfg] != 0 ){
+                    Float_t lVarCascCosPApar[5];
+                    for(Int_t ipar=0; ipar<5; ipar++) lVarCascCosPApar[ipar] = lCut[kCascCutVarCascCosPAPar0+ipar][lcfg];
+                    Float_t lVarCascCosPA = TMath::Cos(
+                                                       lVarCascCosPApar[0]*TMath::Exp(lVarCascCosPApar[1]*fTreeCascVarPt) +
+                                                       lVarCascCosPApar[2]*TMath::Exp(lVarCascCosPApar[3]*fTreeCascVarPt) +
+                                                       lVarCascCosPApar[4]);
+                    //Only use if tighter than the non-variable cut
+                    if( lVarCascCosPA > lCascCosPACut ) lCascCosPACut = lVarCascCosPA;
+                }
+                //========================================================================
                 
-                //Check 11: Min Track Length if positive
-                ( lCascadeResult->GetCutMinTrackLength()<0 || //this is a bit paranoid...
-                 fTreeCascVarMinTrackLength > lCascadeResult->GetCutMinTrackLength()
-                 )&&
+                //========================================================================
+                //Setting up: Variable V0 CosPA
+                Float_t lV0CosPACut = lCut[kCascCutV0CosPA][lcfg];
+                if( lCut[kCascCutUseVarV0CosPA][lcfg] != 0 ){
+                    Float_t lVarV0CosPApar[5];
+                    for(Int_t ipar=0; ipar<5; ipar++) lVarV0CosPApar[ipar] = lCut[kCascCutVarV0CosPAPar0+ipar][lcfg];
+                    Float_t lVarV0CosPA = TMath::Cos(
+                                                     lVarV0CosPApar[0]*TMath::Exp(lVarV0CosPApar[1]*fTreeCascVarPt) +
+                                                     lVarV0CosPApar[2]*TMath::Exp(lVarV0CosPApar[3]*fTreeCascVarPt) +
+                                                     lVarV0CosPApar[4]);
+                    //Only use if tighter than the non-variable cut
+                    if( lVarV0CosPA > lV0CosPACut ) lV0CosPACut = lVarV0CosPA;
+                }
+                //========================================================================
                 
-                //Check 12: Check if special V0 CosPA cut used
-                //either don't use the cut at all, or make sure it's above threshold
-                ( lCascadeResult->GetCutUse276TeVV0CosPA()==kFALSE ||
-                 fTreeCascVarV0CosPointingAngle>l276TeVV0CosPA
-                 )&&
+                //========================================================================
+                //Setting up: Variable BB CosPA
+                Float_t lBBCosPACut = lCut[kCascCutBachBaryonCosPA][lcfg];
+                if( lCut[kCascCutUseVarBBCosPA][lcfg] != 0 ){
+                    Float_t lVarBBCosPApar[5];
+                    for(Int_t ipar=0; ipar<5; ipar++) lVarBBCosPApar[ipar] = lCut[kCascCutVarBBCosPAPar0+ipar][lcfg];
+                    Float_t lVarBBCosPA = TMath::Cos(
+                                                     lVarBBCosPApar[0]*TMath::Exp(lVarBBCosPApar[1]*fTreeCascVarPt) +
+                                                     lVarBBCosPApar[2]*TMath::Exp(lVarBBCosPApar[3]*fTreeCascVarPt) +
+                                                     lVarBBCosPApar[4]);
+                    //Only use if looser than the non-variable cut (WARNING: BEWARE INVERSE LOGIC)
+                    if( lVarBBCosPA > lBBCosPACut ) lBBCosPACut = lVarBBCosPA;
+                }
+                //========================================================================
                 
-                //Check 13: 3D Cascade DCA to PV
-                ( lCascadeResult->GetCutDCACascadeToPV() > 999 ||
-                 (TMath::Sqrt(fTreeCascVarCascDCAtoPVz*fTreeCascVarCascDCAtoPVz + fTreeCascVarCascDCAtoPVxy*fTreeCascVarCascDCAtoPVxy)<lCascadeResult->GetCutDCACascadeToPV() )
-                 )&&
+                //========================================================================
+                //Setting up: Variable DCA Casc Dau
+                Float_t lDCACascDauCut = lCut[kCascCutDCACascDaughters][lcfg];
+                if( lCut[kCascCutUseVarDCACascDau][lcfg] != 0 ){
+                    Float_t lVarDCACascDaupar[5];
+                    for(Int_t ipar=0; ipar<5; ipar++) lVarDCACascDaupar[ipar] = lCut[kCascCutVarDCACascDauPar0+ipar][lcfg];
+                    Float_t lVarDCACascDau = lVarDCACascDaupar[0]*TMath::Exp(lVarDCACascDaupar[1]*fTreeCascVarPt) +
+                    lVarDCACascDaupar[2]*TMath::Exp(lVarDCACascDaupar[3]*fTreeCascVarPt) +
+                    lVarDCACascDaupar[4];
+                    //Loosest: default cut, parametric can go tighter
+                    if( lVarDCACascDau < lDCACascDauCut ) lDCACascDauCut = lVarDCACascDau;
+                }
+                //========================================================================
                 
-                //Check 14a: Negative track DCA to PV, weighted
-                ( lCascadeResult->GetCutDCANegToPVWeighted() < 0 ||
-                 (fTreeCascVarDCANegToPrimVtx/TMath::Sqrt(fTreeCascVarNegDCAPVSigmaX2*fTreeCascVarNegDCAPVSigmaX2 + fTreeCascVarNegDCAPVSigmaY2*fTreeCascVarNegDCAPVSigmaY2+1e-6)>lCascadeResult->GetCutDCANegToPVWeighted() )
-                 )&&
-                //Check 14a: Negative track DCA to PV, weighted
-                ( lCascadeResult->GetCutDCAPosToPVWeighted() < 0 ||
-                 (fTreeCascVarDCAPosToPrimVtx/TMath::Sqrt(fTreeCascVarPosDCAPVSigmaX2*fTreeCascVarPosDCAPVSigmaX2 + fTreeCascVarPosDCAPVSigmaY2*fTreeCascVarPosDCAPVSigmaY2+1e-6)>lCascadeResult->GetCutDCAPosToPVWeighted() )
-                 )&&
-                //Check 14a: Negative track DCA to PV, weighted
-                ( lCascadeResult->GetCutDCABachToPVWeighted() < 0 ||
-                 (fTreeCascVarDCABachToPrimVtx/TMath::Sqrt(fTreeCascVarBachDCAPVSigmaX2*fTreeCascVarBachDCAPVSigmaX2 + fTreeCascVarBachDCAPVSigmaY2*fTreeCascVarBachDCAPVSigmaY2+1e-6)>lCascadeResult->GetCutDCABachToPVWeighted() )
-                 )
-                )
-            {
-                //This satisfies all my conditionals! Fill histogram
-                histoout -> Fill ( fCentrality, fTreeCascVarPt, lMass );
+                if (
+                    //Check 1: Charge consistent with expectations
+                    fTreeCascVarCharge == lCut[kCascCutCharge][lcfg] &&
+                    
+                    //Check 2: Basic Acceptance cuts
+                    lCut[kCascCutMinEtaTracks][lcfg] < fTreeCascVarPosEta && fTreeCascVarPosEta < lCut[kCascCutMaxEtaTracks][lcfg] &&
+                    lCut[kCascCutMinEtaTracks][lcfg] < fTreeCascVarNegEta && fTreeCascVarNegEta < lCut[kCascCutMaxEtaTracks][lcfg] &&
+                    lCut[kCascCutMinEtaTracks][lcfg] < fTreeCascVarBachEta && fTreeCascVarBachEta < lCut[kCascCutMaxEtaTracks][lcfg] &&
+                    lRap[lHypo] > lCut[kCascCutMinRapidity][lcfg] &&
+                    lRap[lHypo] < lCut[kCascCutMaxRapidity][lcfg] &&
+                    
+                    //Check 3: Topological Variables
+                    // - V0 Selections
+                    fTreeCascVarDCANegToPrimVtx > lCut[kCascCutDCANegToPV][lcfg] &&
+                    fTreeCascVarDCAPosToPrimVtx > lCut[kCascCutDCAPosToPV][lcfg] &&
+                    fTreeCascVarDCAV0Daughters < lCut[kCascCutDCAV0Daughters][lcfg] &&
+                    fTreeCascVarV0CosPointingAngle > lV0CosPACut &&
+                    fTreeCascVarV0Radius > lCut[kCascCutV0Radius][lcfg] &&
+                    // - Cascade Selections
+                    fTreeCascVarDCAV0ToPrimVtx > lCut[kCascCutDCAV0ToPV][lcfg] &&
+                    TMath::Abs(lV0Mass[lHypo]-1.116) < lCut[kCascCutV0Mass][lcfg] &&
+                    fTreeCascVarDCABachToPrimVtx > lCut[kCascCutDCABachToPV][lcfg] &&
+                    fTreeCascVarDCACascDaughters < lDCACascDauCut &&
+                    fTreeCascVarCascCosPointingAngle > lCascCosPACut &&
+                    fTreeCascVarCascRadius > lCut[kCascCutCascRadius][lcfg] &&
+                    
+                    // - Implementation of a parametric V0 Mass cut if requested
+                    (
+                     ( lCut[kCascCutV0MassSigma][lcfg] > 50 ) || //anything goes
+                     (TMath::Abs( (lV0Mass[lHypo]-lExpV0Mass) / lExpV0Sigma ) < lCut[kCascCutV0MassSigma][lcfg] )
+                     ) &&
+                    
+                    // - Miscellaneous
+                    fTreeCascVarDistOverTotMom*lPDGMass[lHypo] < lCut[kCascCutProperLifetime][lcfg] &&
+                    fTreeCascVarLeastNbrClusters > lCut[kCascCutLeastNumberOfClusters][lcfg] &&
+                    
+                    //Check 4: TPC dEdx selections
+                    TMath::Abs(lNegdEdx[lHypo] )<lCut[kCascCutTPCdEdx][lcfg] &&
+                    TMath::Abs(lPosdEdx[lHypo] )<lCut[kCascCutTPCdEdx][lcfg] &&
+                    TMath::Abs(lBachdEdx[lHypo])<lCut[kCascCutTPCdEdx][lcfg] &&
+                    
+                    //Check 5: Xi rejection for Omega analysis
+                    ( ( lHypo != 2 && lHypo != 3 ) || ( TMath::Abs( fTreeCascVarMassAsXi - 1.32171 ) > lCut[kCascCutXiRejection][lcfg] ) ) &&
+                    
+                    //Check 6: Experimental DCA Bachelor to Baryon cut
+                    ( fTreeCascVarDCABachToBaryon > lCut[kCascCutDCABachToBaryon][lcfg] ) &&
+                    
+                    //Check 7: Experimental Bach Baryon CosPA
+                    ( fTreeCascVarWrongCosPA < lBBCosPACut  ) &&
+                    
+                    //Check 8: Min/Max V0 Lifetime cut
+                    ( ( fTreeCascVarV0Lifetime > lCut[kCascCutMinV0Lifetime][lcfg] ) &&
+                     ( fTreeCascVarV0Lifetime < lCut[kCascCutMaxV0Lifetime][lcfg] ||
+                      lCut[kCascCutMaxV0Lifetime][lcfg] > 1e+3 ) ) &&
+                    
+                    //Check 9: kITSrefit track selection if requested
+                    ( lITSRefitTracks || lCut[kCascCutUseITSRefitTracks][lcfg] == 0 ) &&
+                    
+                    //Check 10: Max Chi2/Clusters if not absurd
+                    ( lCut[kCascCutMaxChi2PerCluster][lcfg]>1e+3 ||
+                     fTreeCascVarMaxChi2PerCluster < lCut[kCascCutMaxChi2PerCluster][lcfg]
+                     )&&
+                    
+                    //Check 11: Min Track Length if positive
+                    ( lCut[kCascCutMinTrackLength][lcfg]<0 || //this is a bit paranoid...
+                     fTreeCascVarMinTrackLength > lCut[kCascCutMinTrackLength][lcfg]
+                     )&&
+                    
+                    //Check 12: Check if special V0 CosPA cut used
+                    //either don't use the cut at all, or make sure it's above threshold
+                    ( lCut[kCascCutUse276TeVV0CosPA][lcfg] == 0 ||
+                     fTreeCascVarV0CosPointingAngle>l276TeVV0CosPA
+                     )&&
+                    
+                    //Check 13: 3D Cascade DCA to PV
+                    ( lCut[kCascCutDCACascadeToPV][lcfg] > 999 ||
+                     lCascDCAToPV < lCut[kCascCutDCACascadeToPV][lcfg]
+                     )&&
+                    
+                    //Check 14a: Negative track DCA to PV, weighted
+                    ( lCut[kCascCutDCANegToPVWeighted][lcfg] < 0 ||
+                     lNegDCAToPVWeighted > lCut[kCascCutDCANegToPVWeighted][lcfg]
+                     )&&
+                    //Check 14b: Positive track DCA to PV, weighted
+                    ( lCut[kCascCutDCAPosToPVWeighted][lcfg] < 0 ||
+                     lPosDCAToPVWeighted > lCut[kCascCutDCAPosToPVWeighted][lcfg]
+                     )&&
+                    //Check 14c: Bachelor track DCA to PV, weighted
+                    ( lCut[kCascCutDCABachToPVWeighted][lcfg] < 0 ||
+                     lBachDCAToPVWeighted > lCut[kCascCutDCABachToPVWeighted][lcfg]
+                     )
+                    )
+                {
+                    //This satisfies all my conditionals! Fill histogram
+                    fCascadeCutHistos[lcfg] -> Fill ( fCentrality, fTreeCascVarPt, lMass[lHypo] );
+                }
             }
         }
         //+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
@@ -2698,6 +2668,184 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::AddConfiguration( AliCascadeR
     fListCascade->Add(lCascadeResult);
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::CompileV0Configurations()
+{
+    //Copy the cuts of all V0 configurations into one array, one row per cut variable,
+    //so that the superlight loop does not go through the TList (TList::At is linear
+    //in the index) and the getters once per candidate and configuration
+    const Int_t lN = fListV0 ? fListV0->GetEntries() : 0;
+    fNCompiledV0Configurations = lN;
+    fV0CutArray.assign( kNV0CutVariables*lN, 0. );
+    fV0LoosestCut.assign( kNV0CutVariables, 0. );
+    fV0CutHistos.assign( lN, (TH3F*) 0x0 );
+    
+    Double_t lValue[kNV0CutVariables];
+    for(Int_t lcfg=0; lcfg<lN; lcfg++){
+        AliV0Result *lV0Result = (AliV0Result*) fListV0->At(lcfg);
+        fV0CutHistos[lcfg] = lV0Result->GetHistogram();
+        
+        //Hypotheses other than K0Short, Lambda and AntiLambda: no mass, rapidity or PID information
+        lValue[kV0CutHypothesis] = 3;
+        if ( lV0Result->GetMassHypothesis() == AliV0Result::kK0Short    ) lValue[kV0CutHypothesis] = 0;
+        if ( lV0Result->GetMassHypothesis() == AliV0Result::kLambda     ) lValue[kV0CutHypothesis] = 1;
+        if ( lV0Result->GetMassHypothesis() == AliV0Result::kAntiLambda ) lValue[kV0CutHypothesis] = 2;
+        
+        lValue[kV0CutOnTheFly]       = lV0Result->GetUseOnTheFly();
+        lValue[kV0CutMinEtaTracks]   = lV0Result->GetCutMinEtaTracks();
+        lValue[kV0CutMaxEtaTracks]   = lV0Result->GetCutMaxEtaTracks();
+        lValue[kV0CutMinRapidity]    = lV0Result->GetCutMinRapidity();
+        lValue[kV0CutMaxRapidity]    = lV0Result->GetCutMaxRapidity();
+        lValue[kV0CutV0Radius]       = lV0Result->GetCutV0Radius();
+        lValue[kV0CutMaxV0Radius]    = lV0Result->GetCutMaxV0Radius();
+        lValue[kV0CutDCANegToPV]     = lV0Result->GetCutDCANegToPV();
+        lValue[kV0CutDCAPosToPV]     = lV0Result->GetCutDCAPosToPV();
+        lValue[kV0CutDCAV0Daughters] = lV0Result->GetCutDCAV0Daughters();
+        
+        //Variable V0 CosPA: stored as Float_t, as used in the selection
+        lValue[kV0CutV0CosPA]         = (Float_t) lV0Result->GetCutV0CosPA();
+        lValue[kV0CutUseVarV0CosPA]   = lV0Result->GetCutUseVarV0CosPA();
+        lValue[kV0CutVarV0CosPAPar0]   = (Float_t) lV0Result->GetCutVarV0CosPAExp0Const();
+        lValue[kV0CutVarV0CosPAPar0+1] = (Float_t) lV0Result->GetCutVarV0CosPAExp0Slope();
+        lValue[kV0CutVarV0CosPAPar0+2] = (Float_t) lV0Result->GetCutVarV0CosPAExp1Const();
+        lValue[kV0CutVarV0CosPAPar0+3] = (Float_t) lV0Result->GetCutVarV0CosPAExp1Slope();
+        lValue[kV0CutVarV0CosPAPar4]   = (Float_t) lV0Result->GetCutVarV0CosPAConst();
+        
+        lValue[kV0CutProperLifetime]                      = lV0Result->GetCutProperLifetime();
+        lValue[kV0CutLeastNumberOfCrossedRows]            = lV0Result->GetCutLeastNumberOfCrossedRows();
+        lValue[kV0CutLeastNumberOfCrossedRowsOverFindable] = lV0Result->GetCutLeastNumberOfCrossedRowsOverFindable();
+        lValue[kV0CutMinBaryonMomentum] = lV0Result->GetCutMinBaryonMomentum();
+        lValue[kV0CutTPCdEdx]           = lV0Result->GetCutTPCdEdx();
+        //Armenteros-Podolanski cut only applies to the K0Short hypothesis
+        lValue[kV0CutArmenteros]          = ( lV0Result->GetCutArmenteros() && lV0Result->GetMassHypothesis() == AliV0Result::kK0Short );
+        lValue[kV0CutArmenterosParameter] = lV0Result->GetCutArmenterosParameter();
+        lValue[kV0CutUseITSRefitTracks]   = lV0Result->GetCutUseITSRefitTracks();
+        lValue[kV0CutMaxChi2PerCluster]   = lV0Result->GetCutMaxChi2PerCluster();
+        lValue[kV0CutMinTrackLength]      = lV0Result->GetCutMinTrackLength();
+        lValue[kV0Cut276TeVLikedEdx]      = lV0Result->GetCut276TeVLikedEdx();
+        
+        for(Int_t iVar=0; iVar<kNV0CutVariables; iVar++) fV0CutArray[iVar*lN+lcfg] = lValue[iVar];
+    }
+    if( lN < 1 ) return;
+    
+    //Loosest value of the one-sided cuts: candidates failing these fail all configurations
+    //(the variable V0 CosPA can only be tighter than the non-variable cut)
+    fV0LoosestCut[kV0CutV0Radius]       = TMath::MinElement( lN, &fV0CutArray[kV0CutV0Radius*lN]       );
+    fV0LoosestCut[kV0CutMaxV0Radius]    = TMath::MaxElement( lN, &fV0CutArray[kV0CutMaxV0Radius*lN]    );
+    fV0LoosestCut[kV0CutDCANegToPV]     = TMath::MinElement( lN, &fV0CutArray[kV0CutDCANegToPV*lN]     );
+    fV0LoosestCut[kV0CutDCAPosToPV]     = TMath::MinElement( lN, &fV0CutArray[kV0CutDCAPosToPV*lN]     );
+    fV0LoosestCut[kV0CutDCAV0Daughters] = TMath::MaxElement( lN, &fV0CutArray[kV0CutDCAV0Daughters*lN] );
+    fV0LoosestCut[kV0CutV0CosPA]        = TMath::MinElement( lN, &fV0CutArray[kV0CutV0CosPA*lN]        );
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::CompileCascadeConfigurations()
+{
+    //Same as CompileV0Configurations, for the cascade configurations
+    const Int_t lN = fListCascade ? fListCascade->GetEntries() : 0;
+    fNCompiledCascadeConfigurations = lN;
+    fCascadeCutArray.assign( kNCascCutVariables*lN, 0. );
+    fCascadeLoosestCut.assign( kNCascCutVariables, 0. );
+    fCascadeCutHistos.assign( lN, (TH3F*) 0x0 );
+    
+    Double_t lValue[kNCascCutVariables];
+    for(Int_t lcfg=0; lcfg<lN; lcfg++){
+        AliCascadeResult *lCascadeResult = (AliCascadeResult*) fListCascade->At(lcfg);
+        fCascadeCutHistos[lcfg] = lCascadeResult->GetHistogram();
+        
+        //Hypotheses other than Xi and Omega: no mass, rapidity or PID information, charge -2 never matches
+        lValue[kCascCutHypothesis] = 4;
+        lValue[kCascCutCharge]     = -2;
+        if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiMinus    ){ lValue[kCascCutHypothesis] = 0; lValue[kCascCutCharge] = -1; }
+        if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kXiPlus     ){ lValue[kCascCutHypothesis] = 1; lValue[kCascCutCharge] = +1; }
+        if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaMinus ){ lValue[kCascCutHypothesis] = 2; lValue[kCascCutCharge] = -1; }
+        if ( lCascadeResult->GetMassHypothesis() == AliCascadeResult::kOmegaPlus  ){ lValue[kCascCutHypothesis] = 3; lValue[kCascCutCharge] = +1; }
+        if ( lValue[kCascCutHypothesis] < 4 && lCascadeResult->GetSwapBachelorCharge() ) lValue[kCascCutCharge] *= -1;
+        
+        lValue[kCascCutMinEtaTracks]   = lCascadeResult->GetCutMinEtaTracks();
+        lValue[kCascCutMaxEtaTracks]   = lCascadeResult->GetCutMaxEtaTracks();
+        lValue[kCascCutMinRapidity]    = lCascadeResult->GetCutMinRapidity();
+        lValue[kCascCutMaxRapidity]    = lCascadeResult->GetCutMaxRapidity();
+        lValue[kCascCutDCANegToPV]     = lCascadeResult->GetCutDCANegToPV();
+        lValue[kCascCutDCAPosToPV]     = lCascadeResult->GetCutDCAPosToPV();
+        lValue[kCascCutDCAV0Daughters] = lCascadeResult->GetCutDCAV0Daughters();
+        
+        //Variable cuts: stored as Float_t, as used in the selection
+        lValue[kCascCutV0CosPA]          = (Float_t) lCascadeResult->GetCutV0CosPA();
+        lValue[kCascCutUseVarV0CosPA]    = lCascadeResult->GetCutUseVarV0CosPA();
+        lValue[kCascCutVarV0CosPAPar0]   = (Float_t) lCascadeResult->GetCutVarV0CosPAExp0Const();
+        lValue[kCascCutVarV0CosPAPar0+1] = (Float_t) lCascadeResult->GetCutVarV0CosPAExp0Slope();
+        lValue[kCascCutVarV0CosPAPar0+2] = (Float_t) lCascadeResult->GetCutVarV0CosPAExp1Const();
+        lValue[kCascCutVarV0CosPAPar0+3] = (Float_t) lCascadeResult->GetCutVarV0CosPAExp1Slope();
+        lValue[kCascCutVarV0CosPAPar4]   = (Float_t) lCascadeResult->GetCutVarV0CosPAConst();
+        
+        lValue[kCascCutV0Radius]    = lCascadeResult->GetCutV0Radius();
+        lValue[kCascCutDCAV0ToPV]   = lCascadeResult->GetCutDCAV0ToPV();
+        lValue[kCascCutV0Mass]      = lCascadeResult->GetCutV0Mass();
+        lValue[kCascCutDCABachToPV] = lCascadeResult->GetCutDCABachToPV();
+        
+        lValue[kCascCutDCACascDaughters]    = (Float_t) lCascadeResult->GetCutDCACascDaughters();
+        lValue[kCascCutUseVarDCACascDau]    = lCascadeResult->GetCutUseVarDCACascDau();
+        lValue[kCascCutVarDCACascDauPar0]   = (Float_t) lCascadeResult->GetCutVarDCACascDauExp0Const();
+        lValue[kCascCutVarDCACascDauPar0+1] = (Float_t) lCascadeResult->GetCutVarDCACascDauExp0Slope();
+        lValue[kCascCutVarDCACascDauPar0+2] = (Float_t) lCascadeResult->GetCutVarDCACascDauExp1Const();
+        lValue[kCascCutVarDCACascDauPar0+3] = (Float_t) lCascadeResult->GetCutVarDCACascDauExp1Slope();
+        lValue[kCascCutVarDCACascDauPar4]   = (Float_t) lCascadeResult->GetCutVarDCACascDauConst();
+        
+        lValue[kCascCutCascCosPA]          = (Float_t) lCascadeResult->GetCutCascCosPA();
+        lValue[kCascCutUseVarCascCosPA]    = lCascadeResult->GetCutUseVarCascCosPA();
+        lValue[kCascCutVarCascCosPAPar0]   = (Float_t) lCascadeResult->GetCutVarCascCosPAExp0Const();
+        lValue[kCascCutVarCascCosPAPar0+1] = (Float_t) lCascadeResult->GetCutVarCascCosPAExp0Slope();
+        lValue[kCascCutVarCascCosPAPar0+2] = (Float_t) lCascadeResult->GetCutVarCascCosPAExp1Const();
+        lValue[kCascCutVarCascCosPAPar0+3] = (Float_t) lCascadeResult->GetCutVarCascCosPAExp1Slope();
+        lValue[kCascCutVarCascCosPAPar4]   = (Float_t) lCascadeResult->GetCutVarCascCosPAConst();
+        
+        lValue[kCascCutCascRadius]            = lCascadeResult->GetCutCascRadius();
+        lValue[kCascCutV0MassSigma]           = lCascadeResult->GetCutV0MassSigma();
+        lValue[kCascCutProperLifetime]        = lCascadeResult->GetCutProperLifetime();
+        lValue[kCascCutLeastNumberOfClusters] = lCascadeResult->GetCutLeastNumberOfClusters();
+        lValue[kCascCutTPCdEdx]               = lCascadeResult->GetCutTPCdEdx();
+        lValue[kCascCutXiRejection]           = lCascadeResult->GetCutXiRejection();
+        lValue[kCascCutDCABachToBaryon]       = lCascadeResult->GetCutDCABachToBaryon();
+        
+        lValue[kCascCutBachBaryonCosPA]   = (Float_t) lCascadeResult->GetCutBachBaryonCosPA();
+        lValue[kCascCutUseVarBBCosPA]     = lCascadeResult->GetCutUseVarBBCosPA();
+        lValue[kCascCutVarBBCosPAPar0]    = (Float_t) lCascadeResult->GetCutVarBBCosPAExp0Const();
+        lValue[kCascCutVarBBCosPAPar0+1]  = (Float_t) lCascadeResult->GetCutVarBBCosPAExp0Slope();
+        lValue[kCascCutVarBBCosPAPar0+2]  = (Float_t) lCascadeResult->GetCutVarBBCosPAExp1Const();
+        lValue[kCascCutVarBBCosPAPar0+3]  = (Float_t) lCascadeResult->GetCutVarBBCosPAExp1Slope();
+        lValue[kCascCutVarBBCosPAPar4]    = (Float_t) lCascadeResult->GetCutVarBBCosPAConst();
+        
+        lValue[kCascCutMinV0Lifetime]      = lCascadeResult->GetCutMinV0Lifetime();
+        lValue[kCascCutMaxV0Lifetime]      = lCascadeResult->GetCutMaxV0Lifetime();
+        lValue[kCascCutUseITSRefitTracks]  = lCascadeResult->GetCutUseITSRefitTracks();
+        lValue[kCascCutMaxChi2PerCluster]  = lCascadeResult->GetCutMaxChi2PerCluster();
+        lValue[kCascCutMinTrackLength]     = lCascadeResult->GetCutMinTrackLength();
+        lValue[kCascCutUse276TeVV0CosPA]   = lCascadeResult->GetCutUse276TeVV0CosPA();
+        lValue[kCascCutDCACascadeToPV]     = lCascadeResult->GetCutDCACascadeToPV();
+        lValue[kCascCutDCANegToPVWeighted] = lCascadeResult->GetCutDCANegToPVWeighted();
+        lValue[kCascCutDCAPosToPVWeighted] = lCascadeResult->GetCutDCAPosToPVWeighted();
+        lValue[kCascCutDCABachToPVWeighted] = lCascadeResult->GetCutDCABachToPVWeighted();
+        
+        for(Int_t iVar=0; iVar<kNCascCutVariables; iVar++) fCascadeCutArray[iVar*lN+lcfg] = lValue[iVar];
+    }
+    if( lN < 1 ) return;
+    
+    //Loosest value of the one-sided cuts: candidates failing these fail all configurations
+    //(variable V0 and cascade CosPA and DCA cascade daughters can only be tighter than the
+    //non-variable cut; the variable bachelor-baryon CosPA is looser and is not used here)
+    fCascadeLoosestCut[kCascCutDCANegToPV]       = TMath::MinElement( lN, &fCascadeCutArray[kCascCutDCANegToPV*lN]       );
+    fCascadeLoosestCut[kCascCutDCAPosToPV]       = TMath::MinElement( lN, &fCascadeCutArray[kCascCutDCAPosToPV*lN]       );
+    fCascadeLoosestCut[kCascCutDCAV0Daughters]   = TMath::MaxElement( lN, &fCascadeCutArray[kCascCutDCAV0Daughters*lN]   );
+    fCascadeLoosestCut[kCascCutV0CosPA]          = TMath::MinElement( lN, &fCascadeCutArray[kCascCutV0CosPA*lN]          );
+    fCascadeLoosestCut[kCascCutV0Radius]         = TMath::MinElement( lN, &fCascadeCutArray[kCascCutV0Radius*lN]         );
+    fCascadeLoosestCut[kCascCutDCAV0ToPV]        = TMath::MinElement( lN, &fCascadeCutArray[kCascCutDCAV0ToPV*lN]        );
+    fCascadeLoosestCut[kCascCutDCABachToPV]      = TMath::MinElement( lN, &fCascadeCutArray[kCascCutDCABachToPV*lN]      );
+    fCascadeLoosestCut[kCascCutDCACascDaughters] = TMath::MaxElement( lN, &fCascadeCutArray[kCascCutDCACascDaughters*lN] );
+    fCascadeLoosestCut[kCascCutCascCosPA]        = TMath::MinElement( lN, &fCascadeCutArray[kCascCutCascCosPA*lN]        );
+    fCascadeLoosestCut[kCascCutCascRadius]       = TMath::MinElement( lN, &fCascadeCutArray[kCascCutCascRadius*lN]       );
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskStrangenessVsMultiplicityRun2::SetupStandardVertexing()
 //Meant to store standard re-vertexing configuration
@@ -44,6 +44,7 @@ class AliCFContainer;
 class AliV0Result;
 class AliCascadeResult;
 
+#include <vector>
 //#include "TString.h"
 //#include "AliESDtrackCuts.h"
 //#include "AliAnalysisTaskSE.h"
@@ -509,6 +510,22 @@ private:
     TH1D *fHistEventCounter; //!
     TH1D *fHistCentrality; //!
 
+//===========================================================================================
+//   Superlight mode: configurations compiled into cut arrays
+//===========================================================================================
+
+    Int_t fNCompiledV0Configurations;             //! number of configurations in fV0CutArray
+    std::vector<Double_t> fV0CutArray;            //! cut values of all V0 configurations, [cut variable][configuration]
+    std::vector<Double_t> fV0LoosestCut;          //! loosest value of each one-sided V0 cut over all configurations
+    std::vector<TH3F*> fV0CutHistos;              //! output histogram of each V0 configuration
+    Int_t fNCompiledCascadeConfigurations;        //! number of configurations in fCascadeCutArray
+    std::vector<Double_t> fCascadeCutArray;       //! cut values of all cascade configurations, [cut variable][configuration]
+    std::vector<Double_t> fCascadeLoosestCut;     //! loosest value of each one-sided cascade cut over all configurations
+    std::vector<TH3F*> fCascadeCutHistos;         //! output histogram of each cascade configuration
+
+    void CompileV0Configurations();
+    void CompileCascadeConfigurations();
+
     AliAnalysisTaskStrangenessVsMultiplicityRun2(const AliAnalysisTaskStrangenessVsMultiplicityRun2&);            // not implemented
     AliAnalysisTaskStrangenessVsMultiplicityRun2& operator=(const AliAnalysisTaskStrangenessVsMultiplicityRun2&); // not implemented
 
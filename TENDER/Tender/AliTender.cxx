@@ -15,12 +15,19 @@
 
 /* $Id$ */
 
+#include <fstream>
+
 #include <TChain.h>
 #include <TFile.h>
+#include <TKey.h>
+#include <TMap.h>
+#include <TObjString.h>
+#include <TSystem.h>
  
 #include "AliTender.h"
 #include "AliTenderSupply.h"
 #include "AliAnalysisManager.h"
+#include "AliCDBEntry.h"
 #include "AliCDBManager.h"
 #include "AliESDEvent.h"
 #include "AliESDInputHandler.h"
@@ -41,7 +48,11 @@ AliTender::AliTender():
            fESDhandler(NULL),
            fESD(NULL),
            fSupplies(NULL),
-           fCDBSettings(NULL)
+           fCDBSettings(NULL),
+           fCDBSnapshotDir(),
+           fWriteCDBSnapshot(kFALSE),
+           fCDBSnapshotSet(kFALSE),
+           fCDBCachedPaths(NULL)
 {
 // Dummy constructor
 }
@@ -58,7 +69,11 @@ AliTender::AliTender(const char* name):
            fESDhandler(NULL),
            fESD(NULL),
            fSupplies(NULL),
-           fCDBSettings(NULL)
+           fCDBSettings(NULL),
+           fCDBSnapshotDir(),
+           fWriteCDBSnapshot(kFALSE),
+           fCDBSnapshotSet(kFALSE),
+           fCDBCachedPaths(NULL)
 {
 // Default constructor
   DefineOutput(1,  AliESDEvent::Class());
@@ -72,6 +87,7 @@ AliTender::~AliTender()
     fSupplies->Delete();
     delete fSupplies;
   }
+  delete fCDBCachedPaths;
 }
 
 //______________________________________________________________________________
@@ -127,6 +143,7 @@ void AliTender::ConnectInputData(Option_t* option)
     // Lock CDB
     fCDBkey = fCDB->SetLock(kTRUE, fCDBkey);
   }
+  if (run) ConfigureCDBSnapshot();
   TIter next(fSupplies);
   AliTenderSupply *supply;
   while ((supply=(AliTenderSupply*)next())) supply->Init();
@@ -169,10 +186,13 @@ void AliTender::UserExec(Option_t* option)
       // Lock CDB
       fCDBkey = fCDB->SetLock(kTRUE, fCDBkey);
     } 
+    ConfigureCDBSnapshot();
   }
   TIter next(fSupplies);
   AliTenderSupply *supply;
   while ((supply=(AliTenderSupply*)next())) supply->ProcessEvent();
+  // The supplies fetch their CDB objects when the run changes
+  if (fWriteCDBSnapshot) WriteCDBSnapshot();
   fRunChanged = kFALSE;
 
   if (TObject::TestBit(kCheckEventSelection)) fESDhandler->CheckSelectionMask();
@@ -187,3 +207,199 @@ void AliTender::SetDefaultCDBStorage(const char *dbString)
 // Set default CDB storage
    fDefaultStorage = dbString;
 }
+
+//______________________________________________________________________________
+TString AliTender::GetCDBSnapshotFileName(const char *dir, Int_t run)
+{
+// Name of the CDB snapshot of a run
+   TString fname = Form("%s/OCDB_%d.root", dir, run);
+   gSystem->ExpandPathName(fname);
+   return fname;
+}
+
+//______________________________________________________________________________
+void AliTender::ConfigureCDBSnapshot()
+{
+// Read the CDB objects of the current run from its snapshot if it exists,
+// otherwise write the snapshot after the supplies processed the first event.
+// A snapshot mode set by another task (e.g. AliTaskCDBconnect) is only replaced
+// by the one of the run, it is never switched off. The tender switches off its
+// own snapshot mode only if it handles the CDB.
+  fWriteCDBSnapshot = kFALSE;
+  if (fCDBSnapshotDir.IsNull() || !fRun || !fCDB) return;
+  TString fname = GetCDBSnapshotFileName(fCDBSnapshotDir, fRun);
+  if (!gSystem->AccessPathName(fname, kReadPermission)) {
+    AliInfo(Form("Reading the CDB objects of run %d from the snapshot %s", fRun, fname.Data()));
+    fCDB->SetSnapshotMode(fname);
+    fCDBSnapshotSet = kTRUE;
+    return;
+  }
+  if (fCDBSnapshotSet) {
+    if (!fHandleCDB) {
+      // the objects would partly come from the snapshot of the previous run
+      AliWarning(Form("Snapshot of a previous run in use, the snapshot of run %d is not written", fRun));
+      return;
+    }
+    fCDB->UnsetSnapshotMode();
+    fCDBSnapshotSet = kFALSE;
+  }
+  if (!fCDB->GetCacheFlag()) {
+    AliWarning(Form("CDB cache switched off, the snapshot of run %d is not written", fRun));
+    return;
+  }
+  // only the objects retrieved from now on by the supplies go to the snapshot
+  if (!fCDBCachedPaths) {
+    fCDBCachedPaths = new TObjArray();
+    fCDBCachedPaths->SetOwner();
+  }
+  fCDBCachedPaths->Clear();
+  TIter nextPath(fCDB->GetEntryCache());
+  TObject *path;
+  while ((path=nextPath())) fCDBCachedPaths->Add(new TObjString(path->GetName()));
+  fWriteCDBSnapshot = kTRUE;
+}
+
+//______________________________________________________________________________
+void AliTender::WriteCDBSnapshot()
+{
+// Write the CDB objects retrieved by the supplies for the current run to its snapshot.
+  fWriteCDBSnapshot = kFALSE;
+  TString fname = GetCDBSnapshotFileName(fCDBSnapshotDir, fRun);
+  if (!gSystem->AccessPathName(fname)) return; // written meanwhile by another job
+  TObjArray entries;
+  const TMap *cache = fCDB->GetEntryCache();
+  TIter nextPath(cache);
+  TObject *path;
+  while ((path=nextPath())) {
+    if (fCDBCachedPaths && fCDBCachedPaths->FindObject(path->GetName())) continue;
+    AliCDBEntry *entry = dynamic_cast<AliCDBEntry*>(cache->GetValue(path));
+    if (entry) entries.Add(entry);
+  }
+  if (fCDBCachedPaths) fCDBCachedPaths->Clear();
+  if (!entries.GetEntriesFast()) {
+    AliWarning(Form("No CDB objects retrieved by the supplies for run %d, no snapshot written", fRun));
+    return;
+  }
+  TString dir = fCDBSnapshotDir;
+  gSystem->ExpandPathName(dir);
+  gSystem->mkdir(dir, kTRUE);
+  if (!WriteCDBSnapshotFile(fname, &entries)) {
+    AliError(Form("Could not write the CDB snapshot %s", fname.Data()));
+    return;
+  }
+  AliInfo(Form("%d CDB objects of run %d written to the snapshot %s", entries.GetEntriesFast(), fRun, fname.Data()));
+}
+
+//______________________________________________________________________________
+Bool_t AliTender::WriteCDBSnapshotFile(const char *fname, const TCollection *entries)
+{
+// Write the CDB entries to the snapshot fname, one key per entry as read by the
+// snapshot mode of the CDB manager. The file is written under a temporary name and
+// renamed, so that concurrent jobs never read an incomplete snapshot.
+  TString tmpname = Form("%s.%d.tmp", fname, gSystem->GetPid());
+  TFile *file = TFile::Open(tmpname, "RECREATE");
+  if (!file || file->IsZombie()) {
+    delete file;
+    return kFALSE;
+  }
+  TIter next(entries);
+  AliCDBEntry *entry;
+  while ((entry=(AliCDBEntry*)next())) {
+    TString key = entry->GetId().GetPath();
+    key.ReplaceAll("/", "*");
+    file->WriteTObject(entry, key);
+  }
+  file->Close();
+  delete file;
+  if (gSystem->Rename(tmpname, fname)) {
+    gSystem->Unlink(tmpname);
+    return kFALSE;
+  }
+  return kTRUE;
+}
+
+//______________________________________________________________________________
+Int_t AliTender::BuildCDBSnapshots(const char *dir, const char *runList, const char *paths)
+{
+// Build ahead of time the CDB snapshots of the runs in runList (separated by blanks
+// or commas, or a text file with the runs) with the CDB objects in paths (separated by
+// blanks or commas). If paths is not given, the objects of an existing snapshot in dir
+// are taken. The CDB storages must be configured as in the jobs, and the CDB manager
+// must not be locked. Returns the number of snapshots written.
+  AliCDBManager *man = AliCDBManager::Instance();
+  if (!man->IsDefaultStorageSet()) {
+    ::Error("AliTender::BuildCDBSnapshots", "Default CDB storage not set.");
+    return 0;
+  }
+  TString expdir = dir;
+  gSystem->ExpandPathName(expdir);
+
+  TObjArray *cdbPaths = 0;
+  if (paths && paths[0]) {
+    cdbPaths = TString(paths).Tokenize(", ");
+  } else {
+    cdbPaths = new TObjArray();
+    void *dirp = gSystem->OpenDirectory(expdir);
+    const char *fileName;
+    while (dirp && (fileName = gSystem->GetDirEntry(dirp)) && !cdbPaths->GetEntriesFast()) {
+      TString snapshot = fileName;
+      if (!snapshot.BeginsWith("OCDB_") || !snapshot.EndsWith(".root")) continue;
+      TFile *file = TFile::Open(Form("%s/%s", expdir.Data(), fileName), "READ");
+      if (!file) continue;
+      // one key per entry, named after the path with '/' replaced by '*'
+      TIter nextKey(file->GetListOfKeys());
+      TKey *key;
+      while ((key=(TKey*)nextKey())) {
+        if (strcmp(key->GetClassName(), AliCDBEntry::Class_Name())) continue;
+        TString path = key->GetName();
+        path.ReplaceAll("*", "/");
+        cdbPaths->Add(new TObjString(path));
+      }
+      delete file;
+    }
+    if (dirp) gSystem->FreeDirectory(dirp);
+  }
+  cdbPaths->SetOwner();
+  if (!cdbPaths->GetEntriesFast()) {
+    ::Error("AliTender::BuildCDBSnapshots", "No CDB paths given and no snapshot found in %s.", expdir.Data());
+    delete cdbPaths;
+    return 0;
+  }
+
+  TString runs = runList;
+  if (!gSystem->AccessPathName(runs)) {
+    std::ifstream in(runs.Data());
+    runs.ReadFile(in);
+  }
+  TObjArray *runArray = runs.Tokenize(", \t\n");
+  gSystem->mkdir(expdir, kTRUE);
+  // the entries are owned by the cache
+  Bool_t cacheFlag = man->GetCacheFlag();
+  man->SetCacheFlag(kTRUE);
+  Int_t nWritten = 0;
+  for (Int_t iRun = 0; iRun < runArray->GetEntriesFast(); iRun++) {
+    Int_t run = static_cast<TObjString*>(runArray->At(iRun))->GetString().Atoi();
+    if (run <= 0) continue;
+    TString fname = GetCDBSnapshotFileName(dir, run);
+    if (!gSystem->AccessPathName(fname)) continue;
+    man->SetRun(run);
+    TObjArray entries;
+    for (Int_t iPath = 0; iPath < cdbPaths->GetEntriesFast(); iPath++) {
+      AliCDBEntry *entry = man->Get(static_cast<TObjString*>(cdbPaths->At(iPath))->GetString());
+      if (entry) entries.Add(entry);
+    }
+    if (entries.GetEntriesFast() < cdbPaths->GetEntriesFast()) {
+      ::Error("AliTender::BuildCDBSnapshots", "Not all CDB objects found for run %d, no snapshot written", run);
+      continue;
+    }
+    if (!WriteCDBSnapshotFile(fname, &entries)) {
+      ::Error("AliTender::BuildCDBSnapshots", "Could not write the CDB snapshot %s", fname.Data());
+      continue;
+    }
+    nWritten++;
+  }
+  man->SetCacheFlag(cacheFlag);
+  delete runArray;
+  delete cdbPaths;
+  return nWritten;
+}
@@ -20,6 +20,7 @@
 // #ifndef ALIESDINPUTHANDLER_H
 // #include "AliESDInputHandler.h"
 // #endif
+class TCollection;
 class AliCDBManager;
 class AliESDEvent;
 class AliESDInputHandler;
@@ -43,9 +44,15 @@ private:
   AliESDEvent              *fESD;            //! Pointer to current ESD event
   TObjArray                *fSupplies;       // Array of tender supplies
   TObjArray                *fCDBSettings;    // Array with CDB configuration
+  TString                   fCDBSnapshotDir;  // Directory of the per-run CDB snapshots (empty: no snapshots)
+  Bool_t                    fWriteCDBSnapshot; //! Snapshot of the current run to be written
+  Bool_t                    fCDBSnapshotSet;  //! Snapshot mode of the CDB manager switched on by the tender
+  TObjArray                *fCDBCachedPaths;  //! Paths in the CDB cache before the supplies processed the run
   
   AliTender(const AliTender &other);
   AliTender& operator=(const AliTender &other);
+  void                      ConfigureCDBSnapshot();
+  void                      WriteCDBSnapshot();
 
 public:  
   AliTender();
@@ -68,6 +75,18 @@ public:
    */
   void 			    SetHandleOCDB(Bool_t doHandle) { fHandleCDB = doHandle; }
   void SetESDhandler(AliESDInputHandler*esdH) {fESDhandler = esdH;}
+  /**
+   * Read the CDB objects of each run from a snapshot file in dir, written by the first job
+   * processing the run (or by BuildCDBSnapshots). The snapshot has the objects retrieved by
+   * the supplies when the run starts, the CDB cache must be switched on to write it. The
+   * directory must be used by a single tender configuration.
+   * @param[in] dir Directory of the snapshots, empty to switch off
+   */
+  void                      SetCDBSnapshotDir(const char *dir) {fCDBSnapshotDir = dir;}
+  const char               *GetCDBSnapshotDir() const {return fCDBSnapshotDir.Data();}
+  static TString            GetCDBSnapshotFileName(const char *dir, Int_t run);
+  static Int_t              BuildCDBSnapshots(const char *dir, const char *runList, const char *paths=0);
+  static Bool_t             WriteCDBSnapshotFile(const char *fname, const TCollection *entries);
 
   // Run control
   virtual void              ConnectInputData(Option_t *option = "");
@@ -75,6 +94,6 @@ public:
 //  virtual Bool_t            Notify() {return kTRUE;}
   virtual void              UserExec(Option_t *option);
     
-  ClassDef(AliTender,4)  // Class describing the tender car for ESD analysis
+  ClassDef(AliTender,5)  // Class describing the tender car for ESD analysis
 };
 #endif